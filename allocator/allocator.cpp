@@ -1,11 +1,26 @@
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
 #include <cassert>
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <cstdio>
 #include <cstdlib>
-#include <vector>
-#include <limits>
-#include <algorithm>
 #include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 struct Block
 {
@@ -13,18 +28,287 @@ struct Block
 	size_t   size;
 };
 
+enum class ThreadingMode
+{
+	// the caller serializes all calls
+	Unsynchronized,
+	// every call locks the heap
+	Synchronized,
+	// small blocks are served from per-thread caches without locking the heap
+	ThreadCached,
+};
+
+struct LatencyPercentiles
+{
+	uint64_t p50;
+	uint64_t p90;
+	uint64_t p99;
+	uint64_t p999;
+	uint64_t max;
+};
+
+struct AllocatorStatistics
+{
+	// bytes requested by blocks, which have not been freed yet
+	size_t bytesInUse;
+	size_t peakBytesInUse;
+
+	size_t allocationCount;
+	size_t freeCount;
+	size_t failedAllocationCount;
+
+	// blocks held by thread caches are not free in the heap
+	size_t freeBlockCount;
+	size_t freeBytes;
+	size_t largestFreeBlock;
+
+	// the share of free memory, which cannot serve an allocation of all free bytes
+	double externalFragmentation;
+
+	// the n-th bucket counts free blocks of sizes in range [2^n, 2^(n+1))
+	std::array<size_t, 64> freeBlockHistogram;
+
+	// latencies are measured in nanoseconds
+	LatencyPercentiles allocLatency;
+	LatencyPercentiles freeLatency;
+};
+
+// Latencies are counted in buckets, which split every power of two range
+// into four, so that percentiles are accurate to a quarter of their magnitude.
+class LatencyHistogram
+{
+private:
+
+	static constexpr size_t SubBucketLog2  = 2;
+	static constexpr size_t SubBucketCount = size_t { 1 } << SubBucketLog2;
+	static constexpr size_t BucketCount    = 64 * SubBucketCount;
+
+	std::atomic<uint64_t> buckets [BucketCount] = { };
+	std::atomic<uint64_t> maximum { 0 };
+
+	static size_t BucketOf(const uint64_t value);
+	static uint64_t UpperBoundOf(const size_t bucket);
+
+public:
+
+	void Record(const uint64_t value);
+	LatencyPercentiles Percentiles() const;
+};
+
+size_t LatencyHistogram::BucketOf(const uint64_t value)
+{
+	if (value < SubBucketCount)
+	{
+		return static_cast<size_t>(value);
+	}
+
+	const auto log2 = static_cast<size_t>(std::bit_width(value)) - 1;
+	const auto subBucket = static_cast<size_t>(value >> (log2 - SubBucketLog2)) & (SubBucketCount - 1);
+
+	return (log2 - SubBucketLog2 + 1) * SubBucketCount + subBucket;
+}
+
+uint64_t LatencyHistogram::UpperBoundOf(const size_t bucket)
+{
+	if (bucket < SubBucketCount)
+	{
+		return bucket;
+	}
+
+	const auto log2 = bucket / SubBucketCount + SubBucketLog2 - 1;
+	const auto subBucket = bucket % SubBucketCount;
+
+	return ((uint64_t { SubBucketCount + subBucket + 1 }) << (log2 - SubBucketLog2)) - 1;
+}
+
+void LatencyHistogram::Record(const uint64_t value)
+{
+	buckets[BucketOf(value)].fetch_add(1, std::memory_order_relaxed);
+
+	auto current = maximum.load(std::memory_order_relaxed);
+
+	while (value > current && !maximum.compare_exchange_weak(current, value, std::memory_order_relaxed))
+	{
+	}
+}
+
+LatencyPercentiles LatencyHistogram::Percentiles() const
+{
+	auto counts = std::array<uint64_t, BucketCount> { };
+	auto total = uint64_t { 0 };
+
+	for (auto bucket = size_t { 0 }; bucket != BucketCount; ++bucket)
+	{
+		counts[bucket] = buckets[bucket].load(std::memory_order_relaxed);
+		total += counts[bucket];
+	}
+
+	const auto percentile = [&counts, total](const double fraction)
+	{
+		const auto rank = static_cast<uint64_t>(fraction * static_cast<double>(total));
+		auto seen = uint64_t { 0 };
+
+		for (auto bucket = size_t { 0 }; bucket != BucketCount; ++bucket)
+		{
+			seen += counts[bucket];
+
+			if (seen > rank)
+			{
+				return UpperBoundOf(bucket);
+			}
+		}
+
+		return uint64_t { 0 };
+	};
+
+	return LatencyPercentiles
+	{
+		percentile(0.5), percentile(0.9), percentile(0.99), percentile(0.999),
+		maximum.load(std::memory_order_relaxed)
+	};
+}
+
+// [Paper] - M. Masmano, I. Ripoll, A. Crespo, J. Real:
+//           TLSF: a New Dynamic Memory Allocator for Real-Time Systems
+//
+// ~ http://www.gii.upv.es/tlsf/files/papers/ecrts04_tlsf.pdf
+//
+// Free blocks are segregated into lists by their size, where the first level
+// splits sizes by powers of two and the second level splits each power of two
+// range linearly. Non-empty lists are tracked by bitmaps, so finding a free
+// block, which is large enough, takes a few bit scans instead of a search.
+//
+// Every block starts with a boundary tag holding its size and a pointer to the
+// physically preceding block, so that both neighbours of a freed block are
+// found, and coalesced with it, in constant time.
+//
+//   pool.data                                                   pool end
+//   |                                                                  |
+//   v                                                                  v
+//   +--------+---------+--------+---------+--------+---------+--------+
+//   | header | payload | header | payload | header | payload | header |
+//   +--------+---------+--------+---------+--------+---------+--------+
+//       ^                  |  ^                |                (sentinel)
+//       +------------------+  +----------------+
+//        previous physical     previous physical
+
 class Allocator
 {
 private:
 
+	struct BlockHeader
+	{
+		BlockHeader* previousPhysical;
+		size_t       sizeAndFlags;
+	};
+
+	// free blocks keep the links of their free list in the payload
+	struct FreeBlock : BlockHeader
+	{
+		FreeBlock* nextFree;
+		FreeBlock* previousFree;
+	};
+
+	static constexpr size_t Alignment        = 16;
+	static constexpr size_t HeaderSize       = sizeof(BlockHeader);
+	static constexpr size_t MinimumBlockSize = sizeof(FreeBlock);
+	static constexpr size_t FreeFlag         = 1;
+
+	static constexpr size_t SecondLevelLog2  = 3;
+	static constexpr size_t SecondLevelCount = size_t { 1 } << SecondLevelLog2;
+	static constexpr size_t FirstLevelShift  = SecondLevelLog2 + std::bit_width(Alignment) - 1;
+	static constexpr size_t SmallBlockSize   = size_t { 1 } << FirstLevelShift;
+	static constexpr size_t FirstLevelCount  = std::numeric_limits<size_t>::digits - FirstLevelShift + 1;
+
+	static_assert(HeaderSize       % Alignment == 0);
+	static_assert(MinimumBlockSize % Alignment == 0);
+	static_assert(FirstLevelCount <= std::numeric_limits<uint64_t>::digits);
+
+	struct ThreadCache
+	{
+		static constexpr size_t BlockSizeLimit = 512;
+		static constexpr size_t ClassCount     = BlockSizeLimit / Alignment + 1;
+		static constexpr size_t Capacity       = 32;
+		static constexpr size_t RefillCount    = 8;
+
+		struct CachedBlock
+		{
+			CachedBlock* next;
+		};
+
+		// cleared by the allocator, when it is destroyed,
+		// so that an exiting thread never returns blocks to a dead heap
+		std::atomic<Allocator*> allocator { nullptr };
+
+		CachedBlock* heads [ClassCount] = { };
+		size_t      counts [ClassCount] = { };
+	};
+
+	// Caches of a thread are shared with their allocators,
+	// and returned to the heaps, which are still alive, when the thread exits.
+	struct LocalThreadCaches
+	{
+		std::vector<std::pair<uint64_t, std::shared_ptr<ThreadCache>>> entries;
+
+		~LocalThreadCaches();
+	};
+
+	struct Telemetry
+	{
+		std::atomic<size_t> bytesInUse { 0 };
+		std::atomic<size_t> peakBytesInUse { 0 };
+		std::atomic<size_t> allocationCount { 0 };
+		std::atomic<size_t> freeCount { 0 };
+		std::atomic<size_t> failedAllocationCount { 0 };
+
+		LatencyHistogram allocLatency;
+		LatencyHistogram freeLatency;
+	};
+
 	Block pool;
-	std::vector<Block>     freeBlocks;
-	std::vector<Block> occupiedBlocks;
+
+	uint64_t  firstLevelBitmap;
+	uint32_t secondLevelBitmaps [FirstLevelCount];
+	FreeBlock*        freeLists [FirstLevelCount][SecondLevelCount];
+
+	ThreadingMode mode;
+	std::mutex    mutex;
+
+	uint64_t                                  id;
+	std::vector<std::shared_ptr<ThreadCache>> threadCaches;
+
+	// telemetry is opt-in, since measuring latencies costs two clock reads per call
+	std::unique_ptr<Telemetry> telemetry;
+
+	static BlockHeader* HeaderOf(uint8_t* const data);
+	static uint8_t* PayloadOf(BlockHeader* const header);
+	static size_t SizeOf(const BlockHeader* const header);
+	static bool IsFree(const BlockHeader* const header);
+	static BlockHeader* NextPhysical(BlockHeader* const header);
+	static size_t BlockSizeFor(const size_t size);
+	static std::pair<size_t, size_t> Mapping(const size_t blockSize);
+	static uint64_t NextId();
+	static std::mutex& ThreadCachesMutex();
+
+	void Reset();
+	void InsertFreeBlock(FreeBlock* const block);
+	void RemoveFreeBlock(FreeBlock* const block);
+	FreeBlock* FindFreeBlock(const size_t blockSize);
+	FreeBlock* FindFreeBlockInList(const size_t blockSize);
+	void SplitBlock(BlockHeader* const block, const size_t blockSize);
+	BlockHeader* AllocateBlock(const size_t blockSize, const size_t alignment);
+	void FreeBlockHeader(BlockHeader* const block);
+	ThreadCache& LocalThreadCache();
+	void AdoptThreadCaches(std::vector<std::shared_ptr<ThreadCache>>&& caches);
+	void FlushThreadCache(ThreadCache& cache);
+	std::unique_lock<std::mutex> Lock();
+	Block AllocUntimed(const size_t size, const size_t alignment);
+	void FreeUntimed(const Block block);
 
 public:
 
 	Allocator();
-	explicit Allocator(const size_t size);
+	explicit Allocator(const size_t size, const ThreadingMode mode = ThreadingMode::Unsynchronized);
 	~Allocator();
 
 	Allocator(const Allocator& allocator) = delete;
@@ -33,151 +317,1159 @@ public:
 	Allocator& operator =(const Allocator& allocator) = delete;
 	Allocator& operator =(Allocator&& allocator);
 
-	Block Alloc(const size_t size);
+	Block Alloc(const size_t size, const size_t alignment = Alignment);
 	void Free(const Block block);
+
+	// must be called before the allocator is shared between threads
+	void EnableStatistics();
+	AllocatorStatistics Statistics();
+	bool DumpHeapMap(const char* const path);
 };
 
+Allocator::BlockHeader* Allocator::HeaderOf(uint8_t* const data)
+{
+	return reinterpret_cast<BlockHeader*>(data - HeaderSize);
+}
+
+uint8_t* Allocator::PayloadOf(BlockHeader* const header)
+{
+	return reinterpret_cast<uint8_t*>(header) + HeaderSize;
+}
+
+size_t Allocator::SizeOf(const BlockHeader* const header)
+{
+	return header->sizeAndFlags & ~FreeFlag;
+}
+
+bool Allocator::IsFree(const BlockHeader* const header)
+{
+	return (header->sizeAndFlags & FreeFlag) != 0;
+}
+
+Allocator::BlockHeader* Allocator::NextPhysical(BlockHeader* const header)
+{
+	return reinterpret_cast<BlockHeader*>(reinterpret_cast<uint8_t*>(header) + SizeOf(header));
+}
+
+size_t Allocator::BlockSizeFor(const size_t size)
+{
+	const auto blockSize = (std::max<size_t>(size, 1) + HeaderSize + Alignment - 1) & ~(Alignment - 1);
+
+	return std::max(blockSize, MinimumBlockSize);
+}
+
+std::pair<size_t, size_t> Allocator::Mapping(const size_t blockSize)
+{
+	if (blockSize < SmallBlockSize)
+	{
+		return { 0, blockSize / (SmallBlockSize / SecondLevelCount) };
+	}
+
+	const auto log2 = static_cast<size_t>(std::bit_width(blockSize)) - 1;
+
+	return
+	{
+		log2 - FirstLevelShift + 1,
+		(blockSize >> (log2 - SecondLevelLog2)) ^ SecondLevelCount
+	};
+}
+
+uint64_t Allocator::NextId()
+{
+	static auto counter = std::atomic<uint64_t> { 0 };
+
+	return ++counter;
+}
+
 Allocator::Allocator()
 :
 	pool { nullptr, 0 },
-	freeBlocks { },
-	occupiedBlocks { }
+	firstLevelBitmap { },
+	secondLevelBitmaps { },
+	freeLists { },
+	mode { ThreadingMode::Unsynchronized },
+	mutex { },
+	id { NextId() },
+	threadCaches { },
+	telemetry { }
 {
 }
 
-Allocator::Allocator(const size_t size)
+Allocator::Allocator(const size_t size, const ThreadingMode mode)
 :
 	pool { static_cast<uint8_t*>(std::malloc(size)), size },
-	freeBlocks { pool },
-	occupiedBlocks { }
+	firstLevelBitmap { },
+	secondLevelBitmaps { },
+	freeLists { },
+	mode { mode },
+	mutex { },
+	id { NextId() },
+	threadCaches { },
+	telemetry { }
 {
 	assert(pool.data != nullptr);
+	assert(reinterpret_cast<uintptr_t>(pool.data) % Alignment == 0);
+
+	Reset();
 }
 
 Allocator::~Allocator()
 {
+	AdoptThreadCaches({ });
+
 	std::free(pool.data);
 }
 
 Allocator::Allocator(Allocator&& allocator)
 :
 	pool { allocator.pool },
-	freeBlocks { std::move(allocator.freeBlocks) },
-	occupiedBlocks { std::move(allocator.occupiedBlocks) }
+	firstLevelBitmap { allocator.firstLevelBitmap },
+	secondLevelBitmaps { },
+	freeLists { },
+	mode { allocator.mode },
+	mutex { },
+	id { allocator.id },
+	threadCaches { },
+	telemetry { std::move(allocator.telemetry) }
 {
+	std::copy(std::begin(allocator.secondLevelBitmaps), std::end(allocator.secondLevelBitmaps), secondLevelBitmaps);
+	std::copy(&allocator.freeLists[0][0], &allocator.freeLists[0][0] + FirstLevelCount * SecondLevelCount, &freeLists[0][0]);
+
+	AdoptThreadCaches(std::move(allocator.threadCaches));
+
 	allocator.pool = Block { nullptr, 0 };
-	allocator.freeBlocks.clear();
-	allocator.occupiedBlocks.clear();
+	allocator.id = NextId();
+	allocator.threadCaches.clear();
+	allocator.Reset();
 }
 
 Allocator& Allocator::operator =(Allocator&& allocator)
 {
-	this->pool = allocator.pool;
-	this->freeBlocks = std::move(allocator.freeBlocks);
-	this->occupiedBlocks = std::move(allocator.occupiedBlocks);
+	if (this != &allocator)
+	{
+		std::free(this->pool.data);
 
-	allocator.pool = Block { nullptr, 0 };
-	allocator.freeBlocks.clear();
-	allocator.occupiedBlocks.clear();
+		this->pool = allocator.pool;
+		this->firstLevelBitmap = allocator.firstLevelBitmap;
+		std::copy(std::begin(allocator.secondLevelBitmaps), std::end(allocator.secondLevelBitmaps), this->secondLevelBitmaps);
+		std::copy(&allocator.freeLists[0][0], &allocator.freeLists[0][0] + FirstLevelCount * SecondLevelCount, &this->freeLists[0][0]);
+		this->mode = allocator.mode;
+		this->id = allocator.id;
+		this->AdoptThreadCaches(std::move(allocator.threadCaches));
+		this->telemetry = std::move(allocator.telemetry);
+
+		allocator.pool = Block { nullptr, 0 };
+		allocator.id = NextId();
+		allocator.threadCaches.clear();
+		allocator.Reset();
+	}
 
 	return *this;
 }
 
-Block Allocator::Alloc(const size_t size)
+void Allocator::Reset()
 {
-	const auto blockComparerBySize = [](const Block& left, const Block& right)
+	firstLevelBitmap = 0;
+	std::fill(std::begin(secondLevelBitmaps), std::end(secondLevelBitmaps), 0);
+	std::fill(&freeLists[0][0], &freeLists[0][0] + FirstLevelCount * SecondLevelCount, nullptr);
+
+	const auto usableSize = pool.size & ~(Alignment - 1);
+
+	if (pool.data == nullptr || usableSize < MinimumBlockSize + HeaderSize)
 	{
-		return left.size < right.size;
-	};
+		return;
+	}
+
+	// the whole pool is a single free block followed by an allocated sentinel,
+	// so that every block has a physically next block
+	const auto block = reinterpret_cast<FreeBlock*>(pool.data);
+	block->previousPhysical = nullptr;
+	block->sizeAndFlags = (usableSize - HeaderSize) | FreeFlag;
+
+	const auto sentinel = NextPhysical(block);
+	sentinel->previousPhysical = block;
+	sentinel->sizeAndFlags = 0;
+
+	InsertFreeBlock(block);
+}
+
+void Allocator::InsertFreeBlock(FreeBlock* const block)
+{
+	const auto [firstLevel, secondLevel] = Mapping(SizeOf(block));
+
+	auto& head = freeLists[firstLevel][secondLevel];
+
+	block->nextFree = head;
+	block->previousFree = nullptr;
+
+	if (head != nullptr)
+	{
+		head->previousFree = block;
+	}
+
+	head = block;
+
+	firstLevelBitmap |= uint64_t { 1 } << firstLevel;
+	secondLevelBitmaps[firstLevel] |= uint32_t { 1 } << secondLevel;
+}
+
+void Allocator::RemoveFreeBlock(FreeBlock* const block)
+{
+	const auto [firstLevel, secondLevel] = Mapping(SizeOf(block));
 
-	// find smallest free block
-	const auto smallestFreeBlock = std::min_element
-	(
-		freeBlocks.begin(), freeBlocks.end(), blockComparerBySize
-	);
+	if (block->nextFree != nullptr)
+	{
+		block->nextFree->previousFree = block->previousFree;
+	}
+
+	if (block->previousFree != nullptr)
+	{
+		block->previousFree->nextFree = block->nextFree;
+	}
+	else
+	{
+		freeLists[firstLevel][secondLevel] = block->nextFree;
+
+		if (block->nextFree == nullptr)
+		{
+			secondLevelBitmaps[firstLevel] &= ~(uint32_t { 1 } << secondLevel);
+
+			if (secondLevelBitmaps[firstLevel] == 0)
+			{
+				firstLevelBitmap &= ~(uint64_t { 1 } << firstLevel);
+			}
+		}
+	}
+}
 
-	// remove free block from pool of free blocks
-	freeBlocks.erase(smallestFreeBlock);
+// the last resort, before running out of memory, is searching the list,
+// which holds blocks both smaller and larger than the required size
+Allocator::FreeBlock* Allocator::FindFreeBlockInList(const size_t blockSize)
+{
+	const auto [firstLevel, secondLevel] = Mapping(blockSize);
 
-	// occupy found block
-	occupiedBlocks.emplace_back(Block { smallestFreeBlock->data, size });
+	if (firstLevel >= FirstLevelCount)
+	{
+		return nullptr;
+	}
 
-	if (occupiedBlocks.back().size < smallestFreeBlock->size)
+	for (auto block = freeLists[firstLevel][secondLevel]; block != nullptr; block = block->nextFree)
 	{
-		// return remaining memory to pool of free blocks
-		const auto remainingMemory = Block
+		if (SizeOf(block) >= blockSize)
 		{
-			smallestFreeBlock->data + size,
-			smallestFreeBlock->size - occupiedBlocks.back().size
-		};
-		freeBlocks.push_back(remainingMemory);
+			RemoveFreeBlock(block);
+
+			return block;
+		}
 	}
 
-	return occupiedBlocks.back();
+	return nullptr;
 }
 
-void Allocator::Free(const Block block)
+Allocator::FreeBlock* Allocator::FindFreeBlock(const size_t blockSize)
 {
-	// invariant: there cannot be two adjacent free blocks
+	// round the size up to the next list boundary,
+	// so that any block of the found list is large enough
+	auto roundedSize = blockSize;
 
-	//  ---+------------+-------------------+--
-	// ... | free block | to be freed block | ...
-	//  ---+------------+-------------------+--
-	const auto isFreeBlockLeftAdjacent = [block](const Block& freeBlock)
+	if (blockSize >= SmallBlockSize)
 	{
-		return (freeBlock.data + freeBlock.size) == block.data;
-	};
+		const auto log2 = static_cast<size_t>(std::bit_width(blockSize)) - 1;
+		roundedSize += (size_t { 1 } << (log2 - SecondLevelLog2)) - 1;
+	}
 
-	//  ---+-------------------+------------+--
-	// ... | to be freed block | free block | ...
-	//  ---+-------------------+------------+--
-	const auto isFreeBlockRightAdjacent = [block](const Block& freeBlock)
+	auto [firstLevel, secondLevel] = Mapping(roundedSize);
+
+	if (firstLevel >= FirstLevelCount)
 	{
-		return (block.data + block.size) == freeBlock.data;
-	};
+		return FindFreeBlockInList(blockSize);
+	}
+
+	auto secondLevelBitmap = secondLevelBitmaps[firstLevel] & (~uint32_t { 0 } << secondLevel);
+
+	if (secondLevelBitmap == 0)
+	{
+		const auto firstLevelMask = (firstLevel + 1 < FirstLevelCount) ? ~uint64_t { 0 } << (firstLevel + 1) : 0;
+		const auto firstLevelBitmapAbove = firstLevelBitmap & firstLevelMask;
+
+		if (firstLevelBitmapAbove == 0)
+		{
+			return FindFreeBlockInList(blockSize);
+		}
+
+		firstLevel = static_cast<size_t>(std::countr_zero(firstLevelBitmapAbove));
+		secondLevelBitmap = secondLevelBitmaps[firstLevel];
+	}
+
+	secondLevel = static_cast<size_t>(std::countr_zero(secondLevelBitmap));
+
+	const auto block = freeLists[firstLevel][secondLevel];
+	RemoveFreeBlock(block);
+
+	return block;
+}
+
+void Allocator::SplitBlock(BlockHeader* const block, const size_t blockSize)
+{
+	const auto remainingSize = SizeOf(block) - blockSize;
+
+	if (remainingSize < MinimumBlockSize)
+	{
+		return;
+	}
+
+	//  ---+--------------------------------+--
+	// ... |             block              | ...
+	//  ---+--------------------------------+--
+	//  ---+---------------+----------------+--
+	// ... |     block     | remaining free | ...
+	//  ---+---------------+----------------+--
+	const auto flags = block->sizeAndFlags & FreeFlag;
+	block->sizeAndFlags = blockSize | flags;
+
+	const auto remaining = reinterpret_cast<FreeBlock*>(NextPhysical(block));
+	remaining->previousPhysical = block;
+	remaining->sizeAndFlags = remainingSize | FreeFlag;
 
-	const auto blockLeftAdjacent = std::find_if
-	(
-		freeBlocks.begin(), freeBlocks.end(), isFreeBlockLeftAdjacent
-	);
-	const auto blockRightAdjacent = std::find_if
-	(
-		freeBlocks.begin(), freeBlocks.end(), isFreeBlockRightAdjacent
-	);
+	NextPhysical(remaining)->previousPhysical = remaining;
 
-	if (blockLeftAdjacent  != freeBlocks.end() &&
-		blockRightAdjacent != freeBlocks.end())
+	// the block following the split block has not been free,
+	// because there cannot be two adjacent free blocks
+	InsertFreeBlock(remaining);
+}
+
+Allocator::BlockHeader* Allocator::AllocateBlock(const size_t blockSize, const size_t alignment)
+{
+	if (alignment <= Alignment)
+	{
+		const auto block = FindFreeBlock(blockSize);
+
+		if (block == nullptr)
+		{
+			return nullptr;
+		}
+
+		SplitBlock(block, blockSize);
+		block->sizeAndFlags &= ~FreeFlag;
+
+		return block;
+	}
+
+	// an alignment so large, that the padded size wraps around, cannot be satisfied
+	if (blockSize > std::numeric_limits<size_t>::max() - alignment - MinimumBlockSize)
 	{
-		//   --+------------+-------------------+------------+--
-		// ... | free block | to be freed block | free block | ...
-		//   --+------------+-------------------+------------+--
-		blockLeftAdjacent->size += (blockRightAdjacent->size + block.size);
-		freeBlocks.erase(blockRightAdjacent);
+		return nullptr;
 	}
-	else if (blockLeftAdjacent != freeBlocks.end())
+
+	// reserve enough space to split off a leading free block,
+	// which moves the payload to the required alignment
+	const auto block = FindFreeBlock(blockSize + alignment + MinimumBlockSize);
+
+	if (block == nullptr)
 	{
-		blockLeftAdjacent->size += block.size;
+		return nullptr;
 	}
-	else if (blockRightAdjacent != freeBlocks.end())
+
+	const auto payload = reinterpret_cast<uintptr_t>(PayloadOf(block));
+	auto alignedPayload = (payload + alignment - 1) & ~(alignment - 1);
+
+	if (alignedPayload != payload && alignedPayload - payload < MinimumBlockSize)
 	{
-		blockRightAdjacent->data = block.data;
-		blockRightAdjacent->size += block.size;
+		alignedPayload = (payload + MinimumBlockSize + alignment - 1) & ~(alignment - 1);
 	}
-	else
+
+	auto aligned = static_cast<BlockHeader*>(block);
+
+	if (const auto gap = alignedPayload - payload; gap != 0)
 	{
-		freeBlocks.push_back(block);
+		//  ---+-----+-------------------------+--
+		// ... | gap |      aligned block      | ...
+		//  ---+-----+-------------------------+--
+		aligned = reinterpret_cast<BlockHeader*>(reinterpret_cast<uint8_t*>(block) + gap);
+		aligned->previousPhysical = block;
+		aligned->sizeAndFlags = SizeOf(block) - gap;
+
+		NextPhysical(aligned)->previousPhysical = aligned;
+
+		block->sizeAndFlags = gap | FreeFlag;
+
+		// the block preceding the found block has not been free,
+		// because there cannot be two adjacent free blocks
+		InsertFreeBlock(block);
 	}
+
+	SplitBlock(aligned, blockSize);
+	aligned->sizeAndFlags &= ~FreeFlag;
+
+	return aligned;
 }
 
-int main()
+void Allocator::FreeBlockHeader(BlockHeader* block)
 {
-	auto allocator = Allocator { 128 };
+	// invariant: there cannot be two adjacent free blocks
+	assert(!IsFree(block));
+
+	auto size = SizeOf(block);
+
+	//  ---+------------+-------------------+--
+	// ... | free block | to be freed block | ...
+	//  ---+------------+-------------------+--
+	const auto previous = block->previousPhysical;
+
+	if (previous != nullptr && IsFree(previous))
+	{
+		RemoveFreeBlock(static_cast<FreeBlock*>(previous));
+
+		size += SizeOf(previous);
+		block = previous;
+	}
 
-	const auto block = allocator.Alloc(32);
+	//  ---+-------------------+------------+--
+	// ... | to be freed block | free block | ...
+	//  ---+-------------------+------------+--
+	const auto next = reinterpret_cast<BlockHeader*>(reinterpret_cast<uint8_t*>(block) + size);
+
+	if (IsFree(next))
+	{
+		RemoveFreeBlock(static_cast<FreeBlock*>(next));
+
+		size += SizeOf(next);
+	}
+
+	block->sizeAndFlags = size | FreeFlag;
+	NextPhysical(block)->previousPhysical = block;
+
+	InsertFreeBlock(static_cast<FreeBlock*>(block));
+}
+
+std::unique_lock<std::mutex> Allocator::Lock()
+{
+	if (mode == ThreadingMode::Unsynchronized)
 	{
-		std::memset(block.data, '\0', block.size);
+		return std::unique_lock<std::mutex> { };
+	}
+
+	return std::unique_lock<std::mutex> { mutex };
+}
+
+std::mutex& Allocator::ThreadCachesMutex()
+{
+	static auto mutex = std::mutex { };
+
+	return mutex;
+}
+
+// The caches are detached from their previous allocator and attached to this one,
+// under the mutex, which exiting threads hold while they flush their caches.
+void Allocator::AdoptThreadCaches(std::vector<std::shared_ptr<ThreadCache>>&& caches)
+{
+	const auto lock = std::lock_guard<std::mutex> { ThreadCachesMutex() };
+
+	for (const auto& cache : threadCaches)
+	{
+		cache->allocator.store(nullptr, std::memory_order_release);
+	}
+
+	threadCaches = std::move(caches);
+
+	for (const auto& cache : threadCaches)
+	{
+		cache->allocator.store(this, std::memory_order_release);
+	}
+}
+
+void Allocator::FlushThreadCache(ThreadCache& cache)
+{
+	const auto lock = Lock();
+
+	for (auto classIndex = size_t { 0 }; classIndex != ThreadCache::ClassCount; ++classIndex)
+	{
+		while (cache.heads[classIndex] != nullptr)
+		{
+			const auto cached = cache.heads[classIndex];
+
+			cache.heads[classIndex] = cached->next;
+
+			FreeBlockHeader(HeaderOf(reinterpret_cast<uint8_t*>(cached)));
+		}
+
+		cache.counts[classIndex] = 0;
+	}
+
+	const auto position = std::find_if(threadCaches.begin(), threadCaches.end(),
+		[&cache](const auto& threadCache) { return threadCache.get() == &cache; });
+
+	if (position != threadCaches.end())
+	{
+		threadCaches.erase(position);
+	}
+}
+
+Allocator::LocalThreadCaches::~LocalThreadCaches()
+{
+	const auto lock = std::lock_guard<std::mutex> { ThreadCachesMutex() };
+
+	for (const auto& [cacheId, cache] : entries)
+	{
+		if (const auto allocator = cache->allocator.load(std::memory_order_acquire); allocator != nullptr)
+		{
+			allocator->FlushThreadCache(*cache);
+		}
+	}
+}
+
+// Each thread finds its cache by the id of the allocator, which is never reused,
+// so that entries of destroyed allocators are never matched again.
+// They are dropped, when the thread misses its cache, before adding a new entry.
+Allocator::ThreadCache& Allocator::LocalThreadCache()
+{
+	thread_local auto localCaches = LocalThreadCaches { };
+
+	for (const auto& [cacheId, cache] : localCaches.entries)
+	{
+		if (cacheId == id)
+		{
+			return *cache;
+		}
+	}
+
+	std::erase_if(localCaches.entries, [](const auto& entry)
+	{
+		return entry.second->allocator.load(std::memory_order_acquire) == nullptr;
+	});
+
+	auto cache = std::make_shared<ThreadCache>();
+	cache->allocator.store(this, std::memory_order_release);
+
+	{
+		const auto lock = Lock();
+
+		threadCaches.push_back(cache);
+	}
+
+	localCaches.entries.emplace_back(id, cache);
+
+	return *cache;
+}
+
+Block Allocator::AllocUntimed(const size_t size, const size_t alignment)
+{
+	// a request larger than the pool cannot be satisfied,
+	// and rejecting it keeps the block size from wrapping around
+	if (size > pool.size)
+	{
+		return Block { nullptr, 0 };
+	}
+
+	const auto blockSize = BlockSizeFor(size);
+
+	if (mode == ThreadingMode::ThreadCached && alignment <= Alignment && blockSize <= ThreadCache::BlockSizeLimit)
+	{
+		auto& cache = LocalThreadCache();
+		auto& head = cache.heads[blockSize / Alignment];
+
+		if (head == nullptr)
+		{
+			// refill the cache with a batch of blocks under a single lock,
+			// blocks larger than requested are cached by their actual size
+			const auto lock = Lock();
+
+			for (auto count = size_t { 0 }; count != ThreadCache::RefillCount; ++count)
+			{
+				const auto block = AllocateBlock(blockSize, Alignment);
+
+				if (block == nullptr)
+				{
+					break;
+				}
+
+				// an unsplit block may exceed the largest cached class,
+				// thus it goes back to the heap and the refill stops
+				if (SizeOf(block) > ThreadCache::BlockSizeLimit)
+				{
+					FreeBlockHeader(block);
+					break;
+				}
+
+				const auto classIndex = SizeOf(block) / Alignment;
+				const auto cached = reinterpret_cast<ThreadCache::CachedBlock*>(PayloadOf(block));
+
+				cached->next = cache.heads[classIndex];
+				cache.heads[classIndex] = cached;
+				cache.counts[classIndex] += 1;
+			}
+		}
+
+		// a block of the requested class is missing, when the last refill
+		// has only found larger blocks, thus they are taken from the heap
+		if (head != nullptr)
+		{
+			const auto cached = head;
+
+			head = cached->next;
+			cache.counts[blockSize / Alignment] -= 1;
+
+			return Block { reinterpret_cast<uint8_t*>(cached), size };
+		}
+	}
+
+	const auto lock = Lock();
+
+	const auto block = AllocateBlock(blockSize, alignment);
+
+	if (block == nullptr)
+	{
+		return Block { nullptr, 0 };
+	}
+
+	return Block { PayloadOf(block), size };
+}
+
+void Allocator::FreeUntimed(const Block block)
+{
+	const auto header = HeaderOf(block.data);
+
+	assert(block.size <= SizeOf(header) - HeaderSize);
+
+	if (mode == ThreadingMode::ThreadCached && SizeOf(header) <= ThreadCache::BlockSizeLimit)
+	{
+		auto& cache = LocalThreadCache();
+
+		const auto classIndex = SizeOf(header) / Alignment;
+
+		if (cache.counts[classIndex] < ThreadCache::Capacity)
+		{
+			const auto cached = reinterpret_cast<ThreadCache::CachedBlock*>(block.data);
+
+			cached->next = cache.heads[classIndex];
+			cache.heads[classIndex] = cached;
+			cache.counts[classIndex] += 1;
+
+			return;
+		}
+	}
+
+	const auto lock = Lock();
+
+	FreeBlockHeader(header);
+}
+
+Block Allocator::Alloc(const size_t size, const size_t alignment)
+{
+	assert(std::has_single_bit(alignment));
+
+	if (telemetry == nullptr)
+	{
+		return AllocUntimed(size, alignment);
+	}
+
+	const auto start = std::chrono::steady_clock::now();
+	const auto block = AllocUntimed(size, alignment);
+	const auto stop = std::chrono::steady_clock::now();
+
+	telemetry->allocLatency.Record(static_cast<uint64_t>((stop - start) / std::chrono::nanoseconds { 1 }));
+
+	if (block.data == nullptr)
+	{
+		telemetry->failedAllocationCount.fetch_add(1, std::memory_order_relaxed);
+
+		return block;
+	}
+
+	telemetry->allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+	const auto bytesInUse = telemetry->bytesInUse.fetch_add(size, std::memory_order_relaxed) + size;
+	auto peakBytesInUse = telemetry->peakBytesInUse.load(std::memory_order_relaxed);
+
+	while (bytesInUse > peakBytesInUse &&
+		!telemetry->peakBytesInUse.compare_exchange_weak(peakBytesInUse, bytesInUse, std::memory_order_relaxed))
+	{
+	}
+
+	return block;
+}
+
+void Allocator::Free(const Block block)
+{
+	if (block.data == nullptr)
+	{
+		return;
+	}
+
+	if (telemetry == nullptr)
+	{
+		FreeUntimed(block);
+
+		return;
+	}
+
+	const auto start = std::chrono::steady_clock::now();
+	FreeUntimed(block);
+	const auto stop = std::chrono::steady_clock::now();
+
+	telemetry->freeLatency.Record(static_cast<uint64_t>((stop - start) / std::chrono::nanoseconds { 1 }));
+	telemetry->freeCount.fetch_add(1, std::memory_order_relaxed);
+	telemetry->bytesInUse.fetch_sub(block.size, std::memory_order_relaxed);
+}
+
+void Allocator::EnableStatistics()
+{
+	if (telemetry == nullptr)
+	{
+		telemetry = std::make_unique<Telemetry>();
+	}
+}
+
+AllocatorStatistics Allocator::Statistics()
+{
+	auto statistics = AllocatorStatistics { };
+
+	if (telemetry != nullptr)
+	{
+		statistics.bytesInUse = telemetry->bytesInUse.load(std::memory_order_relaxed);
+		statistics.peakBytesInUse = telemetry->peakBytesInUse.load(std::memory_order_relaxed);
+		statistics.allocationCount = telemetry->allocationCount.load(std::memory_order_relaxed);
+		statistics.freeCount = telemetry->freeCount.load(std::memory_order_relaxed);
+		statistics.failedAllocationCount = telemetry->failedAllocationCount.load(std::memory_order_relaxed);
+		statistics.allocLatency = telemetry->allocLatency.Percentiles();
+		statistics.freeLatency = telemetry->freeLatency.Percentiles();
+	}
+
+	const auto lock = Lock();
+
+	for (const auto& list : freeLists)
+	{
+		for (const auto head : list)
+		{
+			for (auto block = head; block != nullptr; block = block->nextFree)
+			{
+				const auto size = SizeOf(block);
+
+				statistics.freeBlockCount += 1;
+				statistics.freeBytes += size;
+				statistics.largestFreeBlock = std::max(statistics.largestFreeBlock, size);
+				statistics.freeBlockHistogram[static_cast<size_t>(std::bit_width(size)) - 1] += 1;
+			}
+		}
+	}
+
+	if (statistics.freeBytes != 0)
+	{
+		statistics.externalFragmentation =
+			1.0 - static_cast<double>(statistics.largestFreeBlock) / static_cast<double>(statistics.freeBytes);
+	}
+
+	return statistics;
+}
+
+// Every line of the heap map describes a single block, in the order of addresses,
+// by its offset from the beginning of the pool, its size and its state.
+bool Allocator::DumpHeapMap(const char* const path)
+{
+	auto file = std::ofstream { path };
+
+	if (!file)
+	{
+		return false;
+	}
+
+	const auto lock = Lock();
+
+	file << "# offset size state\n";
+
+	if (pool.data == nullptr || pool.size < MinimumBlockSize + HeaderSize)
+	{
+		return static_cast<bool>(file);
+	}
+
+	// the sentinel closing the pool is the only block of zero size
+	for (auto block = reinterpret_cast<BlockHeader*>(pool.data); SizeOf(block) != 0; block = NextPhysical(block))
+	{
+		file << (reinterpret_cast<uint8_t*>(block) - pool.data) << ' '
+		     << SizeOf(block) << ' '
+		     << (IsFree(block) ? "free" : "used") << '\n';
+	}
+
+	return static_cast<bool>(file);
+}
+
+// A trace holds a single operation per line, where "a <id> <size> [alignment]"
+// allocates a block and "f <id>" frees the block allocated under the same id.
+// Lines starting with '#' are comments.
+struct TraceOperation
+{
+	bool   alloc;
+	size_t slot;
+	size_t size;
+	size_t alignment;
+};
+
+bool LoadTrace(const char* const path, std::vector<TraceOperation>& operations, size_t& slotCount)
+{
+	auto file = std::ifstream { path };
+
+	if (!file)
+	{
+		return false;
+	}
+
+	auto slots = std::unordered_map<uint64_t, size_t> { };
+	auto line = std::string { };
+
+	while (std::getline(file, line))
+	{
+		if (line.empty() || line[0] == '#')
+		{
+			continue;
+		}
+
+		auto stream = std::istringstream { line };
+		auto kind = char { };
+		auto id = uint64_t { };
+
+		if (!(stream >> kind >> id))
+		{
+			return false;
+		}
+
+		if (kind == 'a')
+		{
+			auto operation = TraceOperation { true, slots.size(), 0, 16 };
+
+			if (!(stream >> operation.size))
+			{
+				return false;
+			}
+
+			// the alignment is optional, but when present it has to be a power of two,
+			// since replaying the trace passes it on to the allocators as is
+			if (auto alignment = size_t { }; stream >> alignment)
+			{
+				if (!std::has_single_bit(alignment))
+				{
+					return false;
+				}
+
+				operation.alignment = alignment;
+			}
+			else if (!stream.eof())
+			{
+				return false;
+			}
+
+			slots[id] = operation.slot;
+			operations.push_back(operation);
+		}
+		else if (kind == 'f')
+		{
+			const auto slot = slots.find(id);
+
+			if (slot == slots.end())
+			{
+				return false;
+			}
+
+			operations.push_back(TraceOperation { false, slot->second, 0, 0 });
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	slotCount = slots.size();
+
+	return true;
+}
+
+// Replays the trace, leaving blocks, which the trace never frees, allocated,
+// and returns the average latency of a single operation in nanoseconds.
+template <typename AllocFunction, typename FreeFunction>
+double ReplayTrace(const std::vector<TraceOperation>& operations, std::vector<Block>& blocks,
+	AllocFunction alloc, FreeFunction free)
+{
+	const auto start = std::chrono::steady_clock::now();
+
+	for (const auto& operation : operations)
+	{
+		if (operation.alloc)
+		{
+			blocks[operation.slot] = alloc(operation.size, operation.alignment);
+		}
+		else if (blocks[operation.slot].data != nullptr)
+		{
+			free(blocks[operation.slot]);
+			blocks[operation.slot] = Block { nullptr, 0 };
+		}
+	}
+
+	const auto stop = std::chrono::steady_clock::now();
+
+	return static_cast<double>((stop - start) / std::chrono::nanoseconds { 1 })
+	     / static_cast<double>(std::max<size_t>(operations.size(), 1));
+}
+
+void PrintLatency(const char* const name, const LatencyPercentiles& latency)
+{
+	std::printf("%s latency [ns]: p50 %llu, p90 %llu, p99 %llu, p99.9 %llu, max %llu\n", name,
+		static_cast<unsigned long long>(latency.p50), static_cast<unsigned long long>(latency.p90),
+		static_cast<unsigned long long>(latency.p99), static_cast<unsigned long long>(latency.p999),
+		static_cast<unsigned long long>(latency.max));
+}
+
+// usage: allocator <trace> [pool size] [heap map]
+int Replay(const char* const tracePath, const size_t poolSize, const char* const heapMapPath)
+{
+	auto operations = std::vector<TraceOperation> { };
+	auto slotCount = size_t { 0 };
+
+	if (!LoadTrace(tracePath, operations, slotCount))
+	{
+		std::fprintf(stderr, "failed to load trace: %s\n", tracePath);
+		return 1;
+	}
+
+	auto blocks = std::vector<Block> (slotCount, Block { nullptr, 0 });
+
+	const auto mallocLatency = ReplayTrace(operations, blocks,
+		[](const size_t size, const size_t alignment)
+		{
+			const auto data = (alignment <= alignof(std::max_align_t))
+				? std::malloc(size)
+				: std::aligned_alloc(alignment, (size + alignment - 1) & ~(alignment - 1));
+
+			return Block { static_cast<uint8_t*>(data), size };
+		},
+		[](const Block block) { std::free(block.data); });
+
+	for (auto& block : blocks)
+	{
+		std::free(block.data);
+		block = Block { nullptr, 0 };
+	}
+
+	std::printf("malloc: %.1f ns per operation\n", mallocLatency);
+
+	for (const auto mode : { ThreadingMode::Unsynchronized, ThreadingMode::Synchronized, ThreadingMode::ThreadCached })
+	{
+		auto allocator = Allocator { poolSize, mode };
+
+		const auto latency = ReplayTrace(operations, blocks,
+			[&allocator](const size_t size, const size_t alignment) { return allocator.Alloc(size, alignment); },
+			[&allocator](const Block block) { allocator.Free(block); });
+
+		std::fill(blocks.begin(), blocks.end(), Block { nullptr, 0 });
+
+		const auto name = (mode == ThreadingMode::Unsynchronized) ? "unsynchronized"
+		                : (mode == ThreadingMode::Synchronized) ? "synchronized" : "thread cached";
+
+		std::printf("Allocator (%s): %.1f ns per operation\n", name, latency);
+	}
+
+	auto allocator = Allocator { poolSize };
+	allocator.EnableStatistics();
+
+	ReplayTrace(operations, blocks,
+		[&allocator](const size_t size, const size_t alignment) { return allocator.Alloc(size, alignment); },
+		[&allocator](const Block block) { allocator.Free(block); });
+
+	const auto statistics = allocator.Statistics();
+
+	std::printf("bytes in use: %zu, peak: %zu\n", statistics.bytesInUse, statistics.peakBytesInUse);
+	std::printf("allocations: %zu, frees: %zu, failed allocations: %zu\n",
+		statistics.allocationCount, statistics.freeCount, statistics.failedAllocationCount);
+	std::printf("free blocks: %zu, free bytes: %zu, largest free block: %zu, external fragmentation: %.3f\n",
+		statistics.freeBlockCount, statistics.freeBytes, statistics.largestFreeBlock, statistics.externalFragmentation);
+
+	for (auto bucket = size_t { 0 }; bucket != statistics.freeBlockHistogram.size(); ++bucket)
+	{
+		if (statistics.freeBlockHistogram[bucket] != 0)
+		{
+			std::printf("  free blocks of [2^%zu, 2^%zu) bytes: %zu\n", bucket, bucket + 1, statistics.freeBlockHistogram[bucket]);
+		}
+	}
+
+	PrintLatency("alloc", statistics.allocLatency);
+	PrintLatency("free", statistics.freeLatency);
+
+	if (heapMapPath != nullptr && !allocator.DumpHeapMap(heapMapPath))
+	{
+		std::fprintf(stderr, "failed to dump heap map: %s\n", heapMapPath);
+		return 1;
+	}
+
+	return 0;
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc > 1)
+	{
+		const auto poolSize = (argc > 2) ? static_cast<size_t>(std::strtoull(argv[2], nullptr, 10)) : size_t { 64 } << 20;
+		const auto heapMapPath = (argc > 3) ? argv[3] : nullptr;
+
+		return Replay(argv[1], poolSize, heapMapPath);
+	}
+
+	{
+		auto allocator = Allocator { 128 };
+
+		const auto block = allocator.Alloc(32);
+		{
+			std::memset(block.data, '\0', block.size);
+		}
+		allocator.Free(block);
+
+		// freeing all blocks coalesces the pool back into a single block
+		const auto whole = allocator.Alloc(128 - 2 * 16);
+		assert(whole.data != nullptr);
+		allocator.Free(whole);
+	}
+
+	{
+		auto allocator = Allocator { 64 * 1024 };
+		allocator.EnableStatistics();
+
+		auto blocks = std::vector<Block> { };
+
+		for (auto size = size_t { 1 }; size < 200; size += 7)
+		{
+			const auto alignment = size_t { 1 } << (size % 8);
+			const auto block = allocator.Alloc(size, alignment);
+
+			assert(block.data != nullptr);
+			assert(reinterpret_cast<uintptr_t>(block.data) % alignment == 0);
+
+			std::memset(block.data, static_cast<int>(size), block.size);
+			blocks.push_back(block);
+		}
+
+		for (auto index = size_t { 0 }; index < blocks.size(); index += 2)
+		{
+			allocator.Free(blocks[index]);
+		}
+
+		// freeing every other block leaves holes, which fragment free memory
+		const auto fragmented = allocator.Statistics();
+		assert(fragmented.freeBlockCount > 1);
+		assert(fragmented.externalFragmentation > 0.0);
+
+		for (auto index = size_t { 1 }; index < blocks.size(); index += 2)
+		{
+			allocator.Free(blocks[index]);
+		}
+
+		const auto coalesced = allocator.Statistics();
+		assert(coalesced.freeBlockCount == 1);
+		assert(coalesced.externalFragmentation == 0.0);
+		assert(coalesced.bytesInUse == 0);
+		assert(coalesced.peakBytesInUse > 0);
+		assert(coalesced.allocationCount == coalesced.freeCount);
+
+		const auto whole = allocator.Alloc(60 * 1024);
+		assert(whole.data != nullptr);
+		allocator.Free(whole);
+	}
+
+	{
+		const auto path = (std::filesystem::temp_directory_path() / "allocator-trace-test").string();
+
+		const auto loads = [&path](const char* const trace)
+		{
+			std::ofstream { path } << trace;
+
+			auto operations = std::vector<TraceOperation> { };
+			auto slotCount = size_t { 0 };
+
+			return LoadTrace(path.c_str(), operations, slotCount);
+		};
+
+		assert(loads("a 1 32\na 2 32 64\nf 1\nf 2\n"));
+		assert(!loads("a 1 32 0\n"));
+		assert(!loads("a 1 32 48\n"));
+		assert(!loads("a 1 32 x\n"));
+
+		std::filesystem::remove(path);
+	}
+
+	{
+		auto allocator = Allocator { 1024 };
+
+		// sizes close to the maximum must not wrap around, when the header is added
+		assert(allocator.Alloc(std::numeric_limits<size_t>::max() - 4).data == nullptr);
+		assert(allocator.Alloc(64, size_t { 1 } << (std::numeric_limits<size_t>::digits - 1)).data == nullptr);
+
+		const auto block = allocator.Alloc(64, 256);
+		assert(block.data != nullptr);
+		allocator.Free(block);
+	}
+
+	{
+		auto allocator = Allocator { 2048, ThreadingMode::ThreadCached };
+
+		// refilling the cache may find an unsplit block larger than any cached class
+		const auto first = allocator.Alloc(512);
+		const auto second = allocator.Alloc(1024);
+		allocator.Free(first);
+
+		const auto third = allocator.Alloc(496);
+		assert(third.data != nullptr);
+		std::memset(third.data, '\0', third.size);
+
+		allocator.Free(third);
+		allocator.Free(second);
+	}
+
+	{
+		auto allocator = Allocator { 4096, ThreadingMode::ThreadCached };
+
+		// exiting threads return their cached blocks, so that threads coming and going
+		// never run a small pool dry, although every thread refills a whole batch
+		for (auto thread = 0; thread != 64; ++thread)
+		{
+			std::thread { [&allocator]()
+			{
+				const auto block = allocator.Alloc(64);
+
+				assert(block.data != nullptr);
+				std::memset(block.data, '\0', block.size);
+
+				allocator.Free(block);
+			} }.join();
+		}
+
+		const auto whole = allocator.Alloc(4096 - 2 * 16);
+		assert(whole.data != nullptr);
+		allocator.Free(whole);
+	}
+
+	{
+		auto allocator = Allocator { 1024 * 1024, ThreadingMode::ThreadCached };
+
+		auto threads = std::vector<std::thread> { };
+
+		for (auto thread = 0; thread != 4; ++thread)
+		{
+			threads.emplace_back([&allocator, thread]()
+			{
+				for (auto round = 0; round != 1000; ++round)
+				{
+					const auto size = static_cast<size_t>(16 + (round * 7 + thread) % 400);
+					const auto block = allocator.Alloc(size);
+
+					assert(block.data != nullptr);
+					std::memset(block.data, thread, block.size);
+
+					allocator.Free(block);
+				}
+			});
+		}
+
+		for (auto& thread : threads)
+		{
+			thread.join();
+		}
 	}
-	allocator.Free(block);
 
 	return 0;
 }
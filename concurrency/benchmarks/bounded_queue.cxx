@@ -0,0 +1,103 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <cxx/bounded_queue.hxx>
+
+#include <cxx/concurrent_queue.hxx>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#include <memory>
+
+#include <vector>
+
+#include <thread>
+
+
+namespace
+{
+    // note: Every iteration transfers a fixed number of values
+    //       through a single queue, between state.range(0) pairs
+    //       of producer and consumer threads.
+    //
+    template <typename queue_type>
+    auto hand_off (benchmark::State& state) -> void
+    {
+        constexpr auto values_per_producer = std::int64_t { 1 << 14 };
+
+        const auto pair_count = state.range(0);
+
+        for (auto _ : state)
+        {
+            auto queue = std::make_unique<queue_type>();
+
+            auto threads = std::vector<std::jthread> { };
+
+            threads.reserve(2 * pair_count);
+
+            for (auto pair = std::int64_t { 0 }; pair != pair_count; ++pair)
+            {
+                threads.emplace_back([&queue] () -> void
+                {
+                    for (auto value = std::int64_t { 0 };
+                              value != values_per_producer; ++value)
+                    {
+                        queue->push(value);
+                    }
+                });
+
+                threads.emplace_back([&queue] () -> void
+                {
+                    for (auto value = std::int64_t { 0 };
+                              value != values_per_producer; ++value)
+                    {
+                        benchmark::DoNotOptimize(queue->pop());
+                    }
+                });
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * pair_count * values_per_producer);
+    }
+}
+
+
+BENCHMARK_TEMPLATE(hand_off, cxx::concurrent_queue<std::int64_t>)
+    ->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+
+BENCHMARK_TEMPLATE(hand_off, cxx::bounded_queue<std::int64_t, 1024>)
+    ->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
@@ -0,0 +1,123 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <cxx/spin_mutex.hxx>
+
+#include <cxx/ticket_mutex.hxx>
+
+#include <cxx/mcs_mutex.hxx>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+
+#include <cstdint>
+
+#include <vector>
+
+#include <chrono>
+
+#include <mutex>
+
+#include <thread>
+
+
+namespace
+{
+    // note: All of the benchmark threads repeatedly lock the same mutex,
+    //       which guards a short critical section.
+    //
+    //       Besides the throughput (items_per_second),
+    //       the median and the 99th percentile of the time spent
+    //       waiting to lock the mutex are reported,
+    //       as averages of per thread percentiles,
+    //       because fair locks trade throughput for lower tail latency.
+    //
+    template <typename mutex_type>
+    auto contended_lock (benchmark::State& state) -> void
+    {
+        static auto mutex   = mutex_type   { };
+        static auto counter = std::int64_t { 0 };
+
+        using clock = std::chrono::steady_clock;
+
+        auto latencies = std::vector<std::int64_t> { };
+
+        for (auto _ : state)
+        {
+            const auto start = clock::now();
+
+            mutex.lock();
+
+            const auto acquired = clock::now();
+            {
+                counter += 1;
+
+                benchmark::DoNotOptimize(counter);
+            }
+            mutex.unlock();
+
+            latencies.push_back((acquired - start) / std::chrono::nanoseconds { 1 });
+        }
+
+        const auto percentile = [&latencies] (const std::size_t percent) -> double
+        {
+            const auto nth = latencies.begin() + (latencies.size() - 1) * percent / 100;
+
+            std::nth_element(latencies.begin(), nth, latencies.end());
+
+            return double(*nth);
+        };
+
+        if (!latencies.empty())
+        {
+            state.counters["p50_ns"] = benchmark::Counter { percentile(50), benchmark::Counter::kAvgThreads };
+            state.counters["p99_ns"] = benchmark::Counter { percentile(99), benchmark::Counter::kAvgThreads };
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    const auto max_threads = int(std::max(1u, std::thread::hardware_concurrency()));
+}
+
+
+BENCHMARK_TEMPLATE(contended_lock, std::mutex)->ThreadRange(1, max_threads)->UseRealTime();
+
+BENCHMARK_TEMPLATE(contended_lock, cxx::spin_mutex)->ThreadRange(1, max_threads)->UseRealTime();
+
+BENCHMARK_TEMPLATE(contended_lock, cxx::ticket_mutex)->ThreadRange(1, max_threads)->UseRealTime();
+
+BENCHMARK_TEMPLATE(contended_lock, cxx::mcs_mutex)->ThreadRange(1, max_threads)->UseRealTime();
@@ -0,0 +1,227 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <cxx/parallel.hxx>
+
+#include <cxx/thread_pool.hxx>
+
+#include <benchmark/benchmark.h>
+
+#include <execution>
+
+#include <functional>
+
+#include <algorithm>
+
+#include <numeric>
+
+#include <cstdint>
+
+#include <random>
+
+#include <vector>
+
+
+namespace
+{
+    auto generate_values (const std::int64_t count) -> std::vector<double>
+    {
+        auto random_engine = std::minstd_rand { 7 };
+        auto distribution  = std::uniform_real_distribution<double> { 0.0, 1.0 };
+
+        auto values = std::vector<double>(count);
+
+        std::ranges::generate(values, [&] { return distribution(random_engine); });
+
+        return values;
+    }
+
+    const auto square = [] (const double value) noexcept -> double
+                        {
+                            return value * value;
+                        };
+
+
+    auto std_for_each (benchmark::State& state) -> void
+    {
+        auto values = generate_values(state.range(0));
+
+        for (auto _ : state)
+        {
+            std::for_each(std::execution::par, values.begin(), values.end(),
+                          [] (double& value) noexcept { value = value * 0.5 + 0.25; });
+
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    auto cxx_for_each (benchmark::State& state) -> void
+    {
+        auto thread_pool = cxx::thread_pool { };
+
+        auto values = generate_values(state.range(0));
+
+        for (auto _ : state)
+        {
+            cxx::parallel::for_each(thread_pool, values,
+                                    [] (double& value) noexcept { value = value * 0.5 + 0.25; });
+
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+
+    auto std_transform_reduce (benchmark::State& state) -> void
+    {
+        const auto values = generate_values(state.range(0));
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(
+                std::transform_reduce(std::execution::par, values.begin(), values.end(),
+                                      0.0, std::plus { }, square));
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    auto cxx_transform_reduce (benchmark::State& state) -> void
+    {
+        auto thread_pool = cxx::thread_pool { };
+
+        const auto values = generate_values(state.range(0));
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(
+                cxx::parallel::transform_reduce(thread_pool, values,
+                                                0.0, std::plus { }, square));
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+
+    auto std_inclusive_scan (benchmark::State& state) -> void
+    {
+        const auto values = generate_values(state.range(0));
+
+        auto output = std::vector<double>(values.size());
+
+        for (auto _ : state)
+        {
+            std::inclusive_scan(std::execution::par, values.begin(), values.end(),
+                                output.begin());
+
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    auto cxx_inclusive_scan (benchmark::State& state) -> void
+    {
+        auto thread_pool = cxx::thread_pool { };
+
+        const auto values = generate_values(state.range(0));
+
+        auto output = std::vector<double>(values.size());
+
+        for (auto _ : state)
+        {
+            cxx::parallel::inclusive_scan(thread_pool, values, output.begin());
+
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+
+    auto std_sort (benchmark::State& state) -> void
+    {
+        const auto values = generate_values(state.range(0));
+
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            auto sorted = values;
+            state.ResumeTiming();
+
+            std::sort(std::execution::par, sorted.begin(), sorted.end());
+
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    auto cxx_sort (benchmark::State& state) -> void
+    {
+        auto thread_pool = cxx::thread_pool { };
+
+        const auto values = generate_values(state.range(0));
+
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            auto sorted = values;
+            state.ResumeTiming();
+
+            cxx::parallel::sort(thread_pool, sorted);
+
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+}
+
+
+BENCHMARK(std_for_each)        ->RangeMultiplier(32)->Range(1 << 10, 1 << 20)->UseRealTime();
+BENCHMARK(cxx_for_each)        ->RangeMultiplier(32)->Range(1 << 10, 1 << 20)->UseRealTime();
+
+BENCHMARK(std_transform_reduce)->RangeMultiplier(32)->Range(1 << 10, 1 << 20)->UseRealTime();
+BENCHMARK(cxx_transform_reduce)->RangeMultiplier(32)->Range(1 << 10, 1 << 20)->UseRealTime();
+
+BENCHMARK(std_inclusive_scan)  ->RangeMultiplier(32)->Range(1 << 10, 1 << 20)->UseRealTime();
+BENCHMARK(cxx_inclusive_scan)  ->RangeMultiplier(32)->Range(1 << 10, 1 << 20)->UseRealTime();
+
+BENCHMARK(std_sort)            ->RangeMultiplier(32)->Range(1 << 10, 1 << 20)->UseRealTime();
+BENCHMARK(cxx_sort)            ->RangeMultiplier(32)->Range(1 << 10, 1 << 20)->UseRealTime();
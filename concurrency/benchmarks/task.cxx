@@ -0,0 +1,169 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <cxx/task.hxx>
+
+#include <cxx/thread_pool.hxx>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#include <atomic>
+
+#include <functional>
+
+
+namespace
+{
+    // note: Each benchmark iteration performs a fixed number of switches,
+    //       so that the stack of unoptimized builds, where GCC
+    //       does not turn symmetric transfer into a tail call,
+    //       remains bounded.
+    //
+    constexpr auto switch_count = std::int64_t { 1'000 };
+
+    auto identity (const std::int64_t value) -> cxx::task<std::int64_t>
+    {
+        co_return value;
+    }
+
+    auto await_tasks () -> cxx::task<std::int64_t>
+    {
+        auto sum = std::int64_t { 0 };
+
+        for (auto n = std::int64_t { 0 }; n != switch_count; ++n)
+        {
+            sum += co_await identity(n);
+        }
+
+        co_return sum;
+    }
+
+    auto hop_onto (cxx::thread_pool& thread_pool) -> cxx::task<>
+    {
+        for (auto n = std::int64_t { 0 }; n != switch_count; ++n)
+        {
+            co_await cxx::schedule(thread_pool);
+        }
+    }
+
+    // note: A coroutine awaiting a task, which completes synchronously,
+    //       switches to the coroutine of the task and back,
+    //       without involving any executor.
+    //
+    //       The frame of every task is allocated and freed,
+    //       which, after warming up, is always served
+    //       by the coroutine_frame_pool of the benchmark thread.
+    //
+    auto await_task (benchmark::State& state) -> void
+    {
+        const auto& pool  = cxx::coroutine_frame_pool::this_thread();
+
+        const auto before = pool.stats();
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(cxx::sync_wait(await_tasks()));
+        }
+
+        const auto after  = pool.stats();
+
+        const auto allocations = double(after.allocations - before.allocations);
+
+        state.counters["frame_bytes"] = double(after.allocated_bytes - before.allocated_bytes)
+                                      / allocations;
+        state.counters["reuse_rate" ] = double(after.reused_frames   - before.reused_frames)
+                                      / allocations;
+
+        state.SetItemsProcessed(state.iterations() * switch_count);
+    }
+
+    // note: Every co_await cxx::schedule(thread_pool) submits
+    //       the continuation of the coroutine to the thread_pool,
+    //       which is compared below with a chain of std::functions,
+    //       each of which submits the next one.
+    //
+    auto schedule_coroutine (benchmark::State& state) -> void
+    {
+        auto thread_pool = cxx::thread_pool { 1 };
+
+        for (auto _ : state)
+        {
+            cxx::sync_wait(hop_onto(thread_pool));
+        }
+
+        state.SetItemsProcessed(state.iterations() * switch_count);
+    }
+
+    auto submit_function (benchmark::State& state) -> void
+    {
+        auto thread_pool = cxx::thread_pool { 1 };
+
+        for (auto _ : state)
+        {
+            auto remaining = switch_count;
+            auto completed = std::atomic_flag { };
+
+            auto next = std::function<auto () -> void> { };
+
+            next = [&] () -> void
+            {
+                if (--remaining != 0)
+                {
+                    thread_pool.submit(next);
+                }
+                else
+                {
+                    completed.test_and_set();
+                    completed.notify_one();
+                }
+            };
+
+            thread_pool.submit(next);
+
+            completed.wait(false);
+        }
+
+        state.SetItemsProcessed(state.iterations() * switch_count);
+    }
+}
+
+
+BENCHMARK(await_task);
+
+BENCHMARK(schedule_coroutine)->UseRealTime();
+
+BENCHMARK(submit_function)->UseRealTime();
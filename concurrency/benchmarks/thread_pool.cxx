@@ -0,0 +1,116 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <cxx/thread_pool.hxx>
+
+#include <cxx/latch.hxx>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#include <vector>
+
+#include <functional>
+
+
+namespace
+{
+    constexpr auto task_count = std::int64_t { 10'000 };
+
+    auto submit_one_by_one (benchmark::State& state) -> void
+    {
+        auto thread_pool = cxx::thread_pool { };
+
+        for (auto _ : state)
+        {
+            auto latch = cxx::latch { task_count };
+
+            for (auto n = std::int64_t { 0 }; n != task_count; ++n)
+            {
+                thread_pool.submit([&latch] () noexcept -> void
+                                   {
+                                       latch.arrive();
+                                   });
+            }
+
+            latch.wait();
+        }
+
+        state.SetItemsProcessed(state.iterations() * task_count);
+    }
+
+    auto submit_in_bulks (benchmark::State& state) -> void
+    {
+        const auto bulk_size = state.range(0);
+
+        auto thread_pool = cxx::thread_pool { };
+
+        for (auto _ : state)
+        {
+            auto latch = cxx::latch { task_count };
+
+            auto tasks = std::vector<std::function<auto () -> void>> { };
+
+            tasks.reserve(bulk_size);
+
+            for (auto n = std::int64_t { 0 }; n != task_count; ++n)
+            {
+                tasks.emplace_back([&latch] () noexcept -> void
+                                   {
+                                       latch.arrive();
+                                   });
+
+                if (std::ssize(tasks) == bulk_size)
+                {
+                    thread_pool.submit_bulk(tasks);
+
+                    tasks.clear();
+                }
+            }
+
+            thread_pool.submit_bulk(tasks);
+
+            latch.wait();
+        }
+
+        state.SetItemsProcessed(state.iterations() * task_count);
+    }
+}
+
+
+BENCHMARK(submit_one_by_one)->UseRealTime();
+
+BENCHMARK(submit_in_bulks)->RangeMultiplier(8)->Range(8, 8 << 9)->UseRealTime();
@@ -0,0 +1,387 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef CXX_BOUNDED_QUEUE
+#define CXX_BOUNDED_QUEUE
+
+
+#include <cxx/concurrent_queue.hxx>
+
+#include <cxx/cache_line.hxx>
+
+#include <type_traits>
+
+#include <cstddef>
+
+#include <cstdint>
+
+#include <utility>
+
+#include <new>
+
+#include <atomic>
+
+#include <array>
+
+#include <optional>
+
+#include <bit>
+
+
+namespace cxx
+{
+    // [1024cores] - Dmitry Vyukov: Bounded MPMC queue
+    // ~ https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+    //
+    // [GitHub] - Erik Rigtorp: MPMCQueue
+    // ~ https://github.com/rigtorp/MPMCQueue
+    //
+    // [GitHub] - Facebook: Folly MPMCQueue
+    // ~ https://github.com/facebook/folly/blob/main/folly/MPMCQueue.h
+
+
+    // note: The cxx::bounded_queue<> provides the same interface,
+    //       as the cxx::concurrent_queue<>, but instead of a std::deque<>
+    //       protected by a std::mutex, it stores values in a ring of slots,
+    //       which is allocated once, together with the queue object itself.
+    //
+    //       Every slot holds a sequence number, which is used by
+    //       producers and consumers to claim that slot, without locking:
+    //
+    //       - sequence == position                -> slot is free,
+    //                                                ready to be written
+    //       - sequence == position + 1            -> slot is full,
+    //                                                ready to be read
+    //       - sequence == position + capacity     -> slot is free,
+    //                                                ready to be written
+    //                                                in the next lap
+    //
+    //       Behaviour of the try_push() and try_pop() differs slightly
+    //       from their cxx::concurrent_queue<> counterparts,
+    //       since they fail only when the queue is full or empty,
+    //       and never due to contention.
+    //
+    //       Unlike the cxx::concurrent_queue<>, which is unbounded,
+    //       the push() may block on a full queue, thus it is woken up
+    //       by the interrupt() as well, and returns false in such case.
+    //
+    template <typename value_type, std::size_t capacity>
+    requires (std::has_single_bit(capacity)) &&
+             (std::is_nothrow_move_constructible_v<value_type>) &&
+             (std::is_nothrow_destructible_v      <value_type>)
+    //
+    class bounded_queue
+    {
+    private:
+        struct alignas(cxx::cache_line_size) slot
+        {
+            std::atomic<std::size_t>                      sequence;
+            alignas(value_type) std::byte storage[sizeof(value_type)];
+
+            auto value () noexcept -> value_type*
+            {
+                return std::launder(reinterpret_cast<value_type*>(storage));
+            }
+        };
+
+        static constexpr auto index_mask = capacity - 1;
+
+        alignas(cxx::cache_line_size) std::atomic<std::size_t>  enqueue_position;
+        alignas(cxx::cache_line_size) std::atomic<std::size_t>  dequeue_position;
+
+        // note: Blocked producers and consumers are parked on epochs,
+        //       instead of sequence numbers of slots,
+        //       so that the interrupt() can wake up all blocked threads,
+        //       without knowing which slots they are waiting for.
+        //
+        //       For the same reason the cxx::atomic_wait() is not used,
+        //       since a blocked thread cannot predict the value of an epoch,
+        //       which will be observed after it has been woken up.
+        //
+        alignas(cxx::cache_line_size) std::atomic<std::uint32_t>       push_epoch;
+                                      std::atomic<bool>            consumers_sleeping;
+        alignas(cxx::cache_line_size) std::atomic<std::uint32_t>        pop_epoch;
+                                      std::atomic<bool>            producers_sleeping;
+                                      std::atomic<bool>                   interrupted;
+
+        std::array<slot, capacity> slots;
+
+        static
+        auto notify (std::atomic<std::uint32_t>& epoch,
+                     std::atomic<bool>&       sleeping) noexcept -> void
+        {
+            // note: The sequentially consistent fence orders
+            //       publication of a slot before the load of the sleeping flag,
+            //       pairing with the store to the sleeping flag,
+            //       performed by a thread before it retries and goes to sleep.
+            //
+            //       Thus, either this thread observes a sleeping thread,
+            //       or that sleeping thread observes the published slot.
+            //
+            //       Clearing the sleeping flag ensures, that threads
+            //       are woken up once per sleep, instead of once per slot,
+            //       while std::atomic::notify_all() is skipped entirely,
+            //       when no thread is sleeping, which is the common case.
+            //
+            std::atomic_thread_fence(std::memory_order::seq_cst);
+
+            if (sleeping.load(std::memory_order::relaxed) &&
+                sleeping.exchange(false, std::memory_order::relaxed))
+            {
+                epoch.fetch_add(1, std::memory_order::release);
+                epoch.notify_all();
+            }
+        }
+
+        template <typename function_type>
+        static
+        auto block (std::atomic<std::uint32_t>& epoch,
+                    std::atomic<bool>&       sleeping,
+                    function_type&&         try_again) noexcept -> void
+        {
+            // note: The epoch is loaded *before* the sleeping flag is set,
+            //       so that a notification, which clears the sleeping flag
+            //       after it has been set, will also change the epoch
+            //       and prevent this thread from going to sleep.
+            //
+            const auto old_epoch = epoch.load(std::memory_order::seq_cst);
+
+            sleeping.store(true, std::memory_order::seq_cst);
+
+            if (!try_again())
+            {
+                epoch.wait(old_epoch, std::memory_order::relaxed);
+            }
+        }
+
+        auto try_emplace (auto&& value) -> bool
+        {
+            auto position = enqueue_position.load(std::memory_order::relaxed);
+
+            while (true)
+            {
+                auto& slot = slots[position & index_mask];
+
+                const auto sequence   = slot.sequence.load(std::memory_order::acquire);
+                const auto difference = static_cast<std::ptrdiff_t>(sequence - position);
+
+                if (difference == 0) // slot is free
+                {
+                    if (enqueue_position.compare_exchange_weak(position, position + 1,
+                                                               std::memory_order::relaxed))
+                    {
+                        ::new (static_cast<void*>(slot.storage))
+                        value_type(std::forward<decltype(value)>(value));
+
+                        slot.sequence.store(position + 1, std::memory_order::release);
+
+                        notify(push_epoch, consumers_sleeping);
+
+                        return true;
+                    }
+                }
+                else if (difference < 0) // queue is full
+                {
+                    return false;
+                }
+                else // another producer has claimed the slot
+                {
+                    position = enqueue_position.load(std::memory_order::relaxed);
+                }
+            }
+        }
+
+    public:
+        bounded_queue () noexcept
+        :
+            enqueue_position   { 0u    },
+            dequeue_position   { 0u    },
+            push_epoch         { 0u    },
+            consumers_sleeping { false },
+            pop_epoch          { 0u    },
+            producers_sleeping { false },
+            interrupted        { false }
+        {
+            for (auto index = std::size_t { 0 }; index != capacity; ++index)
+            {
+                slots[index].sequence.store(index, std::memory_order::relaxed);
+            }
+        }
+
+        ~bounded_queue () noexcept
+        {
+            while (try_pop() != std::nullopt)
+            {
+            }
+        }
+
+        bounded_queue (const bounded_queue&) = delete;
+
+        auto operator = (const bounded_queue&) -> bounded_queue& = delete;
+
+        auto interrupt () -> void
+        {
+            interrupted.store(true, std::memory_order::seq_cst);
+
+            push_epoch.fetch_add(1, std::memory_order::seq_cst);
+            push_epoch.notify_all();
+
+            pop_epoch.fetch_add(1, std::memory_order::seq_cst);
+            pop_epoch.notify_all();
+        }
+
+        auto pop () -> std::optional<value_type>
+        {
+            auto value = try_pop();
+
+            while (value == std::nullopt)
+            {
+                auto stop = false;
+
+                block(push_epoch, consumers_sleeping, [&] () noexcept -> bool
+                {
+                    value = try_pop();
+
+                    stop = interrupted.load(std::memory_order::seq_cst);
+
+                    return (value != std::nullopt) || stop;
+                });
+
+                if (stop)
+                {
+                    break;
+                }
+            }
+
+            return value;
+        }
+
+        auto try_pop () -> std::optional<value_type>
+        {
+            auto position = dequeue_position.load(std::memory_order::relaxed);
+
+            while (true)
+            {
+                auto& slot = slots[position & index_mask];
+
+                const auto sequence   = slot.sequence.load(std::memory_order::acquire);
+                const auto difference = static_cast<std::ptrdiff_t>(sequence - (position + 1));
+
+                if (difference == 0) // slot is full
+                {
+                    if (dequeue_position.compare_exchange_weak(position, position + 1,
+                                                               std::memory_order::relaxed))
+                    {
+                        auto value = std::optional<value_type>
+                                     {
+                                         std::move(*slot.value())
+                                     };
+
+                        slot.value()->~value_type();
+
+                        slot.sequence.store(position + capacity, std::memory_order::release);
+
+                        notify(pop_epoch, producers_sleeping);
+
+                        return value;
+                    }
+                }
+                else if (difference < 0) // queue is empty
+                {
+                    return std::nullopt;
+                }
+                else // another consumer has claimed the slot
+                {
+                    position = dequeue_position.load(std::memory_order::relaxed);
+                }
+            }
+        }
+
+        // note: Returns false, only if the queue has been interrupted,
+        //       while it was full, in which case the value is not pushed.
+        //
+        auto push (cxx::forward_as<value_type> auto&& value) -> bool
+        {
+            if constexpr (std::is_nothrow_constructible_v<value_type, decltype(value)>)
+            {
+                auto pushed = try_emplace(std::forward<decltype(value)>(value));
+
+                while (!pushed)
+                {
+                    auto stop = false;
+
+                    block(pop_epoch, producers_sleeping, [&] () noexcept -> bool
+                    {
+                        pushed = try_emplace(std::forward<decltype(value)>(value));
+
+                        stop = interrupted.load(std::memory_order::seq_cst);
+
+                        return pushed || stop;
+                    });
+
+                    if (stop)
+                    {
+                        break;
+                    }
+                }
+
+                return pushed;
+            }
+            else
+            {
+                // note: A value is copied *before* a slot is claimed,
+                //       since a slot, which has been already claimed,
+                //       must be published, even if copying a value throws.
+                //
+                return push(value_type(std::forward<decltype(value)>(value)));
+            }
+        }
+
+        auto try_push (cxx::forward_as<value_type> auto&& value) -> bool
+        {
+            if constexpr (std::is_nothrow_constructible_v<value_type, decltype(value)>)
+            {
+                return try_emplace(std::forward<decltype(value)>(value));
+            }
+            else
+            {
+                return try_push(value_type(std::forward<decltype(value)>(value)));
+            }
+        }
+    };
+}
+
+
+#endif
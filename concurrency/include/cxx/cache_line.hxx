@@ -0,0 +1,64 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef CXX_CACHE_LINE
+#define CXX_CACHE_LINE
+
+
+#include <cstddef>
+
+
+namespace cxx
+{
+    // [C++ reference] - std::hardware_destructive_interference_size
+    // ~ https://en.cppreference.com/w/cpp/thread/hardware_destructive_interference_size
+    //
+    // [WG21] P0154R1: constexpr std::hardware_{constructive,destructive}_interference_size
+    // ~ http://www.open-std.org/jtc1/sc22/wg21/docs/papers/2016/p0154r1.html
+    //
+    // note: The std::hardware_destructive_interference_size is *not* used,
+    //       because its value depends on the target tuning flags,
+    //       which makes it unsuitable for the layout of types,
+    //       that are shared between differently compiled translation units.
+    //       GCC even warns about such usages (-Winterference-size).
+    //
+    //       All of the x86-64 CPUs and most of the ARMv8 CPUs
+    //       use cache lines which are 64 bytes long.
+    //
+    inline constexpr auto cache_line_size = std::size_t { 64 };
+}
+
+
+#endif
@@ -43,6 +43,8 @@
 
 #include <cxx/tuple.hxx>
 
+#include <cxx/concurrent_queue.hxx>
+
 #include <concepts>
 
 #include <functional>
@@ -51,6 +53,16 @@
 
 #include <atomic>
 
+#include <deque>
+
+#include <mutex>
+
+#include <condition_variable>
+
+#include <optional>
+
+#include <utility>
+
 #include <cassert>
 
 
@@ -379,4 +391,439 @@ namespace cxx::channel // multi-producer single-consumer
 }
 
 
+
+namespace cxx::channel // multi-producer multi-consumer, carrying values
+{
+    namespace detail
+    {
+        // note: The shared_state is reference counted, just like
+        //       the std::atomic<std::ptrdiff_t> shared by the sender and
+        //       the receiver above, and is deleted by the last of
+        //       the value_senders and the value_receivers to be destroyed.
+        //
+        //       In addition, the number of alive value_senders and
+        //       the number of alive value_receivers are guarded by the mutex,
+        //       so that destruction of the last value_sender closes
+        //       the channel, and destruction of the last value_receiver
+        //       makes sending values to the channel fail.
+        //
+        template <typename value_type>
+        class shared_state
+        {
+        private:
+
+            std::atomic<std::ptrdiff_t>  ref_count;
+
+            std::mutex                   mutex;
+            std::condition_variable      not_empty;
+            std::condition_variable      not_full;
+
+            std::deque<value_type>       values;
+            std::ptrdiff_t               capacity;
+
+            std::ptrdiff_t               sender_count;
+            std::ptrdiff_t               receiver_count;
+
+            auto release () noexcept -> void
+            {
+                if (ref_count.fetch_sub(1, std::memory_order::release) == 1)
+                {
+                    std::atomic_thread_fence(std::memory_order::acquire);
+
+                    delete this;
+                }
+            }
+
+            auto is_full () const noexcept -> bool
+            {
+                return std::ssize(values) == capacity;
+            }
+
+        public:
+
+            explicit shared_state (const std::ptrdiff_t capacity)
+            :
+                ref_count      { 2        },
+                mutex          {          },
+                not_empty      {          },
+                not_full       {          },
+                values         {          },
+                capacity       { capacity },
+                sender_count   { 1        },
+                receiver_count { 1        }
+            {
+                cxx_expects(capacity > 0);
+            }
+
+            shared_state (const shared_state&) = delete;
+
+            auto operator = (const shared_state&) -> shared_state& = delete;
+
+
+            auto add_sender () noexcept -> void
+            {
+                ref_count.fetch_add(1, std::memory_order::relaxed);
+
+                auto lock = std::scoped_lock { mutex };
+
+                ++sender_count;
+            }
+
+            auto remove_sender () noexcept -> void
+            {
+                auto closed = false;
+                {
+                    auto lock = std::scoped_lock { mutex };
+
+                    closed = (--sender_count == 0);
+                }
+                if (closed)
+                {
+                    not_empty.notify_all();
+                }
+
+                release();
+            }
+
+            auto add_receiver () noexcept -> void
+            {
+                ref_count.fetch_add(1, std::memory_order::relaxed);
+
+                auto lock = std::scoped_lock { mutex };
+
+                ++receiver_count;
+            }
+
+            auto remove_receiver () noexcept -> void
+            {
+                auto abandoned = false;
+                {
+                    auto lock = std::scoped_lock { mutex };
+
+                    abandoned = (--receiver_count == 0);
+
+                    // note: Nobody is ever going to receive
+                    //       the buffered values, thus they are destroyed
+                    //       as early as possible.
+                    //
+                    if (abandoned)
+                    {
+                        values.clear();
+                    }
+                }
+                if (abandoned)
+                {
+                    not_full.notify_all();
+                }
+
+                release();
+            }
+
+
+            auto send (cxx::forward_as<value_type> auto&& value) -> bool
+            {
+                {
+                    auto lock = std::unique_lock { mutex };
+
+                    not_full.wait(lock, [&] () noexcept -> bool
+                                        {
+                                            return !is_full() || (receiver_count == 0);
+                                        });
+
+                    if (receiver_count == 0)
+                    {
+                        return false;
+                    }
+                    values.emplace_back(std::forward<decltype(value)>(value));
+                }
+                not_empty.notify_one();
+                return true;
+            }
+
+            auto try_send (cxx::forward_as<value_type> auto&& value) -> bool
+            {
+                {
+                    auto lock = std::scoped_lock { mutex };
+
+                    if (is_full() || (receiver_count == 0))
+                    {
+                        return false;
+                    }
+                    values.emplace_back(std::forward<decltype(value)>(value));
+                }
+                not_empty.notify_one();
+                return true;
+            }
+
+            auto recv () -> std::optional<value_type>
+            {
+                auto value = std::optional<value_type> { };
+                {
+                    auto lock = std::unique_lock { mutex };
+
+                    not_empty.wait(lock, [&] () noexcept -> bool
+                                         {
+                                             return !values.empty() || (sender_count == 0);
+                                         });
+
+                    if (values.empty())
+                    {
+                        return std::nullopt;
+                    }
+                    value.emplace(std::move(values.front()));
+
+                    values.pop_front();
+                }
+                not_full.notify_one();
+                return value;
+            }
+
+            auto try_recv () -> std::optional<value_type>
+            {
+                auto value = std::optional<value_type> { };
+                {
+                    auto lock = std::scoped_lock { mutex };
+
+                    if (values.empty())
+                    {
+                        return std::nullopt;
+                    }
+                    value.emplace(std::move(values.front()));
+
+                    values.pop_front();
+                }
+                not_full.notify_one();
+                return value;
+            }
+        };
+    }
+
+
+    template <typename value_type>
+    class value_receiver;
+
+
+    // note: In contrast to the sender, the value_sender is copyable,
+    //       and closes the channel automatically, when the last copy
+    //       of the value_sender is destroyed, thus there is no need
+    //       to know the number of producers upfront.
+    //
+    //       When the channel is closed, the value_receivers
+    //       still receive all of the buffered values,
+    //       before their recv() starts to return std::nullopt.
+    //
+    template <typename value_type>
+    class value_sender
+    {
+    private:
+
+        detail::shared_state<value_type>* state;
+
+        explicit constexpr
+        value_sender (detail::shared_state<value_type>* const state) noexcept
+        :
+            state { state }
+        {
+            cxx_expects(state != nullptr);
+        }
+
+    public:
+
+        value_sender () = delete;
+
+        ~value_sender () noexcept
+        {
+            if (state != nullptr)
+            {
+                state->remove_sender();
+            }
+        }
+
+
+        value_sender (const value_sender& other) noexcept
+        :
+            state { other.state }
+        {
+            cxx_expects(state != nullptr);
+
+            state->add_sender();
+        }
+
+        auto operator = (const value_sender& other) noexcept -> value_sender&
+        {
+            return *this = value_sender { other };
+        }
+
+
+        constexpr value_sender (value_sender&& other) noexcept
+        :
+            state { cxx::exchange(other.state, nullptr) }
+        { }
+
+        auto operator = (value_sender&& other) noexcept -> value_sender&
+        {
+            if (state != nullptr)
+            {
+                state->remove_sender();
+            }
+
+            state = cxx::exchange(other.state, nullptr);
+
+            return *this;
+        }
+
+
+        constexpr auto operator == (const value_sender& other) const noexcept -> bool
+        {
+            return this->state == other.state;
+        }
+
+
+        // note: Blocks while the channel is full.
+        //
+        //       Returns false, without sending the value,
+        //       when all of the value_receivers have been destroyed.
+        //
+        auto send (cxx::forward_as<value_type> auto&& value) -> bool
+        {
+            cxx_expects(state != nullptr);
+
+            return state->send(std::forward<decltype(value)>(value));
+        }
+
+        // note: Returns false, without sending the value,
+        //       when the channel is full, instead of blocking.
+        //
+        auto try_send (cxx::forward_as<value_type> auto&& value) -> bool
+        {
+            cxx_expects(state != nullptr);
+
+            return state->try_send(std::forward<decltype(value)>(value));
+        }
+
+
+        template <typename type>
+        friend auto create (std::ptrdiff_t capacity)
+                                              -> cxx::tuple<value_receiver<type>,
+                                                            value_sender  <type>>;
+    };
+
+
+    template <typename value_type>
+    class value_receiver
+    {
+    private:
+
+        detail::shared_state<value_type>* state;
+
+        explicit constexpr
+        value_receiver (detail::shared_state<value_type>* const state) noexcept
+        :
+            state { state }
+        {
+            cxx_expects(state != nullptr);
+        }
+
+    public:
+
+        value_receiver () = delete;
+
+        ~value_receiver () noexcept
+        {
+            if (state != nullptr)
+            {
+                state->remove_receiver();
+            }
+        }
+
+
+        value_receiver (const value_receiver& other) noexcept
+        :
+            state { other.state }
+        {
+            cxx_expects(state != nullptr);
+
+            state->add_receiver();
+        }
+
+        auto operator = (const value_receiver& other) noexcept -> value_receiver&
+        {
+            return *this = value_receiver { other };
+        }
+
+
+        constexpr value_receiver (value_receiver&& other) noexcept
+        :
+            state { cxx::exchange(other.state, nullptr) }
+        { }
+
+        auto operator = (value_receiver&& other) noexcept -> value_receiver&
+        {
+            if (state != nullptr)
+            {
+                state->remove_receiver();
+            }
+
+            state = cxx::exchange(other.state, nullptr);
+
+            return *this;
+        }
+
+
+        constexpr auto operator == (const value_receiver& other) const noexcept -> bool
+        {
+            return this->state == other.state;
+        }
+
+
+        // note: Blocks while the channel is empty.
+        //
+        //       Returns std::nullopt only when the channel is empty
+        //       and all of the value_senders have been destroyed.
+        //
+        auto recv () -> std::optional<value_type>
+        {
+            cxx_expects(state != nullptr);
+
+            return state->recv();
+        }
+
+        // note: Returns std::nullopt, when the channel is empty,
+        //       instead of blocking.
+        //
+        auto try_recv () -> std::optional<value_type>
+        {
+            cxx_expects(state != nullptr);
+
+            return state->try_recv();
+        }
+
+
+        template <typename type>
+        friend auto create (std::ptrdiff_t capacity)
+                                              -> cxx::tuple<value_receiver<type>,
+                                                            value_sender  <type>>;
+    };
+
+
+    // note: The capacity limits the number of values buffered in the channel,
+    //       in contrast to the capacity of the untyped channel,
+    //       which is the number of senders.
+    //
+    template <typename value_type>
+    auto create (const std::ptrdiff_t capacity)
+                                              -> cxx::tuple<value_receiver<value_type>,
+                                                            value_sender  <value_type>>
+    {
+        auto* const state = new detail::shared_state<value_type> { capacity };
+
+        return cxx::tuple
+               {
+                   channel::value_receiver<value_type> { state },
+                   channel::value_sender  <value_type> { state },
+               };
+    }
+}
+
+
 #endif
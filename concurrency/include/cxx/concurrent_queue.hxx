@@ -37,10 +37,20 @@
 #define CXX_CONCURRENT_QUEUE
 
 
+#include <cxx/contracts.hxx>
+
 #include <deque>
 
 #include <mutex>
 
+#include <algorithm>
+
+#include <cstddef>
+
+#include <iterator>
+
+#include <ranges>
+
 #include <condition_variable>
 
 #include <optional>
@@ -157,6 +167,24 @@ namespace cxx
         std::mutex               mutex;
         std::condition_variable  ready;
         bool                     wait { true };
+        std::ptrdiff_t           waiting_count { 0 };
+
+        // note: The waiting_count is guarded by the mutex and
+        //       counts threads blocked in pop() or pop_up_to(),
+        //       so that push_range() can wake up only as many threads,
+        //       as the number of values it has pushed.
+        //
+        auto wait_until_ready (std::unique_lock<std::mutex>& lock) -> void
+        {
+            ++waiting_count;
+
+            ready.wait(lock, [&] () noexcept -> bool
+                             {
+                                return !values.empty() || !wait;
+                             });
+
+            --waiting_count;
+        }
 
     public:
         auto interrupt () -> void
@@ -173,10 +201,7 @@ namespace cxx
         {
             auto lock = std::unique_lock { mutex };
 
-            ready.wait(lock, [&] () noexcept -> bool
-                             {
-                                return !values.empty() || !wait;
-                             });
+            wait_until_ready(lock);
 
             if (!values.empty())
             {
@@ -234,6 +259,82 @@ namespace cxx
             ready.notify_one();
             return true;
         }
+
+        // note: The push_range() locks the mutex once for all of the values,
+        //       instead of once per value, and then wakes up
+        //       at most as many waiting threads, as values have been pushed.
+        //
+        template <std::ranges::input_range range_type>
+        requires std::constructible_from<value_type,
+                                         std::ranges::range_reference_t<range_type>>
+        //
+        auto push_range (range_type&& range) -> void
+        {
+            auto notify_count = std::ptrdiff_t { 0 };
+            auto notify_every = false;
+            {
+                auto lock = std::scoped_lock { mutex };
+
+                const auto old_size = std::ssize(values);
+
+                for (auto&& value : range)
+                {
+                    values.emplace_back(std::forward<decltype(value)>(value));
+                }
+
+                const auto pushed_count = std::ssize(values) - old_size;
+
+                notify_count = std::min(pushed_count, waiting_count);
+                notify_every = (notify_count > 0) && (notify_count == waiting_count);
+            }
+
+            if (notify_every)
+            {
+                ready.notify_all();
+            }
+            else
+            {
+                for (auto n = std::ptrdiff_t { 0 }; n != notify_count; ++n)
+                {
+                    ready.notify_one();
+                }
+            }
+        }
+
+        // note: The pop_up_to() blocks, just like the pop(),
+        //       until at least one value is available or
+        //       the concurrent_queue has been interrupted,
+        //       and then moves up to max_count values to the output,
+        //       locking the mutex only once.
+        //
+        //       Returns the number of values, which have been popped,
+        //       which is 0 only if the concurrent_queue has been interrupted.
+        //
+        //       The max_count has to be positive, because otherwise
+        //       a return of 0 would not mean an interruption.
+        //
+        template <std::output_iterator<value_type&&> output_iterator>
+        //
+        auto pop_up_to (const std::ptrdiff_t   max_count,
+                        output_iterator           output) -> std::ptrdiff_t
+        {
+            cxx_expects(max_count > 0);
+
+            auto lock = std::unique_lock { mutex };
+
+            wait_until_ready(lock);
+
+            const auto count = std::min(max_count, std::ssize(values));
+
+            const auto first = values.begin();
+            const auto last  = values.begin() + count;
+
+            std::move(first, last, std::move(output));
+
+            values.erase(first, last);
+
+            return count;
+        }
     };
 }
 
@@ -0,0 +1,344 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef CXX_COROUTINE_FRAME
+#define CXX_COROUTINE_FRAME
+
+
+#include <cxx/contracts.hxx>
+
+#include <memory>
+
+#include <cstddef>
+
+#include <cstdint>
+
+#include <utility>
+
+#include <array>
+
+#include <new>
+
+
+namespace cxx
+{
+    // [ISO C++] - P2502R2: std::generator: Synchronous Coroutine Generator for Ranges
+    //
+    // ~ https://www.open-std.org/jtc1/sc22/wg21/docs/papers/2022/p2502r2.pdf
+
+    // [C++ reference] - Coroutines: Dynamic allocation
+    //
+    // ~ https://en.cppreference.com/w/cpp/language/coroutines#Dynamic_allocation
+
+    struct coroutine_frame_statistics
+    {
+        std::int64_t  allocations      { 0 };
+        std::int64_t  reused_frames    { 0 };
+        std::int64_t  allocated_bytes  { 0 };
+
+        [[nodiscard]]
+        auto reuse_rate () const noexcept -> double
+        {
+            return (allocations != 0) ? double(reused_frames) / double(allocations)
+                                      : 0.0;
+        }
+    };
+
+
+    // note: The coroutine_frame_pool caches freed coroutine frames
+    //       in free lists of size classes, which are local to a thread,
+    //       thus allocating a frame does not require any synchronization.
+    //
+    //       A frame freed by another thread, than the one which
+    //       has allocated it, which happens whenever a coroutine
+    //       is resumed on an executor, is cached by the freeing thread.
+    //
+    class coroutine_frame_pool
+    {
+    private:
+        static constexpr auto size_granularity  = std::size_t { 64 };
+        static constexpr auto size_class_count  = std::size_t { 16 };
+        static constexpr auto max_cached_frames = std::int64_t { 64 };
+
+        struct free_frame
+        {
+            free_frame* next;
+        };
+
+        std::array<free_frame*,   size_class_count>    free_frames;
+        std::array<std::int64_t,  size_class_count>   cached_counts;
+
+        cxx::coroutine_frame_statistics                  statistics;
+
+        coroutine_frame_pool () noexcept
+        :
+            free_frames   { },
+            cached_counts { },
+            statistics    { }
+        {
+        }
+
+        static constexpr auto size_class (const std::size_t size) noexcept -> std::size_t
+        {
+            return (size + size_granularity - 1) / size_granularity - 1;
+        }
+
+    public:
+        static constexpr auto max_pooled_size = size_granularity * size_class_count;
+
+        coroutine_frame_pool (const coroutine_frame_pool&) = delete;
+
+        auto operator = (const coroutine_frame_pool&) -> coroutine_frame_pool& = delete;
+
+        ~coroutine_frame_pool () noexcept
+        {
+            for (auto index = std::size_t { 0 }; index != size_class_count; ++index)
+            {
+                while (free_frames[index] != nullptr)
+                {
+                    const auto frame = std::exchange(free_frames[index],
+                                                     free_frames[index]->next);
+
+                    ::operator delete(frame, (index + 1) * size_granularity);
+                }
+            }
+        }
+
+        [[nodiscard]]
+        static auto this_thread () noexcept -> coroutine_frame_pool&
+        {
+            static thread_local auto pool = coroutine_frame_pool { };
+
+            return pool;
+        }
+
+        [[nodiscard]]
+        auto allocate (const std::size_t size) -> void*
+        {
+            statistics.allocations     += 1;
+            statistics.allocated_bytes += std::int64_t(size);
+
+            if (size > max_pooled_size)
+            {
+                return ::operator new(size);
+            }
+
+            const auto index = size_class(size);
+
+            if (free_frames[index] != nullptr)
+            {
+                statistics.reused_frames += 1;
+                cached_counts[index]     -= 1;
+
+                return std::exchange(free_frames[index], free_frames[index]->next);
+            }
+
+            return ::operator new((index + 1) * size_granularity);
+        }
+
+        auto deallocate (void* const frame, const std::size_t size) noexcept -> void
+        {
+            if (size > max_pooled_size)
+            {
+                ::operator delete(frame, size);
+
+                return;
+            }
+
+            const auto index = size_class(size);
+
+            if (cached_counts[index] == max_cached_frames)
+            {
+                ::operator delete(frame, (index + 1) * size_granularity);
+
+                return;
+            }
+
+            cached_counts[index] += 1;
+            free_frames  [index]  = ::new (frame) free_frame { free_frames[index] };
+        }
+
+        [[nodiscard]]
+        auto stats () const noexcept -> const cxx::coroutine_frame_statistics&
+        {
+            return statistics;
+        }
+    };
+
+
+    // note: Promise types deriving from the pooled_coroutine_frame
+    //       allocate their coroutine frames from the coroutine_frame_pool
+    //       of the current thread, unless the coroutine takes
+    //       std::allocator_arg followed by an allocator
+    //       as its first parameters (after the implicit object parameter
+    //       of member functions), in which case that allocator is used.
+    //
+    //       auto parse (std::allocator_arg_t, arena_allocator, text) -> task<ast>;
+    //
+    //       Every frame ends with a pointer to the function deallocating it,
+    //       which is null for frames allocated from the coroutine_frame_pool,
+    //       followed by a copy of the allocator for the other frames.
+    //
+    //       Coroutines always free their frames with the usual operator delete,
+    //       which cannot be a template, thus GCC 12 reports every coroutine
+    //       taking an allocator with -Wmismatched-new-delete at -O0,
+    //       because it pairs member operators by their mangled names.
+    //
+    class pooled_coroutine_frame
+    {
+    private:
+        using deallocate_function = auto (void* frame, std::size_t size) noexcept -> void;
+
+        struct alignas(__STDCPP_DEFAULT_NEW_ALIGNMENT__) frame_block
+        {
+            std::byte bytes[__STDCPP_DEFAULT_NEW_ALIGNMENT__];
+        };
+
+        static constexpr auto round_up (const std::size_t size,
+                                        const std::size_t alignment) noexcept -> std::size_t
+        {
+            return (size + alignment - 1) / alignment * alignment;
+        }
+
+        static constexpr auto deallocator_offset (const std::size_t size) noexcept -> std::size_t
+        {
+            return round_up(size, alignof(deallocate_function*));
+        }
+
+        template <typename allocator_type>
+        static constexpr auto allocator_offset (const std::size_t size) noexcept -> std::size_t
+        {
+            return round_up(deallocator_offset(size) + sizeof(deallocate_function*),
+                            alignof(allocator_type));
+        }
+
+        template <typename allocator_type>
+        static constexpr auto block_count (const std::size_t size) noexcept -> std::size_t
+        {
+            return round_up(allocator_offset<allocator_type>(size) + sizeof(allocator_type),
+                            sizeof(frame_block)) / sizeof(frame_block);
+        }
+
+        static auto deallocator (void* const frame, const std::size_t size) noexcept
+                                                               -> deallocate_function*&
+        {
+            return *std::launder(reinterpret_cast<deallocate_function**>(
+                                     static_cast<std::byte*>(frame) + deallocator_offset(size)));
+        }
+
+        template <typename allocator_type>
+        static auto deallocate_with (void* const frame, const std::size_t size) noexcept -> void
+        {
+            auto& stored = *std::launder(reinterpret_cast<allocator_type*>(
+                                             static_cast<std::byte*>(frame)
+                                             + allocator_offset<allocator_type>(size)));
+
+            auto allocator = allocator_type { std::move(stored) };
+
+            stored.~allocator_type();
+
+            std::allocator_traits<allocator_type>::deallocate(allocator,
+                                                              static_cast<frame_block*>(frame),
+                                                              block_count<allocator_type>(size));
+        }
+
+        template <typename allocator_type>
+        static auto allocate_with (const std::size_t size, const allocator_type& allocator) -> void*
+        {
+            using block_allocator = typename std::allocator_traits<allocator_type>
+                                                ::template rebind_alloc<frame_block>;
+
+            auto blocks = block_allocator { allocator };
+
+            void* const frame = std::allocator_traits<block_allocator>
+                                   ::allocate(blocks, block_count<block_allocator>(size));
+
+            ::new (static_cast<std::byte*>(frame) + allocator_offset<block_allocator>(size))
+                  block_allocator { std::move(blocks) };
+
+            deallocator(frame, size) = &deallocate_with<block_allocator>;
+
+            return frame;
+        }
+
+    public:
+        static auto operator new (const std::size_t size) -> void*
+        {
+            const auto frame = cxx::coroutine_frame_pool::this_thread()
+                                  .allocate(deallocator_offset(size) + sizeof(deallocate_function*));
+
+            deallocator(frame, size) = nullptr;
+
+            return frame;
+        }
+
+        template <typename allocator_type, typename ... args_types>
+        static auto operator new (const std::size_t          size,
+                                  std::allocator_arg_t,
+                                  const allocator_type& allocator,
+                                  const args_types& ...) -> void*
+        {
+            return allocate_with(size, allocator);
+        }
+
+        template <typename object_type, typename allocator_type, typename ... args_types>
+        static auto operator new (const std::size_t          size,
+                                  const object_type&,
+                                  std::allocator_arg_t,
+                                  const allocator_type& allocator,
+                                  const args_types& ...) -> void*
+        {
+            return allocate_with(size, allocator);
+        }
+
+        static auto operator delete (void* const frame, const std::size_t size) noexcept -> void
+        {
+            const auto deallocate = deallocator(frame, size);
+
+            if (deallocate == nullptr)
+            {
+                cxx::coroutine_frame_pool::this_thread()
+                   .deallocate(frame, deallocator_offset(size) + sizeof(deallocate_function*));
+            }
+            else
+            {
+                deallocate(frame, size);
+            }
+        }
+    };
+}
+
+
+#endif
@@ -0,0 +1,89 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef CXX_CPU_RELAX
+#define CXX_CPU_RELAX
+
+
+#if   defined(_MSC_VER)
+
+    #include <intrin.h>
+
+#endif
+
+
+namespace cxx
+{
+    // [Intel] - Intel 64 and IA-32 Architectures Software Developer's Manual:
+    //           PAUSE - Spin Loop Hint
+    // ~ https://www.felixcloutier.com/x86/pause
+    //
+    // [Arm] - Arm A64 Instruction Set Architecture: YIELD
+    // ~ https://developer.arm.com/documentation/ddi0602/latest/Base-Instructions/YIELD--YIELD-
+    //
+    // [Linux] - cpu_relax()
+    // ~ https://github.com/torvalds/linux/blob/master/arch/x86/include/asm/vdso/processor.h
+
+
+    // note: The cxx::cpu_relax() hints to the CPU, that the calling thread
+    //       is executing a spin-wait loop, which allows the CPU to
+    //       lower power consumption, yield resources to a sibling
+    //       hyper-thread and avoid a memory order violation pipeline flush,
+    //       when the spin-wait loop finally exits.
+    //
+    inline auto cpu_relax () noexcept -> void
+    {
+    #if   defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+
+        _mm_pause();
+
+    #elif defined(_MSC_VER) && (defined(_M_ARM64) || defined(_M_ARM))
+
+        __yield();
+
+    #elif defined(__x86_64__) || defined(__i386__)
+
+        __builtin_ia32_pause();
+
+    #elif defined(__aarch64__) || defined(__arm__)
+
+        asm volatile ("yield" ::: "memory");
+
+    #endif
+    }
+}
+
+
+#endif
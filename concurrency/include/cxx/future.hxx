@@ -0,0 +1,736 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef CXX_FUTURE
+#define CXX_FUTURE
+
+
+#include <cxx/executor.hxx>
+
+#include <cxx/contracts.hxx>
+
+#include <concepts>
+
+#include <type_traits>
+
+#include <functional>
+
+#include <exception>
+
+#include <cstddef>
+
+#include <utility>
+
+#include <variant>
+
+#include <atomic>
+
+#include <array>
+
+#include <tuple>
+
+
+namespace cxx
+{
+    // [ISO C++] - N3721: Improvements to std::future<T> and Related APIs
+    //
+    // ~ https://www.open-std.org/jtc1/sc22/wg21/docs/papers/2013/n3721.pdf
+
+    // [ISO C++] - Technical Specification for C++ Extensions for Concurrency
+    //
+    // ~ https://en.cppreference.com/w/cpp/experimental/concurrency
+
+    // [Facebook] - Folly: Futures
+    //
+    // ~ https://github.com/facebook/folly/blob/main/folly/docs/Futures.md
+
+    template <typename value_type>
+    class future;
+
+
+    namespace detail
+    {
+        // note: Results of futures of void are stored as std::monostate,
+        //       so that the same shared_state can be used for all futures.
+        //
+        template <typename value_type>
+        using stored_t = std::conditional_t<std::is_void_v<value_type>,
+                                            std::monostate, value_type>;
+
+
+        class continuation
+        {
+        public:
+            virtual auto resume () noexcept -> void = 0;
+
+        protected:
+            ~continuation () = default;
+        };
+
+
+        // note: The shared_state is reference counted by the future
+        //       and by the producer of its result, which either is
+        //       a task submitted to an executor or a continuation
+        //       attached to other shared_states.
+        //
+        //       At most one continuation can be attached to a shared_state,
+        //       which is resumed by the thread storing the result,
+        //       or immediately, when the result is already stored.
+        //
+        template <typename value_type>
+        class shared_state
+        {
+        private:
+            struct ready_marker final : detail::continuation
+            {
+                auto resume () noexcept -> void override { }
+            };
+
+            static constinit inline auto ready = ready_marker { };
+
+            std::atomic<std::ptrdiff_t>                   ref_count;
+            std::atomic<detail::continuation*>                 next;
+
+            std::variant<std::monostate,
+                         detail::stored_t<value_type>,
+                         std::exception_ptr>                 result;
+
+            auto complete () noexcept -> void
+            {
+                const auto waiting = next.exchange(&ready, std::memory_order::acq_rel);
+
+                if (waiting != nullptr)
+                {
+                    waiting->resume();
+                }
+                else
+                {
+                    next.notify_all();
+                }
+            }
+
+        protected:
+            virtual ~shared_state () = default;
+
+        public:
+            explicit shared_state (const std::ptrdiff_t ref_count) noexcept
+            :
+                ref_count { ref_count },
+                next      { nullptr   },
+                result    {           }
+            {
+            }
+
+            shared_state (const shared_state&) = delete;
+
+            auto operator = (const shared_state&) -> shared_state& = delete;
+
+            auto release () noexcept -> void
+            {
+                if (ref_count.fetch_sub(1, std::memory_order::release) == 1)
+                {
+                    std::atomic_thread_fence(std::memory_order::acquire);
+
+                    delete this;
+                }
+            }
+
+            // note: Stores either the result of the function or
+            //       the exception thrown by it.
+            //
+            template <typename function_type>
+            auto set_result_of (function_type&& function) noexcept -> void
+            {
+                try
+                {
+                    if constexpr (std::is_void_v<value_type>)
+                    {
+                        std::invoke(std::forward<function_type>(function));
+
+                        result.template emplace<1>();
+                    }
+                    else
+                    {
+                        result.template emplace<1>(std::invoke(std::forward<function_type>(function)));
+                    }
+                }
+                catch (...)
+                {
+                    result.template emplace<2>(std::current_exception());
+                }
+
+                complete();
+            }
+
+            auto set_exception (std::exception_ptr exception) noexcept -> void
+            {
+                result.template emplace<2>(std::move(exception));
+
+                complete();
+            }
+
+            auto attach (detail::continuation* const continuation) noexcept -> void
+            {
+                auto expected = static_cast<detail::continuation*>(nullptr);
+
+                if (!next.compare_exchange_strong(expected, continuation,
+                                                  std::memory_order::acq_rel,
+                                                  std::memory_order::acquire))
+                {
+                    continuation->resume();
+                }
+            }
+
+            [[nodiscard]]
+            auto is_ready () const noexcept -> bool
+            {
+                return next.load(std::memory_order::acquire) == &ready;
+            }
+
+            auto wait () const noexcept -> void
+            {
+                for (auto waiting = next.load(std::memory_order::acquire);
+                          waiting != &ready;
+                          waiting = next.load(std::memory_order::acquire))
+                {
+                    next.wait(waiting, std::memory_order::relaxed);
+                }
+            }
+
+            // note: Moves the result out of a ready shared_state,
+            //       or rethrows the stored exception.
+            //
+            auto take () -> detail::stored_t<value_type>
+            {
+                if (result.index() == 2)
+                {
+                    std::rethrow_exception(std::get<2>(result));
+                }
+
+                return std::move(std::get<1>(result));
+            }
+        };
+
+
+        struct future_access
+        {
+            template <typename value_type>
+            static auto make (detail::shared_state<value_type>* const state) noexcept
+                                                                 -> cxx::future<value_type>
+            {
+                return cxx::future<value_type> { state };
+            }
+
+            template <typename value_type>
+            static auto detach (cxx::future<value_type>&& future) noexcept
+                                                                 -> detail::shared_state<value_type>*
+            {
+                return std::exchange(future.state, nullptr);
+            }
+        };
+
+
+        template <typename value_type, typename function_type>
+        class task_state final : public detail::shared_state<value_type>
+        {
+        private:
+            function_type function;
+
+        public:
+            explicit task_state (auto&& function)
+            :
+                detail::shared_state<value_type> { 2                                        },
+                function                         { std::forward<decltype(function)>(function) }
+            {
+            }
+
+            auto run () noexcept -> void
+            {
+                this->set_result_of(function);
+                this->release();
+            }
+        };
+
+
+        // note: The then_state is the shared_state of the future returned
+        //       by the .then() and the continuation of its parent at once,
+        //       thus each link of a chain of continuations
+        //       requires exactly one allocation.
+        //
+        template <typename parent_type,
+                  typename  value_type, typename executor_type, typename function_type>
+        class then_state final : public  detail::shared_state<value_type>,
+                                 private detail::continuation
+        {
+        private:
+            detail::shared_state<parent_type>*   parent;
+            executor_type*                     executor;
+            function_type                      function;
+
+            auto run () noexcept -> void
+            {
+                this->set_result_of([this] () -> value_type
+                {
+                    if constexpr (std::is_void_v<parent_type>)
+                    {
+                        parent->take();
+
+                        return std::invoke(function);
+                    }
+                    else
+                    {
+                        return std::invoke(function, parent->take());
+                    }
+                });
+
+                parent->release();
+                this->release();
+            }
+
+        public:
+            explicit then_state (detail::shared_state<parent_type>* const parent,
+                                 executor_type&                         executor,
+                                 auto&&                                 function)
+            :
+                detail::shared_state<value_type> { 2                                        },
+                parent                           { parent                                   },
+                executor                         { &executor                                },
+                function                         { std::forward<decltype(function)>(function) }
+            {
+            }
+
+            auto start () noexcept -> void
+            {
+                parent->attach(this);
+            }
+
+            auto resume () noexcept -> void override
+            {
+                try
+                {
+                    executor->submit([this] () -> void { run(); });
+                }
+                catch (...)
+                {
+                    this->set_exception(std::current_exception());
+
+                    parent->release();
+                    this->release();
+                }
+            }
+        };
+
+
+        // note: The same continuation is attached to all of the parents,
+        //       since it only counts how many of them are ready.
+        //
+        template <typename ... value_types>
+        class when_all_state final : public  detail::shared_state<std::tuple<detail::stored_t<value_types>...>>,
+                                     private detail::continuation
+        {
+        private:
+            std::tuple<detail::shared_state<value_types>*...>   parents;
+            std::atomic<std::ptrdiff_t>                       remaining;
+
+        public:
+            explicit when_all_state (detail::shared_state<value_types>* const ... parents) noexcept
+            :
+                detail::shared_state<std::tuple<detail::stored_t<value_types>...>> { 2 },
+
+                parents   { parents...             },
+                remaining { sizeof...(value_types) }
+            {
+            }
+
+            auto start () noexcept -> void
+            {
+                std::apply([this] (const auto ... parent) -> void
+                {
+                    (parent->attach(this), ...);
+                },
+                parents);
+            }
+
+            auto resume () noexcept -> void override
+            {
+                if (remaining.fetch_sub(1, std::memory_order::acq_rel) == 1)
+                {
+                    this->set_result_of([this]
+                    {
+                        return std::apply([] (const auto ... parent)
+                        {
+                            // note: Braced initialization guarantees,
+                            //       that results are taken in order.
+                            //
+                            return std::tuple<detail::stored_t<value_types>...>
+                                   {
+                                       parent->take()...
+                                   };
+                        },
+                        parents);
+                    });
+
+                    std::apply([] (const auto ... parent) -> void
+                    {
+                        (parent->release(), ...);
+                    },
+                    parents);
+
+                    this->release();
+                }
+            }
+        };
+
+
+        template <typename value_type, typename function_type>
+        struct then_result : std::invoke_result<function_type&, value_type&&>
+        {
+        };
+
+        template <typename function_type>
+        struct then_result <void, function_type> : std::invoke_result<function_type&>
+        {
+        };
+
+        template <typename value_type, typename function_type>
+        using then_result_t = typename then_result<value_type, function_type>::type;
+
+
+        template <typename value_type>
+        struct when_any_result
+        {
+            std::size_t                          index;
+            detail::stored_t<value_type>         value;
+        };
+
+
+        // note: The first of the parents to become ready
+        //       determines the result of the when_any_state,
+        //       however the when_any_state must remain alive,
+        //       until all of the parents are ready,
+        //       because it is attached to all of them.
+        //
+        template <typename value_type, std::size_t count>
+        class when_any_state final : public  detail::shared_state<detail::when_any_result<value_type>>,
+                                     private detail::continuation
+        {
+        private:
+            static constexpr auto parent_count = std::ptrdiff_t { count };
+
+            std::array<detail::shared_state<value_type>*, count>   parents;
+            std::atomic<std::ptrdiff_t>                          remaining;
+
+        public:
+            explicit when_any_state (const std::array<detail::shared_state<value_type>*, count>& parents) noexcept
+            :
+                detail::shared_state<detail::when_any_result<value_type>> { 2 },
+
+                parents   { parents      },
+                remaining { parent_count }
+            {
+            }
+
+            auto start () noexcept -> void
+            {
+                for (const auto parent : parents)
+                {
+                    parent->attach(this);
+                }
+            }
+
+            auto resume () noexcept -> void override
+            {
+                const auto arrived = remaining.fetch_sub(1, std::memory_order::acq_rel);
+
+                // note: The parent, which has resumed the first continuation,
+                //       is not known, but at least one of the parents is ready.
+                //
+                if (arrived == parent_count)
+                {
+                    this->set_result_of([this]
+                    {
+                        auto index = std::size_t { 0 };
+
+                        while (!parents[index]->is_ready())
+                        {
+                            index += 1;
+                        }
+
+                        return detail::when_any_result<value_type>
+                               {
+                                   index, parents[index]->take()
+                               };
+                    });
+                }
+
+                if (arrived == 1)
+                {
+                    for (const auto parent : parents)
+                    {
+                        parent->release();
+                    }
+
+                    this->release();
+                }
+            }
+        };
+    }
+
+
+    template <typename value_type>
+    class future
+    {
+    private:
+        detail::shared_state<value_type>* state;
+
+        explicit future (detail::shared_state<value_type>* const state) noexcept
+        :
+            state { state }
+        {
+        }
+
+        friend struct detail::future_access;
+
+    public:
+        future () noexcept
+        :
+            state { nullptr }
+        {
+        }
+
+        ~future () noexcept
+        {
+            if (state != nullptr)
+            {
+                state->release();
+            }
+        }
+
+        future (const future&) = delete;
+
+        auto operator = (const future&) -> future& = delete;
+
+        future (future&& other) noexcept
+        :
+            state { std::exchange(other.state, nullptr) }
+        {
+        }
+
+        auto operator = (future&& other) noexcept -> future&
+        {
+            if (state != nullptr)
+            {
+                state->release();
+            }
+
+            state = std::exchange(other.state, nullptr);
+
+            return *this;
+        }
+
+        [[nodiscard]]
+        auto valid () const noexcept -> bool
+        {
+            return state != nullptr;
+        }
+
+        [[nodiscard]]
+        auto is_ready () const noexcept -> bool
+        {
+            cxx_expects(valid());
+
+            return state->is_ready();
+        }
+
+        auto wait () const noexcept -> void
+        {
+            cxx_expects(valid());
+
+            state->wait();
+        }
+
+        // note: Blocks until the result is ready and then either returns it,
+        //       or rethrows the exception, which has been thrown
+        //       while computing it, leaving the future invalid.
+        //
+        auto get () -> value_type
+        {
+            cxx_expects(valid());
+
+            auto ready = future { std::exchange(state, nullptr) };
+
+            ready.state->wait();
+
+            if constexpr (std::is_void_v<value_type>)
+            {
+                ready.state->take();
+            }
+            else
+            {
+                return ready.state->take();
+            }
+        }
+
+        // note: Submits the function to the executor,
+        //       once the result of this future is ready,
+        //       without blocking any thread until then.
+        //
+        //       The function is invoked with the result of this future,
+        //       unless an exception has been stored instead,
+        //       in which case the exception is propagated
+        //       to the returned future, without invoking the function.
+        //
+        //       The executor must outlive the execution of the function.
+        //
+        template <typename executor_type, typename function_type>
+        requires cxx::executor<executor_type>
+        //
+        auto then (executor_type& executor, function_type&& function) &&
+        {
+            cxx_expects(valid());
+
+            using result_type = detail::then_result_t<value_type,
+                                                      std::decay_t<function_type>>;
+
+            using then_state = detail::then_state<value_type, result_type,
+                                                  executor_type, std::decay_t<function_type>>;
+
+            auto* const next = new then_state
+                               {
+                                   state, executor, std::forward<function_type>(function)
+                               };
+
+            state = nullptr;
+
+            next->start();
+
+            return detail::future_access::make<result_type>(next);
+        }
+    };
+
+
+    // note: Submits the task to the executor and returns a future,
+    //       which receives either its result or the exception thrown by it.
+    //
+    template <typename executor_type, typename task_type>
+    requires cxx::executor<executor_type> && std::invocable<std::decay_t<task_type>&>
+    //
+    auto async_exec (executor_type& executor, task_type&& task)
+                                 -> cxx::future<std::invoke_result_t<std::decay_t<task_type>&>>
+    {
+        using value_type = std::invoke_result_t<std::decay_t<task_type>&>;
+
+        using task_state = detail::task_state<value_type, std::decay_t<task_type>>;
+
+        auto* const state = new task_state { std::forward<task_type>(task) };
+
+        try
+        {
+            executor.submit([state] () -> void { state->run(); });
+        }
+        catch (...)
+        {
+            delete state;
+
+            throw;
+        }
+
+        return detail::future_access::make<value_type>(state);
+    }
+
+
+    template <typename value_type>
+    auto sync_wait (cxx::future<value_type> future) -> value_type
+    {
+        return future.get();
+    }
+
+
+    // note: Returns a future, which becomes ready,
+    //       when all of the futures become ready,
+    //       and receives either a tuple of all of their results,
+    //       or the first of their exceptions, in order of arguments.
+    //
+    template <typename ... value_types>
+    requires (sizeof...(value_types) > 0)
+    //
+    auto when_all (cxx::future<value_types> ... futures)
+                             -> cxx::future<std::tuple<detail::stored_t<value_types>...>>
+    {
+        using when_all_state = detail::when_all_state<value_types...>;
+
+        auto* const state = new when_all_state
+                            {
+                                detail::future_access::detach(std::move(futures))...
+                            };
+
+        state->start();
+
+        return detail::future_access::make<std::tuple<detail::stored_t<value_types>...>>(state);
+    }
+
+
+    // note: Returns a future, which becomes ready,
+    //       when any of the futures becomes ready,
+    //       and receives its index together with its result,
+    //       or its exception.
+    //
+    template <typename value_type, typename ... value_types>
+    requires (std::same_as<value_type, value_types> && ...)
+    //
+    auto when_any (cxx::future<value_type> future, cxx::future<value_types> ... futures)
+                             -> cxx::future<detail::when_any_result<value_type>>
+    {
+        constexpr auto count = 1 + sizeof...(value_types);
+
+        using when_any_state = detail::when_any_state<value_type, count>;
+
+        auto* const state = new when_any_state
+                            {
+                                std::array<detail::shared_state<value_type>*, count>
+                                {
+                                    detail::future_access::detach(std::move(future)),
+                                    detail::future_access::detach(std::move(futures))...
+                                }
+                            };
+
+        state->start();
+
+        return detail::future_access::make<detail::when_any_result<value_type>>(state);
+    }
+}
+
+
+#endif
@@ -0,0 +1,118 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef CXX_LOCK_STATISTICS
+#define CXX_LOCK_STATISTICS
+
+
+#include <cstdint>
+
+#include <atomic>
+
+
+namespace cxx
+{
+    // note: The cxx::no_lock_statistics is the default statistics policy
+    //       of locks, which does not record anything, and thanks to
+    //       [[no_unique_address]] does not increase size of a lock.
+    //
+    struct no_lock_statistics
+    {
+        constexpr auto record (const bool, const std::int64_t) noexcept -> void
+        {
+        }
+    };
+
+
+    // note: The cxx::lock_statistics counts acquisitions of a lock,
+    //       acquisitions which had to wait for another thread and
+    //       iterations of spin-wait loops performed while waiting.
+    //
+    //       Counters are modified only by the thread, which has just
+    //       acquired the lock, thus a relaxed load followed by
+    //       a relaxed store is sufficient, and no atomic read-modify-write
+    //       operations are required, while counters can still be read
+    //       concurrently by any other thread, without data races.
+    //
+    class lock_statistics
+    {
+    private:
+        std::atomic<std::int64_t>            acquisition_count { 0 };
+        std::atomic<std::int64_t>  contended_acquisition_count { 0 };
+        std::atomic<std::int64_t>                   spin_count { 0 };
+
+        static
+        auto increment (std::atomic<std::int64_t>& counter,
+                        const std::int64_t          update) noexcept -> void
+        {
+            counter.store(counter.load(std::memory_order::relaxed) + update,
+                          std::memory_order::relaxed);
+        }
+
+    public:
+        auto record (const bool         contended,
+                     const std::int64_t spins) noexcept -> void
+        {
+            increment(acquisition_count, 1);
+
+            if (contended)
+            {
+                increment(contended_acquisition_count, 1);
+                increment(spin_count,              spins);
+            }
+        }
+
+        [[nodiscard]]
+        auto acquisitions () const noexcept -> std::int64_t
+        {
+            return acquisition_count.load(std::memory_order::relaxed);
+        }
+
+        [[nodiscard]]
+        auto contended_acquisitions () const noexcept -> std::int64_t
+        {
+            return contended_acquisition_count.load(std::memory_order::relaxed);
+        }
+
+        [[nodiscard]]
+        auto spin_iterations () const noexcept -> std::int64_t
+        {
+            return spin_count.load(std::memory_order::relaxed);
+        }
+    };
+}
+
+
+#endif
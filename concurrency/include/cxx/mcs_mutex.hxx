@@ -0,0 +1,342 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef CXX_MCS_MUTEX
+#define CXX_MCS_MUTEX
+
+
+#include <cxx/cache_line.hxx>
+
+#include <cxx/cpu_relax.hxx>
+
+#include <cxx/lock_statistics.hxx>
+
+#include <cstdint>
+
+#include <utility>
+
+#include <atomic>
+
+#include <mutex>
+
+
+namespace cxx
+{
+    // [John M. Mellor-Crummey, Michael L. Scott] - Algorithms for Scalable
+    //                                              Synchronization on
+    //                                              Shared-Memory Multiprocessors
+    //
+    // ~ https://www.cs.rochester.edu/u/scott/papers/1991_TOCS_synch.pdf
+
+    // [Linux Kernel] - MCS lock
+    //
+    // ~ https://lwn.net/Articles/590243
+
+    // note: The mcs_mutex is a fair queue lock.
+    //
+    //       Every waiting thread enqueues its own node
+    //       and polls only the cache line of that node,
+    //       which is written only once, by the thread handing
+    //       the mcs_mutex over, hence the unlock() invalidates
+    //       the cache line of a single waiting thread,
+    //       no matter how many threads are waiting.
+    //
+    //       In order to model the Lockable requirements,
+    //       whose lock() and unlock() take no arguments,
+    //       the nodes are taken from a thread local pool,
+    //       and the node of the owning thread is kept in the mcs_mutex.
+    //
+    template <typename statistics_type = cxx::no_lock_statistics>
+    class basic_mcs_mutex
+    {
+    private:
+        enum state_type : std::uint32_t
+        {
+            waiting,
+            parked,
+            granted,
+        };
+
+        struct alignas(cxx::cache_line_size) node_type
+        {
+            std::atomic<node_type*>        next;
+            std::atomic<std::uint32_t>    state;
+
+            node_type*                next_free;
+        };
+
+        // note: The nodes are reused by all of the mcs_mutexes
+        //       locked by a thread, and are never deleted,
+        //       since the thread handing an mcs_mutex over notifies
+        //       the node of its successor after granting the mcs_mutex,
+        //       when the successor might have already unlocked it and exited.
+        //
+        //       Instead, the nodes of an exiting thread are moved
+        //       to the global free list, which other threads take them from.
+        //
+        class node_pool
+        {
+        private:
+            node_type* free_nodes;
+
+            static inline std::mutex global_mutex      {         };
+            static inline node_type* global_free_nodes { nullptr };
+
+        public:
+            node_pool () noexcept
+            :
+                free_nodes { nullptr }
+            {
+            }
+
+            node_pool (const node_pool&) = delete;
+
+            auto operator = (const node_pool&) -> node_pool& = delete;
+
+            ~node_pool () noexcept
+            {
+                const auto lock = std::scoped_lock { global_mutex };
+
+                while (free_nodes != nullptr)
+                {
+                    const auto node = std::exchange(free_nodes, free_nodes->next_free);
+
+                    node->next_free = std::exchange(global_free_nodes, node);
+                }
+            }
+
+            auto acquire () -> node_type*
+            {
+                if (free_nodes != nullptr)
+                {
+                    return std::exchange(free_nodes, free_nodes->next_free);
+                }
+
+                {
+                    const auto lock = std::scoped_lock { global_mutex };
+
+                    if (global_free_nodes != nullptr)
+                    {
+                        return std::exchange(global_free_nodes, global_free_nodes->next_free);
+                    }
+                }
+
+                return new node_type { };
+            }
+
+            auto release (node_type* const node) noexcept -> void
+            {
+                node->next_free = std::exchange(free_nodes, node);
+            }
+        };
+
+        static inline thread_local node_pool pool { };
+
+        alignas(cxx::cache_line_size) std::atomic<node_type*> tail;
+
+        // note: The owner is accessed only by the thread holding the mcs_mutex.
+        //
+        node_type*                                            owner;
+        std::int64_t                                    spin_budget;
+
+        [[no_unique_address]]
+        statistics_type                                  statistics;
+
+        static auto prepare (node_type* const node) noexcept -> node_type*
+        {
+            node->next.store(nullptr, std::memory_order::relaxed);
+            node->state.store(waiting, std::memory_order::relaxed);
+
+            return node;
+        }
+
+    public:
+        static constexpr auto default_spin_budget = std::int64_t { 256 };
+
+        constexpr basic_mcs_mutex () noexcept
+        :
+            basic_mcs_mutex { default_spin_budget }
+        {
+        }
+
+        constexpr explicit basic_mcs_mutex (const std::int64_t spin_budget) noexcept
+        :
+            tail        { nullptr     },
+            owner       { nullptr     },
+            spin_budget { spin_budget },
+            statistics  {             }
+        {
+        }
+
+        basic_mcs_mutex (const basic_mcs_mutex&) = delete;
+
+        auto operator = (const basic_mcs_mutex&) -> basic_mcs_mutex& = delete;
+
+        auto lock () -> void
+        {
+            const auto node = prepare(pool.acquire());
+
+            const auto predecessor = tail.exchange(node, std::memory_order::acq_rel);
+
+            if (predecessor == nullptr)
+            {
+                owner = node;
+
+                statistics.record(false, 0);
+
+                return;
+            }
+
+            predecessor->next.store(node, std::memory_order::release);
+
+            auto spins = std::int64_t { 0 };
+
+            while (spins < spin_budget)
+            {
+                if (node->state.load(std::memory_order::acquire) == granted)
+                {
+                    owner = node;
+
+                    statistics.record(true, spins);
+
+                    return;
+                }
+
+                cxx::cpu_relax();
+
+                spins += 1;
+            }
+
+            // note: A thread announces, that it goes to sleep,
+            //       so that the thread handing the mcs_mutex over
+            //       does not have to call the .notify_one() otherwise.
+            //
+            auto expected = std::uint32_t { waiting };
+
+            if (node->state.compare_exchange_strong(expected, parked,
+                                                    std::memory_order::acquire,
+                                                    std::memory_order::acquire))
+            {
+                while (node->state.load(std::memory_order::acquire) != granted)
+                {
+                    node->state.wait(parked, std::memory_order::relaxed);
+                }
+            }
+
+            owner = node;
+
+            statistics.record(true, spins);
+        }
+
+        auto try_lock () -> bool
+        {
+            const auto node = prepare(pool.acquire());
+
+            auto expected = static_cast<node_type*>(nullptr);
+
+            if (tail.compare_exchange_strong(expected, node,
+                                             std::memory_order::acquire,
+                                             std::memory_order::relaxed))
+            {
+                owner = node;
+
+                statistics.record(false, 0);
+
+                return true;
+            }
+            else
+            {
+                pool.release(node);
+
+                return false;
+            }
+        }
+
+        auto unlock () noexcept -> void
+        {
+            const auto node = owner;
+
+            auto successor = node->next.load(std::memory_order::acquire);
+
+            if (successor == nullptr)
+            {
+                auto expected = node;
+
+                if (tail.compare_exchange_strong(expected, nullptr,
+                                                 std::memory_order::release,
+                                                 std::memory_order::relaxed))
+                {
+                    pool.release(node);
+
+                    return;
+                }
+
+                // note: Another thread has already enqueued its node,
+                //       but has not linked it to the node of this thread yet.
+                //
+                while ((successor = node->next.load(std::memory_order::acquire)) == nullptr)
+                {
+                    cxx::cpu_relax();
+                }
+            }
+
+            // note: As soon as the successor is granted the mcs_mutex,
+            //       its node might be reused, though never deleted,
+            //       thus the .notify_one() might wake up a thread waiting
+            //       on another mcs_mutex, which is harmless, because all of
+            //       the waits are performed in loops, which check the state
+            //       of a node.
+            //
+            if (successor->state.exchange(granted, std::memory_order::release) == parked)
+            {
+                successor->state.notify_one();
+            }
+
+            pool.release(node);
+        }
+
+        [[nodiscard]]
+        auto stats () const noexcept -> const statistics_type&
+        {
+            return statistics;
+        }
+    };
+
+
+    using mcs_mutex = cxx::basic_mcs_mutex<>;
+}
+
+
+#endif
@@ -0,0 +1,473 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef CXX_PARALLEL
+#define CXX_PARALLEL
+
+
+#include <cxx/executor.hxx>
+
+#include <cxx/latch.hxx>
+
+#include <cxx/chunk_evenly.hxx>
+
+#include <cxx/ranges.hxx>
+
+#include <concepts>
+
+#include <functional>
+
+#include <cstddef>
+
+#include <utility>
+
+#include <exception>
+
+#include <atomic>
+
+#include <optional>
+
+#include <algorithm>
+
+#include <numeric>
+
+#include <iterator>
+
+#include <ranges>
+
+#include <vector>
+
+#include <thread>
+
+
+namespace cxx::parallel::detail
+{
+    inline auto default_chunk_count () noexcept -> std::ptrdiff_t
+    {
+        const auto thread_count = std::thread::hardware_concurrency();
+
+        return (thread_count != 0) ? std::ptrdiff_t { thread_count } : 1;
+    }
+
+
+    // note: The split() divides a range into at most chunk_count chunks,
+    //       with sizes differing by at most one element,
+    //       and skips empty chunks, so that no task is wasted on them.
+    //
+    template <cxx::ranges::sized_random_access_range range_type>
+    auto split (range_type& range, const std::ptrdiff_t chunk_count)
+    {
+        using chunk_type = std::ranges::subrange<std::ranges::iterator_t<range_type>>;
+
+        const auto range_size = std::ptrdiff_t { std::ranges::ssize(range) };
+
+        auto chunks = std::vector<chunk_type> { };
+
+        if (range_size != 0)
+        {
+            const auto count = std::min(chunk_count, range_size);
+
+            chunks.reserve(count);
+
+            for (auto chunk : std::views::all(range) | cxx::chunk_evenly(count))
+            {
+                chunks.emplace_back(chunk.begin(), chunk.end());
+            }
+        }
+
+        return chunks;
+    }
+
+
+    // note: The fork_join_state is shared by the tasks and the calling thread,
+    //       and released by whichever of them is done with it last,
+    //       because a task still notifies the latch after opening it,
+    //       when the calling thread may already have returned.
+    //
+    class fork_join_state
+    {
+    private:
+        std::atomic<std::ptrdiff_t> references;
+
+    public:
+        cxx::latch                  latch;
+        std::atomic_flag            error_flag;
+        std::exception_ptr          error;
+
+        explicit fork_join_state (const std::ptrdiff_t task_count) noexcept
+        :
+            references { task_count + 1 },
+            latch      { task_count     },
+            error_flag {                },
+            error      {                }
+        {
+        }
+
+        auto release (const std::ptrdiff_t count = 1) noexcept -> void
+        {
+            if (references.fetch_sub(count, std::memory_order::acq_rel) == count)
+            {
+                delete this;
+            }
+        }
+    };
+
+
+    // note: The fork_join() submits task_count tasks to the executor,
+    //       each invoking the function with a distinct index
+    //       in the [0, task_count) range, and then waits until all of them
+    //       have completed, rethrowing the first exception, if any was thrown.
+    //
+    //       When submitting a task throws, the tasks, which have already
+    //       been submitted, are waited for, since they refer to the function,
+    //       before the exception thrown by the executor is rethrown.
+    //
+    //       Since the calling thread is blocked until then,
+    //       fork_join() must not be called from within a task executed
+    //       by an executor with fewer threads than task_count,
+    //       otherwise the tasks might never get executed.
+    //
+    template <typename function_type>
+    auto fork_join (cxx::executor auto&  executor,
+                    const std::ptrdiff_t task_count,
+                    function_type&&        function) -> void
+    {
+        if (task_count == 0)
+        {
+            return;
+        }
+
+        const auto state = new detail::fork_join_state { task_count };
+
+        auto submitted = std::ptrdiff_t { 0 };
+
+        try
+        {
+            for (; submitted != task_count; ++submitted)
+            {
+                executor.submit([state, &function, index = submitted] () noexcept -> void
+                {
+                    try
+                    {
+                        std::invoke(function, index);
+                    }
+                    catch (...)
+                    {
+                        if (!state->error_flag.test_and_set(std::memory_order::relaxed))
+                        {
+                            state->error = std::current_exception();
+                        }
+                    }
+
+                    state->latch.arrive();
+                    state->release();
+                });
+            }
+        }
+        catch (...)
+        {
+            const auto unsubmitted = task_count - submitted;
+
+            state->latch.arrive(unsubmitted);
+            state->latch.wait();
+            state->release(unsubmitted + 1);
+
+            throw;
+        }
+
+        // note: The cxx::latch::wait() performs an acquire operation,
+        //       which ensures visibility of the error, as well as
+        //       of all other side effects of the tasks.
+        //
+        state->latch.wait();
+
+        const auto error = state->error;
+
+        state->release();
+
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+
+namespace cxx::parallel
+{
+    // [C++ reference] - Execution policies
+    // ~ https://en.cppreference.com/w/cpp/algorithm/execution_policy_tag_t
+    //
+    // [Intel] - oneTBB: Parallel algorithms
+    // ~ https://oneapi-src.github.io/oneTBB/main/tbb_userguide/parallel_for.html
+    //
+    // [NVIDIA] - Bryce Adelstein Lelbach: The C++ Execution Model
+    // ~ https://www.youtube.com/watch?v=FJIn1YhPJJc
+    //
+    // [Wikipedia] - Prefix sum: Parallel algorithms
+    // ~ https://en.wikipedia.org/wiki/Prefix_sum#Parallel_algorithms
+
+
+    // note: Algorithms in the cxx::parallel namespace
+    //       divide a random access range evenly into chunks,
+    //       using the cxx::chunk_evenly view, and submit one task per chunk
+    //       to the given executor, instead of relying on execution policies.
+    //
+    //       By default, the number of chunks equals to the number of
+    //       hardware threads, but it can be adjusted by the chunk_count,
+    //       to match the number of threads of the executor.
+    //
+    template <cxx::ranges::sized_random_access_range range_type,
+              typename                            function_type>
+    //
+    requires std::invocable<function_type&, std::ranges::range_reference_t<range_type>>
+    //
+    auto for_each (cxx::executor auto&  executor,
+                   range_type&&         range,
+                   function_type        function,
+                   const std::ptrdiff_t chunk_count = detail::default_chunk_count())
+    -> void
+    {
+        const auto chunks = detail::split(range, chunk_count);
+
+        detail::fork_join(executor, std::ssize(chunks),
+                          [&] (const std::ptrdiff_t chunk_index) -> void
+                          {
+                              for (auto&& element : chunks[chunk_index])
+                              {
+                                  std::invoke(function, element);
+                              }
+                          });
+    }
+
+
+    // note: The reduce_function must be associative,
+    //       but *not* necessarily commutative, since partial results
+    //       of chunks are always combined in the order of chunks.
+    //
+    template <cxx::ranges::sized_random_access_range range_type,
+              std::move_constructible                value_type,
+              typename                      reduce_function,
+              typename                   transform_function>
+    //
+    requires std::regular_invocable<transform_function&,
+                                    std::ranges::range_reference_t<range_type>>
+    //
+    auto transform_reduce (cxx::executor auto&  executor,
+                           range_type&&         range,
+                           value_type           init,
+                           reduce_function      reduce,
+                           transform_function   transform,
+                           const std::ptrdiff_t chunk_count = detail::default_chunk_count())
+    -> value_type
+    {
+        const auto chunks = detail::split(range, chunk_count);
+
+        auto partial_results = std::vector<std::optional<value_type>>(chunks.size());
+
+        detail::fork_join(executor, std::ssize(chunks),
+                          [&] (const std::ptrdiff_t chunk_index) -> void
+                          {
+                              const auto& chunk = chunks[chunk_index];
+
+                              auto it = chunk.begin();
+
+                              auto partial_result = value_type(std::invoke(transform, *it));
+
+                              for (++it; it != chunk.end(); ++it)
+                              {
+                                  partial_result = std::invoke(reduce,
+                                                               std::move(partial_result),
+                                                               std::invoke(transform, *it));
+                              }
+
+                              partial_results[chunk_index].emplace(std::move(partial_result));
+                          });
+
+        for (auto& partial_result : partial_results)
+        {
+            init = std::invoke(reduce, std::move(init), std::move(*partial_result));
+        }
+
+        return init;
+    }
+
+
+    // note: The inclusive_scan() performs two parallel passes:
+    //
+    //       1. every chunk is scanned independently into the output
+    //       2. every chunk, except the first one, is offset by the total
+    //          of all preceding chunks, which is computed sequentially
+    //          from the last output elements of these chunks
+    //
+    //       Therefore, the binary_function must be associative.
+    //
+    template <cxx::ranges::sized_random_access_range range_type,
+              std::random_access_iterator        output_iterator,
+              typename                           binary_function = std::plus<>>
+    //
+    requires std::indirectly_copyable<std::ranges::iterator_t<range_type>, output_iterator>
+    //
+    auto inclusive_scan (cxx::executor auto&  executor,
+                         range_type&&         range,
+                         output_iterator      output,
+                         binary_function      binary_op   = { },
+                         const std::ptrdiff_t chunk_count = detail::default_chunk_count())
+    -> output_iterator
+    {
+        const auto chunks = detail::split(range, chunk_count);
+
+        const auto range_begin = std::ranges::begin(range);
+
+        const auto output_of = [&] (const auto& chunk) -> output_iterator
+        {
+            return output + (chunk.begin() - range_begin);
+        };
+
+        detail::fork_join(executor, std::ssize(chunks),
+                          [&] (const std::ptrdiff_t chunk_index) -> void
+                          {
+                              const auto& chunk = chunks[chunk_index];
+
+                              std::inclusive_scan(chunk.begin(), chunk.end(),
+                                                  output_of(chunk), binary_op);
+                          });
+
+        using value_type = std::iter_value_t<output_iterator>;
+
+        auto offsets = std::vector<std::optional<value_type>>(chunks.size());
+
+        for (auto chunk_index = std::size_t { 1 }; chunk_index < chunks.size(); ++chunk_index)
+        {
+            const auto& previous = chunks[chunk_index - 1];
+
+            auto previous_total = value_type(*(output_of(previous) + (previous.size() - 1)));
+
+            offsets[chunk_index].emplace((chunk_index == 1)
+                                         ? std::move(previous_total)
+                                         : std::invoke(binary_op,
+                                                       *offsets[chunk_index - 1],
+                                                       std::move(previous_total)));
+        }
+
+        detail::fork_join(executor, std::max(std::ssize(chunks) - 1, std::ptrdiff_t { 0 }),
+                          [&] (const std::ptrdiff_t task_index) -> void
+                          {
+                              const auto  chunk_index = task_index + 1;
+                              const auto& chunk       = chunks[chunk_index];
+                              const auto& offset      = *offsets[chunk_index];
+
+                              const auto first = output_of(chunk);
+                              const auto last  = first + chunk.size();
+
+                              for (auto it = first; it != last; ++it)
+                              {
+                                  *it = std::invoke(binary_op, offset, std::move(*it));
+                              }
+                          });
+
+        return output + std::ranges::ssize(range);
+    }
+
+
+    // note: The sort() sorts every chunk independently,
+    //       and then merges pairs of adjacent sorted chunks in parallel,
+    //       halving the number of chunks in every round.
+    //
+    template <cxx::ranges::sized_random_access_range range_type,
+              typename                               compare_type = std::ranges::less>
+    //
+    requires std::sortable<std::ranges::iterator_t<range_type>, compare_type>
+    //
+    auto sort (cxx::executor auto&  executor,
+               range_type&&         range,
+               compare_type         compare     = { },
+               const std::ptrdiff_t chunk_count = detail::default_chunk_count())
+    -> void
+    {
+        const auto chunks = detail::split(range, chunk_count);
+
+        detail::fork_join(executor, std::ssize(chunks),
+                          [&] (const std::ptrdiff_t chunk_index) -> void
+                          {
+                              std::ranges::sort(chunks[chunk_index], compare);
+                          });
+
+        auto borders = std::vector<std::ranges::iterator_t<range_type>> { };
+
+        borders.reserve(chunks.size() + 1);
+
+        for (const auto& chunk : chunks)
+        {
+            borders.push_back(chunk.begin());
+        }
+
+        if (!chunks.empty())
+        {
+            borders.push_back(chunks.back().end());
+        }
+
+        while (std::ssize(borders) > 2) // more than one sorted chunk
+        {
+            const auto merge_count = (std::ssize(borders) - 1) / 2;
+
+            detail::fork_join(executor, merge_count,
+                              [&] (const std::ptrdiff_t merge_index) -> void
+                              {
+                                  std::ranges::inplace_merge(borders[2 * merge_index + 0],
+                                                             borders[2 * merge_index + 1],
+                                                             borders[2 * merge_index + 2],
+                                                             compare);
+                              });
+
+            auto merged_borders = std::vector<std::ranges::iterator_t<range_type>> { };
+
+            for (auto index = std::size_t { 0 }; index < borders.size(); index += 2)
+            {
+                merged_borders.push_back(borders[index]);
+            }
+
+            if (merged_borders.back() != borders.back())
+            {
+                merged_borders.push_back(borders.back());
+            }
+
+            borders = std::move(merged_borders);
+        }
+    }
+}
+
+
+#endif
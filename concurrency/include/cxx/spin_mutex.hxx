@@ -37,6 +37,14 @@
 #define CXX_SPIN_MUTEX
 
 
+#include <cxx/cpu_relax.hxx>
+
+#include <cxx/lock_statistics.hxx>
+
+#include <algorithm>
+
+#include <cstdint>
+
 #include <atomic>
 
 
@@ -66,81 +74,186 @@ namespace cxx
     //
     // ~ https://en.cppreference.com/w/cpp/atomic/atomic_flag
 
-    class spin_mutex
+    // [Ulrich Drepper] - Futexes Are Tricky
+    //
+    // ~ https://www.akkadia.org/drepper/futex.pdf
+
+    // [WebKit] - Filip Pizlo: Locking in WebKit
+    //
+    // ~ https://webkit.org/blog/6161/locking-in-webkit
+
+    // [Wikipedia] - Test and test-and-set
+    //
+    // ~ https://en.wikipedia.org/wiki/Test_and_test-and-set
+
+    template <typename statistics_type = cxx::no_lock_statistics>
+    class basic_spin_mutex
     {
     private:
-        std::atomic_flag flag = ATOMIC_FLAG_INIT; // note: initialize to false
+        // note: In contrast to a std::atomic_flag, the state of the spin_mutex
+        //       distinguishes whether any thread might be sleeping,
+        //       waiting to lock the spin_mutex, which enables the unlock()
+        //       to skip the .notify_one(), when the spin_mutex is uncontended.
+        //
+        enum state_type : std::uint32_t
+        {
+            unlocked,
+            locked,
+            locked_with_waiters,
+        };
 
-    public:
-        auto lock () noexcept -> void
+        static constexpr auto max_backoff = std::int64_t { 64 };
+
+        std::atomic<std::uint32_t>                  state;
+        std::int64_t                          spin_budget;
+
+        [[no_unique_address]]
+        statistics_type                        statistics;
+
+        auto try_acquire () noexcept -> bool
         {
-            // note: To try to lock the spin_mutex,
-            //       a thread unconditionally sets the atomic_flag to true.
+            // note: Test and test-and-set.
             //
-            //       Consider the following scenarios:
+            //       The plain load does not request exclusive ownership
+            //       of the cache line, thus spinning threads
+            //       do not invalidate it in the cache of the thread
+            //       holding the spin_mutex, until it seems to be unlocked.
             //
-            //       - if the previous value was false,
-            //         the spin_mutex was previously unlocked,
-            //         and it has been successfully locked,
-            //         thus the while loops ends
+            auto expected = std::uint32_t { unlocked };
+
+            return (state.load(std::memory_order::relaxed) == unlocked) &&
+                    state.compare_exchange_strong(expected, locked,
+                                                  std::memory_order::acquire,
+                                                  std::memory_order::relaxed);
+        }
+
+    public:
+        static constexpr auto default_spin_budget = std::int64_t { 256 };
+
+        constexpr basic_spin_mutex () noexcept
+        :
+            basic_spin_mutex { default_spin_budget }
+        {
+        }
+
+        // note: The spin_budget limits the number of cxx::cpu_relax()
+        //       iterations, which a thread performs while spinning,
+        //       before it goes to sleep.
+        //
+        //       A spin_budget of 0 disables spinning entirely,
+        //       which is suitable for critical sections,
+        //       which are longer than a sleep and a wakeup.
+        //
+        constexpr explicit basic_spin_mutex (const std::int64_t spin_budget) noexcept
+        :
+            state       { unlocked    },
+            spin_budget { spin_budget },
+            statistics  {             }
+        {
+        }
+
+        basic_spin_mutex (const basic_spin_mutex&) = delete;
+
+        auto operator = (const basic_spin_mutex&) -> basic_spin_mutex& = delete;
+
+        auto lock () noexcept -> void
+        {
+            if (try_acquire())
+            {
+                statistics.record(false, 0);
+
+                return;
+            }
+
+            // note: Spin with exponential backoff,
+            //       doubling the number of cxx::cpu_relax() calls
+            //       between two attempts to lock the spin_mutex,
+            //       to reduce traffic on the cache line of the spin_mutex,
+            //       when many threads are contending for it.
             //
-            //       - if the previous value was true,
-            //         the spin_mutex is currently locked by another thread,
-            //         thus the while loops continues and
-            //         the thread trying to lock the spin_mutex
-            //         goes to sleep until it will be woken up by
-            //         the thread that has locked the spin_mutex
+            auto spins   = std::int64_t { 0 };
+            auto backoff = std::int64_t { 1 };
+
+            while (spins < spin_budget)
+            {
+                for (auto n = std::int64_t { 0 }; n != backoff; ++n)
+                {
+                    cxx::cpu_relax();
+                }
+
+                spins  += backoff;
+                backoff = std::min(2 * backoff, max_backoff);
+
+                if (try_acquire())
+                {
+                    statistics.record(true, spins);
+
+                    return;
+                }
+            }
+
+            // note: When the spin_budget is exhausted, a thread goes to sleep,
+            //       after marking the spin_mutex as locked_with_waiters.
             //
-            //       The scenario in which,
-            //       a thread that has already locked a spin_mutex,
-            //       attempts to lock it again is considered
-            //       an undefined behaviour (a programming error),
-            //       and therefore does not need to be considered.
+            //       Since a thread, which has been woken up, cannot know
+            //       whether there are other threads still sleeping,
+            //       it conservatively locks the spin_mutex as locked_with_waiters,
+            //       which costs at most one superfluous .notify_one().
             //
-            while (flag.test_and_set(std::memory_order_acquire))
+            while (state.exchange(locked_with_waiters,
+                                  std::memory_order::acquire) != unlocked)
             {
-                flag.wait(true, std::memory_order_relaxed);
+                state.wait(locked_with_waiters, std::memory_order::relaxed);
             }
+
+            statistics.record(true, spins);
         }
 
         auto try_lock () noexcept -> bool
         {
-            return !flag.test_and_set(std::memory_order_acquire);
+            if (try_acquire())
+            {
+                statistics.record(false, 0);
+
+                return true;
+            }
+            else
+            {
+                return false;
+            }
         }
 
         auto unlock () noexcept -> void
         {
             // note: To unlock the spin_mutex
-            //       a thread sets the atomic_flag to false, and then
+            //       a thread sets its state to unlocked, and then
             //
             //       notifies one of the threads
             //       waiting to lock the spin_mutex to wake up,
-            //       assuming such a thread exists.
-            //
-            flag.clear(std::memory_order_release);
-            flag.notify_one();
-            //
-            // note: Even though, the above .notify_one()
-            //       will not wake up a thread
-            //       in the case when another thread will call .test_and_set()
-            //       between .clear() and .notify_one() calls,
-            //
-            //       the list of threads waiting to lock the spin_mutex
-            //       will not experience an unlimited growth, because:
+            //       but only if such a thread might exist,
+            //       thus avoiding a system call in the uncontended case.
             //
-            //        - the .try_lock() does never put any threads to sleep,
-            //          that is, it never increases the length of that list
+            if (state.exchange(unlocked, std::memory_order::release) == locked_with_waiters)
+            {
+                state.notify_one();
+            }
             //
-            //        - the .lock() is also guaranteed to do not put to sleep
-            //          the thread that was trying to lock the spin_mutex,
-            //          since in this case the while loop
-            //          in the .lock() member function will end immediately,
-            //          due to the .test_and_set() call returning false,
-            //          that is, the previous value of the atomic_flag
-            //          established by the .clear() call
-            //          at the beginning of the .unlock() member function.
+            // note: A thread, which goes to sleep, always sets
+            //       the state to locked_with_waiters *before* it sleeps,
+            //       and the .wait() returns immediately,
+            //       when the state has changed in the meantime,
+            //       thus the above .notify_one() cannot be missed.
+        }
+
+        [[nodiscard]]
+        auto stats () const noexcept -> const statistics_type&
+        {
+            return statistics;
         }
     };
+
+
+    using spin_mutex = cxx::basic_spin_mutex<>;
 }
 
 
@@ -0,0 +1,486 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef CXX_TASK
+#define CXX_TASK
+
+
+#include <cxx/executor.hxx>
+
+#include <cxx/coroutine_frame.hxx>
+
+#include <coroutine>
+
+#include <exception>
+
+#include <optional>
+
+#include <utility>
+
+#include <variant>
+
+#include <atomic>
+
+
+namespace cxx
+{
+    // [Lewis Baker] - C++ Coroutines: Understanding Symmetric Transfer
+    //
+    // ~ https://lewissbaker.github.io/2020/05/11/understanding_symmetric_transfer
+
+    // [GitHub] - Lewis Baker: cppcoro
+    //
+    // ~ https://github.com/lewissbaker/cppcoro
+
+    // [ISO C++] - P1056R1: Add lazy coroutine (coroutine task) type
+    //
+    // ~ https://www.open-std.org/jtc1/sc22/wg21/docs/papers/2019/p1056r1.html
+
+    template <typename value_type = void>
+    class task;
+
+
+    namespace detail
+    {
+        class task_promise_base : public cxx::pooled_coroutine_frame
+        {
+        private:
+            // note: The final_awaiter resumes the awaiting coroutine,
+            //       by returning its handle from the await_suspend(),
+            //       which is a tail call (symmetric transfer),
+            //       thus arbitrarily long chains of tasks
+            //       completing synchronously do not grow the stack.
+            //
+            struct final_awaiter
+            {
+                auto await_ready () const noexcept -> bool
+                {
+                    return false;
+                }
+
+                template <typename promise_type>
+                auto await_suspend (const std::coroutine_handle<promise_type> coroutine) noexcept
+                                                                    -> std::coroutine_handle<>
+                {
+                    const auto continuation = coroutine.promise().continuation;
+
+                    if (continuation)
+                    {
+                        return continuation;
+                    }
+                    else
+                    {
+                        return std::noop_coroutine();
+                    }
+                }
+
+                auto await_resume () const noexcept -> void
+                {
+                }
+            };
+
+        public:
+            std::coroutine_handle<> continuation;
+
+            auto initial_suspend () const noexcept -> std::suspend_always
+            {
+                return { };
+            }
+
+            auto final_suspend () const noexcept -> final_awaiter
+            {
+                return { };
+            }
+        };
+
+
+        template <typename value_type>
+        class task_promise : public detail::task_promise_base
+        {
+        private:
+            std::variant<std::monostate, value_type, std::exception_ptr> result;
+
+        public:
+            auto get_return_object () noexcept -> cxx::task<value_type>;
+
+            template <typename type>
+            requires std::convertible_to<type&&, value_type>
+            //
+            auto return_value (type&& value) -> void
+            {
+                result.template emplace<1>(std::forward<type>(value));
+            }
+
+            auto unhandled_exception () noexcept -> void
+            {
+                result.template emplace<2>(std::current_exception());
+            }
+
+            auto take () -> value_type
+            {
+                if (result.index() == 2)
+                {
+                    std::rethrow_exception(std::get<2>(result));
+                }
+
+                return std::move(std::get<1>(result));
+            }
+        };
+
+
+        template <>
+        class task_promise <void> : public detail::task_promise_base
+        {
+        private:
+            std::exception_ptr exception;
+
+        public:
+            auto get_return_object () noexcept -> cxx::task<void>;
+
+            auto return_void () const noexcept -> void
+            {
+            }
+
+            auto unhandled_exception () noexcept -> void
+            {
+                exception = std::current_exception();
+            }
+
+            auto take () const -> void
+            {
+                if (exception)
+                {
+                    std::rethrow_exception(exception);
+                }
+            }
+        };
+    }
+
+
+    // note: The cxx::task is lazy, that is its coroutine starts,
+    //       only when the task is awaited, and then runs on the thread
+    //       of the awaiting coroutine, until it hops onto an executor,
+    //       by awaiting cxx::schedule(executor).
+    //
+    //       When the coroutine of a task completes,
+    //       the awaiting coroutine is resumed on the same thread.
+    //
+    template <typename value_type>
+    class [[nodiscard]] task
+    {
+    public:
+        using promise_type = detail::task_promise<value_type>;
+
+    private:
+        std::coroutine_handle<promise_type> coroutine;
+
+        struct awaiter
+        {
+            std::coroutine_handle<promise_type> coroutine;
+
+            auto await_ready () const noexcept -> bool
+            {
+                return false;
+            }
+
+            auto await_suspend (const std::coroutine_handle<> awaiting) noexcept
+                                                          -> std::coroutine_handle<>
+            {
+                coroutine.promise().continuation = awaiting;
+
+                return coroutine;
+            }
+
+            auto await_resume () -> value_type
+            {
+                return coroutine.promise().take();
+            }
+        };
+
+        explicit task (const std::coroutine_handle<promise_type> coroutine) noexcept
+        :
+            coroutine { coroutine }
+        {
+        }
+
+        friend promise_type;
+
+    public:
+        task (const task&) = delete;
+
+        auto operator = (const task&) -> task& = delete;
+
+        task (task&& other) noexcept
+        :
+            coroutine { std::exchange(other.coroutine, nullptr) }
+        {
+        }
+
+        auto operator = (task&& other) noexcept -> task&
+        {
+            if (coroutine)
+            {
+                coroutine.destroy();
+            }
+
+            coroutine = std::exchange(other.coroutine, nullptr);
+
+            return *this;
+        }
+
+        ~task () noexcept
+        {
+            if (coroutine)
+            {
+                coroutine.destroy();
+            }
+        }
+
+        auto operator co_await () && noexcept -> awaiter
+        {
+            return awaiter { coroutine };
+        }
+    };
+
+
+    namespace detail
+    {
+        template <typename value_type>
+        auto task_promise<value_type>::get_return_object () noexcept -> cxx::task<value_type>
+        {
+            return cxx::task<value_type>
+                   {
+                       std::coroutine_handle<task_promise>::from_promise(*this)
+                   };
+        }
+
+        inline auto task_promise<void>::get_return_object () noexcept -> cxx::task<void>
+        {
+            return cxx::task<void>
+                   {
+                       std::coroutine_handle<task_promise>::from_promise(*this)
+                   };
+        }
+    }
+
+
+    template <cxx::executor executor_type>
+    class schedule_awaiter
+    {
+    private:
+        executor_type* executor;
+
+    public:
+        explicit schedule_awaiter (executor_type& executor) noexcept
+        :
+            executor { &executor }
+        {
+        }
+
+        auto await_ready () const noexcept -> bool
+        {
+            return false;
+        }
+
+        auto await_suspend (const std::coroutine_handle<> coroutine) -> void
+        {
+            executor->submit([coroutine] () -> void { coroutine.resume(); });
+        }
+
+        auto await_resume () const noexcept -> void
+        {
+        }
+    };
+
+
+    // note: co_await cxx::schedule(executor) resumes the awaiting coroutine
+    //       on a thread of the executor.
+    //
+    template <cxx::executor executor_type>
+    auto schedule (executor_type& executor) noexcept -> cxx::schedule_awaiter<executor_type>
+    {
+        return cxx::schedule_awaiter<executor_type> { executor };
+    }
+
+
+    namespace detail
+    {
+        // note: The sync_wait_task starts eagerly and signals its completion
+        //       through a flag kept in its own coroutine frame, rather than
+        //       on the stack of the waiting thread, which may return as soon
+        //       as the flag is set, while the notification is still running.
+        //       The frame is destroyed by whichever of the completing
+        //       coroutine and the waiting thread is done with it last.
+        //
+        class sync_wait_task
+        {
+        public:
+            struct promise_type : cxx::pooled_coroutine_frame
+            {
+                std::atomic_flag complete;
+                std::atomic_flag released;
+
+                struct final_awaiter
+                {
+                    auto await_ready () const noexcept -> bool
+                    {
+                        return false;
+                    }
+
+                    auto await_suspend (const std::coroutine_handle<promise_type> coroutine) const noexcept
+                                                                                                -> void
+                    {
+                        auto& promise = coroutine.promise();
+
+                        promise.complete.test_and_set(std::memory_order::release);
+                        promise.complete.notify_one();
+
+                        if (promise.released.test_and_set(std::memory_order::acq_rel))
+                        {
+                            coroutine.destroy();
+                        }
+                    }
+
+                    auto await_resume () const noexcept -> void
+                    {
+                    }
+                };
+
+                auto get_return_object () noexcept -> sync_wait_task
+                {
+                    return sync_wait_task { std::coroutine_handle<promise_type>::from_promise(*this) };
+                }
+
+                auto initial_suspend () const noexcept -> std::suspend_never
+                {
+                    return { };
+                }
+
+                auto final_suspend () const noexcept -> final_awaiter
+                {
+                    return { };
+                }
+
+                auto return_void () const noexcept -> void
+                {
+                }
+
+                auto unhandled_exception () const noexcept -> void
+                {
+                    std::terminate();
+                }
+            };
+
+        private:
+            std::coroutine_handle<promise_type> coroutine;
+
+            explicit sync_wait_task (const std::coroutine_handle<promise_type> coroutine) noexcept
+            :
+                coroutine { coroutine }
+            {
+            }
+
+        public:
+            sync_wait_task (const sync_wait_task&) = delete;
+            auto operator = (const sync_wait_task&) -> sync_wait_task& = delete;
+
+            auto wait () && noexcept -> void
+            {
+                auto& promise = coroutine.promise();
+
+                promise.complete.wait(false, std::memory_order::acquire);
+
+                if (promise.released.test_and_set(std::memory_order::acq_rel))
+                {
+                    coroutine.destroy();
+                }
+            }
+        };
+
+
+        template <typename value_type, typename result_type>
+        auto sync_wait_main (cxx::task<value_type>   task,
+                             std::optional<result_type>& result,
+                             std::exception_ptr&      exception) -> detail::sync_wait_task
+        {
+            try
+            {
+                if constexpr (std::is_void_v<value_type>)
+                {
+                    co_await std::move(task);
+
+                    result.emplace();
+                }
+                else
+                {
+                    result.emplace(co_await std::move(task));
+                }
+            }
+            catch (...)
+            {
+                exception = std::current_exception();
+            }
+        }
+    }
+
+
+    // note: Blocks the calling thread until the task completes,
+    //       and then either returns its result or rethrows its exception.
+    //
+    template <typename value_type>
+    auto sync_wait (cxx::task<value_type> task) -> value_type
+    {
+        using result_type = std::conditional_t<std::is_void_v<value_type>,
+                                               std::monostate, value_type>;
+
+        auto result    = std::optional<result_type> { };
+        auto exception = std::exception_ptr         { };
+
+        detail::sync_wait_main(std::move(task), result, exception).wait();
+
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+
+        if constexpr (!std::is_void_v<value_type>)
+        {
+            return std::move(*result);
+        }
+    }
+}
+
+
+#endif
@@ -41,6 +41,8 @@
 
 #include <cxx/concurrent_queue.hxx>
 
+#include <cxx/chunk_evenly.hxx>
+
 #include <concepts>
 
 #include <cstddef>
@@ -51,6 +53,10 @@
 
 #include <span>
 
+#include <ranges>
+
+#include <iterator>
+
 #include <vector>
 
 #include <functional>
@@ -162,6 +168,52 @@ namespace cxx
 
             task_queues[queue_index].push(std::move(task_value));
         }
+
+        // note: The submit_bulk() splits tasks evenly between all task queues,
+        //       so that each task queue is locked only once per bulk,
+        //       and only workers, which have received tasks, are woken up.
+        //
+        template <std::ranges::input_range range_type>
+        requires std::invocable<std::ranges::range_reference_t<range_type>>
+        //
+        auto submit_bulk (range_type&& tasks) -> void
+        {
+            auto task_values = std::vector<task_type> { };
+
+            if constexpr (std::ranges::sized_range<range_type>)
+            {
+                task_values.reserve(std::ranges::size(tasks));
+            }
+
+            for (auto&& task : tasks)
+            {
+                task_values.emplace_back(std::forward<decltype(task)>(task));
+            }
+
+            const auto queue_count = std::ssize(task_queues);
+
+            const auto submit_index = // round-robin scheduling of the first chunk
+                       submit_counter.fetch_add(1, std::memory_order::relaxed) + 1;
+
+            auto chunk_index = std::ptrdiff_t { 0 };
+
+            for (auto chunk : task_values | cxx::chunk_evenly(queue_count))
+            {
+                const auto queue_index = (submit_index + chunk_index) % queue_count;
+
+                if (!chunk.empty())
+                {
+                    task_queues[queue_index].push_range(
+                        std::ranges::subrange
+                        {
+                            std::make_move_iterator(chunk.begin()),
+                            std::make_move_iterator(chunk. end ()),
+                        });
+                }
+
+                ++chunk_index;
+            }
+        }
     };
 
     static_assert(cxx::executor<cxx::thread_pool>);
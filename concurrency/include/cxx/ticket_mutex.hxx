@@ -0,0 +1,219 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef CXX_TICKET_MUTEX
+#define CXX_TICKET_MUTEX
+
+
+#include <cxx/cache_line.hxx>
+
+#include <cxx/cpu_relax.hxx>
+
+#include <cxx/lock_statistics.hxx>
+
+#include <cstdint>
+
+#include <atomic>
+
+
+namespace cxx
+{
+    // [John M. Mellor-Crummey, Michael L. Scott] - Algorithms for Scalable
+    //                                              Synchronization on
+    //                                              Shared-Memory Multiprocessors
+    //
+    // ~ https://www.cs.rochester.edu/u/scott/papers/1991_TOCS_synch.pdf
+
+    // [Wikipedia] - Ticket lock
+    //
+    // ~ https://en.wikipedia.org/wiki/Ticket_lock
+
+    // note: In contrast to the cxx::spin_mutex, the ticket_mutex is fair,
+    //       that is threads acquire it in the order in which they
+    //       have started waiting for it (FIFO), hence no thread can starve.
+    //
+    //       However, all of the waiting threads still poll the same cache line,
+    //       thus every unlock() invalidates it in the caches of all of them,
+    //       which is addressed by the cxx::mcs_mutex.
+    //
+    template <typename statistics_type = cxx::no_lock_statistics>
+    class basic_ticket_mutex
+    {
+    private:
+        // note: Each of the counters is written by different threads,
+        //       the next_ticket by threads locking the ticket_mutex and
+        //       the now_serving by the thread unlocking the ticket_mutex,
+        //       thus they are kept in separate cache lines.
+        //
+        alignas(cxx::cache_line_size) std::atomic<std::uint32_t> next_ticket;
+        alignas(cxx::cache_line_size) std::atomic<std::uint32_t> now_serving;
+
+        std::int64_t                                             spin_budget;
+
+        [[no_unique_address]]
+        statistics_type                                           statistics;
+
+    public:
+        static constexpr auto default_spin_budget = std::int64_t { 256 };
+
+        constexpr basic_ticket_mutex () noexcept
+        :
+            basic_ticket_mutex { default_spin_budget }
+        {
+        }
+
+        constexpr explicit basic_ticket_mutex (const std::int64_t spin_budget) noexcept
+        :
+            next_ticket { 0           },
+            now_serving { 0           },
+            spin_budget { spin_budget },
+            statistics  {             }
+        {
+        }
+
+        basic_ticket_mutex (const basic_ticket_mutex&) = delete;
+
+        auto operator = (const basic_ticket_mutex&) -> basic_ticket_mutex& = delete;
+
+        auto lock () noexcept -> void
+        {
+            // note: The counters are allowed to wrap around,
+            //       because only their equality is ever checked.
+            //
+            const auto ticket = next_ticket.fetch_add(1, std::memory_order::seq_cst);
+
+            auto serving = now_serving.load(std::memory_order::seq_cst);
+
+            if (serving == ticket)
+            {
+                statistics.record(false, 0);
+
+                return;
+            }
+
+            // note: Proportional backoff.
+            //
+            //       A thread, which is further away from the front
+            //       of the queue, waits proportionally longer
+            //       before it polls the now_serving counter again.
+            //
+            auto spins = std::int64_t { 0 };
+
+            while (spins < spin_budget)
+            {
+                const auto distance = std::int64_t { std::uint32_t(ticket - serving) };
+
+                for (auto n = std::int64_t { 0 }; n != distance; ++n)
+                {
+                    cxx::cpu_relax();
+                }
+
+                spins  += distance;
+                serving = now_serving.load(std::memory_order::acquire);
+
+                if (serving == ticket)
+                {
+                    statistics.record(true, spins);
+
+                    return;
+                }
+            }
+
+            // note: Since every waiting thread waits for a different ticket,
+            //       the unlock() has to wake up all of the sleeping threads,
+            //       and all but one of them go back to sleep.
+            //
+            while (serving != ticket)
+            {
+                now_serving.wait(serving, std::memory_order::relaxed);
+
+                serving = now_serving.load(std::memory_order::seq_cst);
+            }
+
+            statistics.record(true, spins);
+        }
+
+        auto try_lock () noexcept -> bool
+        {
+            auto serving = now_serving.load(std::memory_order::relaxed);
+
+            if (next_ticket.compare_exchange_strong(serving, serving + 1,
+                                                    std::memory_order::acquire,
+                                                    std::memory_order::relaxed))
+            {
+                statistics.record(false, 0);
+
+                return true;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        auto unlock () noexcept -> void
+        {
+            const auto serving = now_serving.load(std::memory_order::relaxed) + 1;
+
+            now_serving.store(serving, std::memory_order::seq_cst);
+
+            // note: When no ticket has been taken after the one being served,
+            //       there is no waiting thread, thus the .notify_all() is skipped.
+            //
+            //       The sequentially consistent ordering guarantees,
+            //       that either the load of the next_ticket below
+            //       observes the ticket of a thread, which is just locking
+            //       the ticket_mutex, or that thread observes
+            //       the new value of the now_serving counter.
+            //
+            if (next_ticket.load(std::memory_order::seq_cst) != serving)
+            {
+                now_serving.notify_all();
+            }
+        }
+
+        [[nodiscard]]
+        auto stats () const noexcept -> const statistics_type&
+        {
+            return statistics;
+        }
+    };
+
+
+    using ticket_mutex = cxx::basic_ticket_mutex<>;
+}
+
+
+#endif
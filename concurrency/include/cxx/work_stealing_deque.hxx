@@ -0,0 +1,295 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef CXX_WORK_STEALING_DEQUE
+#define CXX_WORK_STEALING_DEQUE
+
+
+#include <cxx/cache_line.hxx>
+
+#include <type_traits>
+
+#include <cstddef>
+
+#include <memory>
+
+#include <atomic>
+
+#include <optional>
+
+#include <cassert>
+
+
+namespace cxx
+{
+    // [ACM SPAA 2005] - David Chase, Yossi Lev:
+    //                   Dynamic Circular Work-Stealing Deque
+    // ~ https://www.dre.vanderbilt.edu/~schmidt/PDF/work-stealing-dequeue.pdf
+    //
+    // [ACM PPoPP 2013] - Nhat Minh Lê, Antoniu Pop, Albert Cohen, Francesco Zappa Nardelli:
+    //                    Correct and Efficient Work-Stealing for Weak Memory Models
+    // ~ https://fzn.fr/readings/ppopp13.pdf
+    //
+    // [GitHub] - Tsung-Wei Huang: Taskflow
+    // ~ https://github.com/taskflow/taskflow/blob/master/taskflow/core/tsq.hpp
+
+
+    // note: The cxx::work_stealing_deque<> is a single-producer
+    //       multi-consumer lock-free deque, in which:
+    //
+    //       - the owner thread pushes and pops values at the bottom (LIFO)
+    //       - any other thread steals values from the top (FIFO)
+    //
+    //                  steal()                      push() / pop()
+    //                     |                                |
+    //                     v                                v
+    //            +-------+-------+-------+-------+-------+-------+
+    //            |       | value | value | value | value |       |
+    //            +-------+-------+-------+-------+-------+-------+
+    //                      ^                               ^
+    //                     top                            bottom
+    //
+    //       Values are stored in atomic slots of a circular array,
+    //       therefore only trivially copyable values,
+    //       such as pointers or indices, are supported.
+    //
+    //       Since a thief can read a slot of a circular array,
+    //       which has just been replaced by a bigger one,
+    //       the replaced circular arrays are kept alive
+    //       until the cxx::work_stealing_deque<> is destroyed.
+    //
+    template <typename value_type>
+    requires std::is_trivially_copyable_v<value_type> &&
+             std::atomic<value_type>::is_always_lock_free
+    //
+    class work_stealing_deque
+    {
+    private:
+        struct circular_array
+        {
+            std::ptrdiff_t                              capacity;
+            std::unique_ptr<std::atomic<value_type>[]>     slots;
+            std::unique_ptr<circular_array>             previous;
+
+            explicit circular_array (const std::ptrdiff_t capacity)
+            :
+                capacity { capacity                                     },
+                slots    { new std::atomic<value_type>[capacity] { }    },
+                previous { nullptr                                      }
+            {
+                assert((capacity > 0) && ((capacity & (capacity - 1)) == 0));
+            }
+
+            auto load (const std::ptrdiff_t index) const noexcept -> value_type
+            {
+                return slots[index & (capacity - 1)].load(std::memory_order::relaxed);
+            }
+
+            auto store (const std::ptrdiff_t index,
+                        const value_type     value) noexcept -> void
+            {
+                slots[index & (capacity - 1)].store(value, std::memory_order::relaxed);
+            }
+        };
+
+        // note: The top index is modified by thieves,
+        //       while the bottom index is modified only by the owner,
+        //       thus both of them are placed in separate cache lines.
+        //
+        alignas(cxx::cache_line_size) std::atomic<std::ptrdiff_t>       top;
+        alignas(cxx::cache_line_size) std::atomic<std::ptrdiff_t>    bottom;
+                                      std::atomic<circular_array*>    array;
+                                      std::unique_ptr<circular_array> owned;
+
+        auto grow (circular_array* const old_array,
+                   const std::ptrdiff_t  top_index,
+                   const std::ptrdiff_t  bottom_index) -> circular_array*
+        {
+            auto new_array = std::make_unique<circular_array>(2 * old_array->capacity);
+
+            for (auto index = top_index; index != bottom_index; ++index)
+            {
+                new_array->store(index, old_array->load(index));
+            }
+
+            new_array->previous = std::move(owned);
+            owned               = std::move(new_array);
+
+            array.store(owned.get(), std::memory_order::release);
+
+            return owned.get();
+        }
+
+    public:
+        explicit work_stealing_deque (const std::ptrdiff_t capacity = 256)
+        :
+            top    { 0                                           },
+            bottom { 0                                           },
+            array  { nullptr                                     },
+            owned  { std::make_unique<circular_array>(capacity)  }
+        {
+            array.store(owned.get(), std::memory_order::relaxed);
+        }
+
+        ~work_stealing_deque () noexcept = default;
+
+        work_stealing_deque (const work_stealing_deque&) = delete;
+
+        auto operator = (const work_stealing_deque&) -> work_stealing_deque& = delete;
+
+        // note: Can be called only by the owner thread.
+        //
+        auto push (const value_type value) -> void
+        {
+            const auto bottom_index = bottom.load(std::memory_order::relaxed);
+            const auto    top_index =    top.load(std::memory_order::acquire);
+
+            auto* current_array = array.load(std::memory_order::relaxed);
+
+            if (bottom_index - top_index > current_array->capacity - 1)
+            {
+                current_array = grow(current_array, top_index, bottom_index);
+            }
+
+            current_array->store(bottom_index, value);
+
+            // note: The release fence guarantees that a thief,
+            //       which observes the incremented bottom index,
+            //       will also observe the value stored in the slot.
+            //
+            std::atomic_thread_fence(std::memory_order::release);
+
+            bottom.store(bottom_index + 1, std::memory_order::relaxed);
+        }
+
+        // note: Can be called only by the owner thread.
+        //
+        auto pop () noexcept -> std::optional<value_type>
+        {
+            const auto bottom_index = bottom.load(std::memory_order::relaxed) - 1;
+
+            auto* const current_array = array.load(std::memory_order::relaxed);
+
+            bottom.store(bottom_index, std::memory_order::relaxed);
+
+            // note: The sequentially consistent fence orders
+            //       the store to the bottom index before the load of the top index,
+            //       so that the owner and a thief cannot both take the last value.
+            //
+            std::atomic_thread_fence(std::memory_order::seq_cst);
+
+            auto top_index = top.load(std::memory_order::relaxed);
+
+            if (top_index <= bottom_index) // deque is not empty
+            {
+                auto value = std::optional<value_type>
+                             {
+                                 current_array->load(bottom_index)
+                             };
+
+                if (top_index == bottom_index) // race for the last value
+                {
+                    if (!top.compare_exchange_strong(top_index, top_index + 1,
+                                                     std::memory_order::seq_cst,
+                                                     std::memory_order::relaxed))
+                    {
+                        value = std::nullopt; // a thief has won the race
+                    }
+
+                    bottom.store(bottom_index + 1, std::memory_order::relaxed);
+                }
+
+                return value;
+            }
+            else
+            {
+                bottom.store(bottom_index + 1, std::memory_order::relaxed);
+
+                return std::nullopt;
+            }
+        }
+
+        // note: Can be called by any thread.
+        //
+        //       Stealing fails not only when the deque is empty,
+        //       but also when another thread has taken the top value first.
+        //
+        auto steal () noexcept -> std::optional<value_type>
+        {
+            auto top_index = top.load(std::memory_order::acquire);
+
+            std::atomic_thread_fence(std::memory_order::seq_cst);
+
+            const auto bottom_index = bottom.load(std::memory_order::acquire);
+
+            if (top_index < bottom_index) // deque is not empty
+            {
+                auto* const current_array = array.load(std::memory_order::acquire);
+
+                const auto value = current_array->load(top_index);
+
+                if (top.compare_exchange_strong(top_index, top_index + 1,
+                                                std::memory_order::seq_cst,
+                                                std::memory_order::relaxed))
+                {
+                    return value;
+                }
+            }
+
+            return std::nullopt;
+        }
+
+        // note: The returned size is only an approximation,
+        //       when the deque is concurrently modified.
+        //
+        [[nodiscard]]
+        auto size () const noexcept -> std::ptrdiff_t
+        {
+            const auto bottom_index = bottom.load(std::memory_order::relaxed);
+            const auto    top_index =    top.load(std::memory_order::relaxed);
+
+            return (bottom_index > top_index) ? (bottom_index - top_index) : 0;
+        }
+
+        [[nodiscard]]
+        auto empty () const noexcept -> bool
+        {
+            return size() == 0;
+        }
+    };
+}
+
+
+#endif
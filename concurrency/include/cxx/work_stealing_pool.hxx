@@ -0,0 +1,341 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef CXX_WORK_STEALING_POOL
+#define CXX_WORK_STEALING_POOL
+
+
+#include <cxx/executor.hxx>
+
+#include <cxx/work_stealing_deque.hxx>
+
+#include <cxx/cache_line.hxx>
+
+#include <cxx/contracts.hxx>
+
+#include <concepts>
+
+#include <cstddef>
+
+#include <cstdint>
+
+#include <utility>
+
+#include <memory>
+
+#include <atomic>
+
+#include <mutex>
+
+#include <deque>
+
+#include <random>
+
+#include <vector>
+
+#include <functional>
+
+#include <thread>
+
+
+namespace cxx
+{
+    // [Journal of the ACM] - Robert D. Blumofe, Charles E. Leiserson:
+    //                        Scheduling Multithreaded Computations by Work Stealing
+    // ~ http://supertech.csail.mit.edu/papers/steal.pdf
+    //
+    // [GitHub] - Tokio: Making the Tokio scheduler 10x faster
+    // ~ https://tokio.rs/blog/2019-10-scheduler
+    //
+    // [GitHub] - Rayon: Thread pool sleeping and waking
+    // ~ https://github.com/rayon-rs/rayon/blob/main/rayon-core/src/sleep/README.md
+
+
+    // note: In contrast to the cxx::thread_pool, in which
+    //       all workers share a set of mutex protected task queues,
+    //       in the cxx::work_stealing_pool each worker owns
+    //       a lock-free cxx::work_stealing_deque<> of tasks:
+    //
+    //       - tasks submitted by a worker (from within a task)
+    //         are pushed to, and then popped from (LIFO), the deque of that worker
+    //
+    //       - tasks submitted by any other thread
+    //         are pushed to the mutex protected injection queue
+    //
+    //       - a worker without tasks in its own deque first checks
+    //         the injection queue and then tries to steal a task (FIFO)
+    //         from the deques of other workers, visited in random order
+    //
+    //       - a worker, which has not found any task,
+    //         parks on the std::atomic<>::wait() of the wake_epoch counter
+    //
+    class work_stealing_pool
+    {
+    private:
+        using task_type  = std::move_only_function<auto () -> void>;
+        using task_deque = cxx::work_stealing_deque<task_type*>;
+
+        struct alignas(cxx::cache_line_size) worker
+        {
+            task_deque tasks;
+        };
+
+        struct worker_context
+        {
+            const work_stealing_pool* pool;
+            std::ptrdiff_t            worker_index;
+        };
+
+        static inline
+        thread_local auto current_context = worker_context { nullptr, -1 };
+
+        std::ptrdiff_t                       worker_count;
+        std::unique_ptr<worker[]>                 workers;
+        std::vector<std::thread>           worker_threads;
+
+        std::mutex                        injection_mutex;
+        std::deque<task_type*>            injection_queue;
+
+        alignas(cxx::cache_line_size)
+        std::atomic<std::uint32_t>             wake_epoch;
+        std::atomic<std::ptrdiff_t>          idle_workers;
+        std::atomic<bool>                        stopping;
+        //
+        // note: In order to park workers indefinitely,
+        //       overflow of the wake_epoch must be well-defined.
+
+        auto wake_one () noexcept -> void
+        {
+            // note: The sequentially consistent fence orders publication
+            //       of a task before the load of the idle_workers counter,
+            //       pairing with the fetch_add() of the idle_workers
+            //       performed by a worker before it rechecks all queues.
+            //
+            //       Thus, either the submitting thread observes an idle worker,
+            //       or that idle worker observes the submitted task.
+            //
+            std::atomic_thread_fence(std::memory_order::seq_cst);
+
+            if (idle_workers.load(std::memory_order::relaxed) > 0)
+            {
+                wake_epoch.fetch_add(1, std::memory_order::release);
+                wake_epoch.notify_one();
+            }
+        }
+
+        auto try_pop_injected () -> task_type*
+        {
+            auto lock = std::scoped_lock { injection_mutex };
+
+            if (!injection_queue.empty())
+            {
+                auto* const task = injection_queue.front();
+
+                injection_queue.pop_front();
+
+                return task;
+            }
+            else
+            {
+                return nullptr;
+            }
+        }
+
+        auto try_acquire_task (const std::ptrdiff_t worker_index,
+                               std::minstd_rand&    random_engine) -> task_type*
+        {
+            if (auto task = workers[worker_index].tasks.pop())
+            {
+                return *task;
+            }
+
+            if (auto* const task = try_pop_injected())
+            {
+                return task;
+            }
+
+            const auto first_victim =
+                       std::uniform_int_distribution<std::ptrdiff_t>
+                       {
+                           0, worker_count - 1
+                       }
+                       (random_engine);
+
+            for (auto n = std::ptrdiff_t { 0 }; n != worker_count; ++n)
+            {
+                const auto victim_index = (first_victim + n) % worker_count;
+
+                if (victim_index != worker_index)
+                {
+                    if (auto task = workers[victim_index].tasks.steal())
+                    {
+                        return *task;
+                    }
+                }
+            }
+
+            return nullptr;
+        }
+
+        auto worker_main (const std::ptrdiff_t worker_index) -> void
+        {
+            current_context = worker_context { this, worker_index };
+
+            auto random_engine = std::minstd_rand
+                                 {
+                                     static_cast<std::uint_fast32_t>(worker_index + 1)
+                                 };
+
+            const auto execute = [] (task_type* const task) -> void
+            {
+                const auto owned_task = std::unique_ptr<task_type> { task };
+
+                std::invoke(*owned_task);
+            };
+
+            while (true)
+            {
+                if (auto* const task = try_acquire_task(worker_index, random_engine))
+                {
+                    execute(task);
+
+                    continue;
+                }
+
+                idle_workers.fetch_add(1, std::memory_order::seq_cst);
+
+                const auto epoch = wake_epoch.load(std::memory_order::seq_cst);
+
+                // note: After announcing itself as idle, the worker rechecks
+                //       all queues, since a task could have been submitted
+                //       before the submitting thread observed the idle worker.
+                //
+                if (auto* const task = try_acquire_task(worker_index, random_engine))
+                {
+                    idle_workers.fetch_sub(1, std::memory_order::relaxed);
+
+                    execute(task);
+
+                    continue;
+                }
+
+                if (stopping.load(std::memory_order::seq_cst))
+                {
+                    idle_workers.fetch_sub(1, std::memory_order::relaxed);
+
+                    return; // no more tasks to execute
+                }
+
+                wake_epoch.wait(epoch, std::memory_order::relaxed);
+
+                idle_workers.fetch_sub(1, std::memory_order::relaxed);
+            }
+        }
+
+    public:
+        explicit
+        work_stealing_pool (std::ptrdiff_t size = std::thread::hardware_concurrency())
+        :
+            worker_count    { size                             },
+            workers         { std::make_unique<worker[]>(size) },
+            worker_threads  {                                  },
+            injection_mutex {                                  },
+            injection_queue {                                  },
+            wake_epoch      { 0u                               },
+            idle_workers    { 0                                },
+            stopping        { false                            }
+        {
+            cxx_expects(size > 0);
+
+            worker_threads.reserve(worker_count);
+
+            for (auto worker_index = std::ptrdiff_t { 0 };
+                      worker_index != worker_count; ++worker_index)
+            {
+                worker_threads.emplace_back(&work_stealing_pool::worker_main,
+                                            this, worker_index);
+            }
+        }
+
+        ~work_stealing_pool ()
+        {
+            // note: Workers finish executing all of the submitted tasks,
+            //       including tasks submitted by other tasks,
+            //       before they observe the stopping flag and return.
+            //
+            stopping.store(true, std::memory_order::seq_cst);
+
+            wake_epoch.fetch_add(1, std::memory_order::seq_cst);
+            wake_epoch.notify_all();
+
+            for (auto& worker_thread : worker_threads)
+            {
+                worker_thread.join();
+            }
+        }
+
+        work_stealing_pool (const work_stealing_pool&) = delete;
+
+        auto operator = (const work_stealing_pool&) -> work_stealing_pool& = delete;
+
+        auto submit (std::invocable auto&& task) -> void
+        {
+            auto task_value = std::make_unique<task_type>
+                              (
+                                  std::forward<decltype(task)>(task)
+                              );
+
+            if (current_context.pool == this) // submitted by one of the workers
+            {
+                workers[current_context.worker_index].tasks.push(task_value.get());
+            }
+            else
+            {
+                auto lock = std::scoped_lock { injection_mutex };
+
+                injection_queue.push_back(task_value.get());
+            }
+
+            task_value.release(); // note: ownership has been passed to a queue
+
+            wake_one();
+        }
+    };
+
+    static_assert(cxx::executor<cxx::work_stealing_pool>);
+}
+
+
+#endif
@@ -33,9 +33,9 @@
  */
 
 
-#include <cxx/executor.hxx>
+#include <cxx/future.hxx>
 
-#include <cxx/channel.hxx>
+#include <cxx/executor.hxx>
 
 #include <concepts>
 
@@ -48,48 +48,6 @@
 
 namespace cxx
 {
-    class exec_token
-    {
-        cxx::channel::receiver completion;
-
-        explicit exec_token (cxx::channel::receiver completion) noexcept
-        :
-            completion { std::move(completion) }
-        { }
-
-        friend auto async_exec (cxx::executor  auto&  executor,
-                                std::invocable auto&& task) -> exec_token;
-
-        friend auto sync_wait (const cxx::exec_token& exec_token) noexcept -> void;
-    };
-
-
-    auto async_exec (cxx::executor  auto&  executor,
-                     std::invocable auto&& task) -> exec_token
-    {
-        auto [receiver, sender_generator] = cxx::channel::create(1);
-
-        executor.submit([   task        = std::forward<decltype(task)>(task),
-                            completion  = sender_generator() ] () mutable -> void
-                        {
-                            auto signal = cxx::channel::scoped_signal
-                                          {
-                                              std::move(completion)
-                                          };
-
-                            std::invoke(task);
-                        });
-
-        return cxx::exec_token { std::move(receiver) };
-    }
-
-
-    auto sync_wait (const cxx::exec_token& exec_token) noexcept -> void
-    {
-        cxx::channel::wait(exec_token.completion);
-    }
-
-
     auto sync_exec (cxx::executor  auto&  executor,
                     std::invocable auto&& task) -> void
     {
@@ -115,21 +73,27 @@ namespace cxx
 
 auto main () -> int
 {
-    auto executor   = cxx::new_thread { };
+    auto executor = cxx::new_thread { };
+
+    auto task     = [] () -> int
+                    {
+                        std::puts("Hello, from a task!");
 
-    auto task       = [] () -> void
-                      {
-                          std::puts("Hello, from a task!");
-                      };
+                        return 42;
+                    };
 
-    auto exec_token = cxx::async_exec(executor, task);
+    auto future   = cxx::async_exec(executor, task)
+                    .then(executor, [] (const int answer) -> void
+                                    {
+                                        std::printf("The answer is %d!\n", answer);
+                                    });
 
     cxx::sync_exec(executor, [] () -> void
                              {
                                  std::puts("Hello, from another task!");
                              });
 
-    cxx::sync_wait(exec_token);
+    cxx::sync_wait(std::move(future));
 
     return 0;
 }
@@ -0,0 +1,174 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <cxx/bounded_queue.hxx>
+
+#include <catch2/catch.hpp>
+
+#include <memory>
+
+#include <atomic>
+
+#include <array>
+
+#include <thread>
+
+
+TEST_CASE ("[bounded_queue] create")
+{
+    static_assert(std::is_default_constructible_v<cxx::bounded_queue<bool, 4>>);
+
+    [[maybe_unused]]
+    auto bounded_queue = cxx::bounded_queue<bool, 4> { };
+}
+
+
+TEST_CASE ("[bounded_queue] workflow of push followed by pop")
+{
+    auto bounded_queue = cxx::bounded_queue<int, 4> { };
+
+    bounded_queue.push(7);
+
+    REQUIRE(bounded_queue.pop() == 7);
+}
+
+
+TEST_CASE ("[bounded_queue] try_push fails when the queue is full")
+{
+    auto bounded_queue = cxx::bounded_queue<int, 2> { };
+
+    REQUIRE( bounded_queue.try_push(1));
+    REQUIRE( bounded_queue.try_push(2));
+    REQUIRE(!bounded_queue.try_push(3));
+
+    REQUIRE(bounded_queue.try_pop() == 1);
+    REQUIRE(bounded_queue.try_push(3));
+
+    REQUIRE(bounded_queue.try_pop() == 2);
+    REQUIRE(bounded_queue.try_pop() == 3);
+    REQUIRE(bounded_queue.try_pop() == std::nullopt);
+}
+
+
+TEST_CASE ("[bounded_queue] destroy values remaining in the queue")
+{
+    auto value = std::make_shared<int>(11);
+    {
+        auto bounded_queue = cxx::bounded_queue<std::shared_ptr<int>, 4> { };
+
+        bounded_queue.push(value);
+        bounded_queue.push(value);
+
+        REQUIRE(value.use_count() == 3);
+    }
+    REQUIRE(value.use_count() == 1);
+}
+
+
+TEST_CASE ("[bounded_queue] interrupt wakes up blocked consumer")
+{
+    auto bounded_queue = cxx::bounded_queue<int, 4> { };
+
+    auto consumer = std::jthread
+                    {
+                        [&] () -> void
+                        {
+                            REQUIRE(bounded_queue.pop() == std::nullopt);
+                        }
+                    };
+
+    std::this_thread::sleep_for(std::chrono::microseconds { 100 });
+
+    bounded_queue.interrupt();
+}
+
+
+TEST_CASE ("[bounded_queue] interrupt wakes up blocked producer")
+{
+    auto bounded_queue = cxx::bounded_queue<int, 2> { };
+
+    REQUIRE(bounded_queue.push(1));
+    REQUIRE(bounded_queue.push(2));
+
+    auto producer = std::jthread
+                    {
+                        [&] () -> void
+                        {
+                            REQUIRE(!bounded_queue.push(3));
+                        }
+                    };
+
+    std::this_thread::sleep_for(std::chrono::microseconds { 100 });
+
+    bounded_queue.interrupt();
+}
+
+
+TEST_CASE ("[bounded_queue] hand-off between multiple producers and consumers")
+{
+    constexpr auto value_count = 10'000;
+
+    auto bounded_queue = cxx::bounded_queue<int, 8> { };
+
+    auto sum = std::atomic<long long> { 0 };
+
+    auto producer_main = [&] () -> void
+    {
+        for (auto value = 1; value <= value_count; ++value)
+        {
+            bounded_queue.push(value);
+        }
+    };
+
+    auto consumer_main = [&] () -> void
+    {
+        for (auto n = 0; n != value_count; ++n)
+        {
+            sum.fetch_add(*bounded_queue.pop(), std::memory_order::relaxed);
+        }
+    };
+
+    {
+        auto threads = std::array
+                       {
+                           std::jthread { producer_main },
+                           std::jthread { consumer_main },
+                           std::jthread { producer_main },
+                           std::jthread { consumer_main },
+                       };
+    }
+
+    REQUIRE(sum.load() == 2LL * value_count * (value_count + 1) / 2);
+}
@@ -0,0 +1,156 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <cxx/channel.hxx>
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+TEST_CASE ("[channel] values are received in the order they have been sent")
+{
+    auto [receiver, sender] = cxx::channel::create<std::string>(4);
+
+    REQUIRE(sender.send(std::string { "first"  }));
+    REQUIRE(sender.send(std::string { "second" }));
+
+    REQUIRE(receiver.recv()     == "first" );
+    REQUIRE(receiver.try_recv() == "second");
+    REQUIRE(receiver.try_recv() == std::nullopt);
+}
+
+
+TEST_CASE ("[channel] try_send fails when the channel is full")
+{
+    auto [receiver, sender] = cxx::channel::create<int>(2);
+
+    REQUIRE( sender.try_send(1));
+    REQUIRE( sender.try_send(2));
+    REQUIRE(!sender.try_send(3));
+
+    REQUIRE(receiver.recv() == 1);
+
+    REQUIRE( sender.try_send(3));
+}
+
+
+TEST_CASE ("[channel] channel is closed when the last sender is destroyed")
+{
+    auto [receiver, sender] = cxx::channel::create<int>(2);
+    {
+        auto other_sender = sender;
+
+        REQUIRE(other_sender.send(1));
+    }
+    REQUIRE(sender.send(2));
+    {
+        auto destroyed = std::move(sender);
+    }
+    REQUIRE(receiver.recv() == 1);
+    REQUIRE(receiver.recv() == 2);
+    REQUIRE(receiver.recv() == std::nullopt);
+}
+
+
+TEST_CASE ("[channel] sending fails when all receivers are destroyed")
+{
+    auto [receiver, sender] = cxx::channel::create<int>(1);
+
+    REQUIRE(sender.send(1));
+
+    auto thread = std::jthread
+                  {
+                      [&, receiver = std::move(receiver)] () mutable -> void
+                      {
+                          std::this_thread::sleep_for(std::chrono::milliseconds { 1 });
+
+                          auto destroyed = std::move(receiver);
+                      }
+                  };
+
+    // note: The channel is full, thus the send() blocks,
+    //       until the receiver is destroyed.
+    //
+    REQUIRE(!sender.send(2));
+    REQUIRE(!sender.try_send(3));
+}
+
+
+TEST_CASE ("[channel] multiple producers and multiple consumers")
+{
+    constexpr auto producer_count = 4;
+    constexpr auto consumer_count = 3;
+    constexpr auto value_count    = 1'000;
+
+    auto sum = std::atomic<long> { 0 };
+    {
+        auto [receiver, sender] = cxx::channel::create<int>(8);
+
+        auto threads = std::vector<std::jthread> { };
+
+        for (auto n = 0; n != consumer_count; ++n)
+        {
+            threads.emplace_back([&sum, receiver] () mutable -> void
+            {
+                while (const auto value = receiver.recv())
+                {
+                    sum += *value;
+                }
+            });
+        }
+
+        for (auto n = 0; n != producer_count; ++n)
+        {
+            threads.emplace_back([sender] () mutable -> void
+            {
+                for (auto value = 1; value <= value_count; ++value)
+                {
+                    sender.send(value);
+                }
+            });
+        }
+
+        // note: Only the copies of the sender owned by the producers
+        //       keep the channel open from now on.
+        //
+        auto destroyed = std::move(sender);
+    }
+    REQUIRE(sum == producer_count * value_count * (value_count + 1) / 2);
+}
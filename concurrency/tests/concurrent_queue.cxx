@@ -37,6 +37,16 @@
 
 #include <catch2/catch.hpp>
 
+#include <iterator>
+
+#include <atomic>
+
+#include <array>
+
+#include <vector>
+
+#include <thread>
+
 
 TEST_CASE ("[concurrent_queue] create")
 {
@@ -55,3 +65,51 @@ TEST_CASE ("[concurrent_queue] workflow of push followed by pop")
 
     REQUIRE(concurrent_queue.pop() != std::nullopt);
 }
+
+
+TEST_CASE ("[concurrent_queue] workflow of push_range followed by pop_up_to")
+{
+    auto concurrent_queue = cxx::concurrent_queue<int> { };
+
+    concurrent_queue.push_range(std::array { 1, 2, 3, 4, 5 });
+
+    auto values = std::vector<int> { };
+
+    REQUIRE(concurrent_queue.pop_up_to(3, std::back_inserter(values)) == 3);
+    REQUIRE(values == std::vector { 1, 2, 3 });
+
+    REQUIRE(concurrent_queue.pop_up_to(3, std::back_inserter(values)) == 2);
+    REQUIRE(values == std::vector { 1, 2, 3, 4, 5 });
+
+    concurrent_queue.interrupt();
+
+    REQUIRE(concurrent_queue.pop_up_to(3, std::back_inserter(values)) == 0);
+}
+
+
+TEST_CASE ("[concurrent_queue] push_range wakes up blocked consumers")
+{
+    auto concurrent_queue = cxx::concurrent_queue<int> { };
+
+    auto sum = std::atomic<int> { 0 };
+
+    auto consumer_main = [&] () -> void
+    {
+        sum.fetch_add(*concurrent_queue.pop(), std::memory_order::relaxed);
+    };
+
+    {
+        auto consumers = std::array
+                         {
+                             std::jthread { consumer_main },
+                             std::jthread { consumer_main },
+                             std::jthread { consumer_main },
+                         };
+
+        std::this_thread::sleep_for(std::chrono::microseconds { 100 });
+
+        concurrent_queue.push_range(std::array { 1, 2, 3 });
+    }
+
+    REQUIRE(sum.load() == 6);
+}
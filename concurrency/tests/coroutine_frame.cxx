@@ -0,0 +1,205 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <cxx/coroutine_frame.hxx>
+
+#include <cxx/task.hxx>
+
+#include <cxx/new_thread.hxx>
+
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <cstddef>
+#include <memory>
+
+
+namespace
+{
+    // note: The counting_allocator counts bytes allocated
+    //       and deallocated through all of its copies.
+    //
+    template <typename type>
+    struct counting_allocator
+    {
+        using value_type = type;
+
+        std::ptrdiff_t* allocated;
+        std::ptrdiff_t* deallocated;
+
+        template <typename other_type>
+        counting_allocator (const counting_allocator<other_type>& other) noexcept
+        :
+            allocated   { other.allocated   },
+            deallocated { other.deallocated }
+        {
+        }
+
+        counting_allocator (std::ptrdiff_t& allocated, std::ptrdiff_t& deallocated) noexcept
+        :
+            allocated   { &allocated   },
+            deallocated { &deallocated }
+        {
+        }
+
+        auto allocate (const std::size_t count) -> value_type*
+        {
+            *allocated += std::ptrdiff_t(count * sizeof(value_type));
+
+            return std::allocator<value_type> { }.allocate(count);
+        }
+
+        auto deallocate (value_type* const pointer, const std::size_t count) noexcept -> void
+        {
+            *deallocated += std::ptrdiff_t(count * sizeof(value_type));
+
+            std::allocator<value_type> { }.deallocate(pointer, count);
+        }
+
+        auto operator == (const counting_allocator&) const noexcept -> bool = default;
+    };
+
+
+    auto increment (const int value) -> cxx::task<int>
+    {
+        co_return value + 1;
+    }
+
+    // note: The -Wmismatched-new-delete is a false positive of GCC 12,
+    //       described next to the cxx::pooled_coroutine_frame.
+    //
+#if defined(__GNUC__) && !defined(__clang__)
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+    auto increment (std::allocator_arg_t, const counting_allocator<int>&,
+                    const int value) -> cxx::task<int>
+    {
+        co_return value + 1;
+    }
+
+    auto large_frame () -> cxx::task<int>
+    {
+        auto values = std::array<int, 1'000> { };
+
+        values.back() = co_await increment(1);
+
+        co_return values.back();
+    }
+
+    struct incrementer
+    {
+        int step;
+
+        auto increment (std::allocator_arg_t, const counting_allocator<int>&,
+                        const int value) const -> cxx::task<int>
+        {
+            co_return value + step;
+        }
+    };
+
+#if defined(__GNUC__) && !defined(__clang__)
+    #pragma GCC diagnostic pop
+#endif
+}
+
+
+TEST_CASE ("[coroutine_frame] frames are reused by the coroutine_frame_pool")
+{
+    const auto& pool  = cxx::coroutine_frame_pool::this_thread();
+
+    const auto before = pool.stats();
+
+    for (auto n = 0; n != 10; ++n)
+    {
+        REQUIRE(cxx::sync_wait(increment(n)) == n + 1);
+    }
+
+    const auto after  = pool.stats();
+
+    // note: Each sync_wait() allocates two frames,
+    //       one for the task and another one for awaiting it.
+    //
+    REQUIRE(after.allocations     - before.allocations     == 20);
+    REQUIRE(after.reused_frames   - before.reused_frames   >= 18);
+    REQUIRE(after.allocated_bytes - before.allocated_bytes >   0);
+
+    REQUIRE(after.reuse_rate() > 0.0);
+}
+
+
+TEST_CASE ("[coroutine_frame] frames larger than any size class")
+{
+    REQUIRE(cxx::sync_wait(large_frame()) == 2);
+}
+
+
+TEST_CASE ("[coroutine_frame] frames freed by other threads")
+{
+    auto executor = cxx::new_thread { };
+
+    auto coroutine = [&] (const int value) -> cxx::task<int>
+    {
+        co_await cxx::schedule(executor);
+
+        co_return value;
+    };
+
+    for (auto n = 0; n != 10; ++n)
+    {
+        REQUIRE(cxx::sync_wait(coroutine(n)) == n);
+    }
+}
+
+
+TEST_CASE ("[coroutine_frame] frames are allocated by an allocator passed as argument")
+{
+    auto allocated   = std::ptrdiff_t { 0 };
+    auto deallocated = std::ptrdiff_t { 0 };
+
+    const auto allocator = counting_allocator<int> { allocated, deallocated };
+
+    REQUIRE(cxx::sync_wait(increment(std::allocator_arg, allocator, 1)) == 2);
+
+    REQUIRE(allocated > 0);
+    REQUIRE(allocated == deallocated);
+
+    const auto object = incrementer { 2 };
+
+    REQUIRE(cxx::sync_wait(object.increment(std::allocator_arg, allocator, 1)) == 3);
+
+    REQUIRE(allocated == deallocated);
+}
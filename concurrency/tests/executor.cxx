@@ -81,6 +81,8 @@ namespace cxx
 
 #include <cxx/thread_pool.hxx>
 
+#include <cxx/work_stealing_pool.hxx>
+
 #include <catch2/catch.hpp>
 
 #include <atomic>
@@ -89,6 +91,10 @@ namespace cxx
 
 #include <tuple>
 
+#include <vector>
+
+#include <functional>
+
 
 namespace
 {
@@ -231,11 +237,17 @@ namespace
 
     constexpr auto create_thread_pool = [] () { return cxx::thread_pool { }; };
 
+    constexpr auto create_work_stealing_pool = [] ()
+                                               {
+                                                   return cxx::work_stealing_pool { };
+                                               };
+
 
     constexpr auto tested_executors = std::tuple
                                       {
-                                          &spawn_new_thread,
-                                          &create_thread_pool,
+                                          spawn_new_thread,
+                                          create_thread_pool,
+                                          create_work_stealing_pool,
                                       };
 
 
@@ -270,4 +282,25 @@ namespace
             test::submit_tasks_from_multiple_threads::run(create_executor);
         });
     }
+
+    TEST_CASE ("[thread_pool] submit bulk of tasks")
+    {
+        constexpr auto task_count = 10'000;
+
+        auto counter = std::atomic<int> { 0 };
+        {
+            auto thread_pool = cxx::thread_pool { 4 };
+
+            auto tasks = std::vector<std::function<auto () -> void>>
+                         (
+                             task_count, [&counter] () -> void
+                                         {
+                                             counter.fetch_add(1, std::memory_order::relaxed);
+                                         }
+                         );
+
+            thread_pool.submit_bulk(tasks);
+        }
+        REQUIRE(counter.load(std::memory_order::relaxed) == task_count);
+    }
 }
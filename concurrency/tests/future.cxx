@@ -0,0 +1,179 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <cxx/future.hxx>
+
+#include <cxx/thread_pool.hxx>
+
+#include <cxx/new_thread.hxx>
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+
+TEST_CASE ("[future] async_exec returns the result of a task")
+{
+    auto executor = cxx::new_thread { };
+
+    auto future = cxx::async_exec(executor, [] () -> int { return 42; });
+
+    REQUIRE(future.valid());
+    REQUIRE(future.get() == 42);
+    REQUIRE(!future.valid());
+}
+
+
+TEST_CASE ("[future] async_exec propagates an exception thrown by a task")
+{
+    auto executor = cxx::new_thread { };
+
+    auto future = cxx::async_exec(executor, [] () -> int
+    {
+        throw std::runtime_error { "failure" };
+    });
+
+    REQUIRE_THROWS_AS(cxx::sync_wait(std::move(future)), std::runtime_error);
+}
+
+
+TEST_CASE ("[future] continuations are chained")
+{
+    auto executor = cxx::thread_pool { 2 };
+
+    auto future = cxx::async_exec(executor, [] () -> int { return 20; })
+                  .then(executor, [] (const int value) -> int { return value + 1; })
+                  .then(executor, [] (const int value) -> void { REQUIRE(value == 21); })
+                  .then(executor, [] () -> std::string { return "done"; });
+
+    REQUIRE(cxx::sync_wait(std::move(future)) == "done");
+}
+
+
+TEST_CASE ("[future] continuation attached to a ready future")
+{
+    auto executor = cxx::new_thread { };
+
+    auto future = cxx::async_exec(executor, [] () -> int { return 1; });
+
+    future.wait();
+
+    REQUIRE(future.is_ready());
+
+    auto next = std::move(future).then(executor, [] (const int value) -> int
+    {
+        return 2 * value;
+    });
+
+    REQUIRE(next.get() == 2);
+}
+
+
+TEST_CASE ("[future] continuations are skipped after an exception")
+{
+    auto executor = cxx::thread_pool { 2 };
+
+    auto invoked = false;
+
+    auto future = cxx::async_exec(executor, [] () -> int
+                  {
+                      throw std::runtime_error { "failure" };
+                  })
+                  .then(executor, [&] (const int value) -> int
+                  {
+                      invoked = true;
+
+                      return value;
+                  });
+
+    REQUIRE_THROWS_AS(future.get(), std::runtime_error);
+    REQUIRE(!invoked);
+}
+
+
+TEST_CASE ("[future] when_all waits for all of the futures")
+{
+    auto executor = cxx::thread_pool { 2 };
+
+    auto future = cxx::when_all(cxx::async_exec(executor, [] () -> int         { return 1;    }),
+                                cxx::async_exec(executor, [] () -> void        {              }),
+                                cxx::async_exec(executor, [] () -> std::string { return "3"; }));
+
+    const auto [first, second, third] = future.get();
+
+    REQUIRE(first == 1);
+    REQUIRE(third == "3");
+}
+
+
+TEST_CASE ("[future] when_all propagates an exception")
+{
+    auto executor = cxx::thread_pool { 2 };
+
+    auto future = cxx::when_all(cxx::async_exec(executor, [] () -> int { return 1; }),
+                                cxx::async_exec(executor, [] () -> int
+                                {
+                                    throw std::runtime_error { "failure" };
+                                }));
+
+    REQUIRE_THROWS_AS(future.get(), std::runtime_error);
+}
+
+
+TEST_CASE ("[future] when_any completes with the first ready future")
+{
+    auto blocker  = std::atomic_flag { };
+
+    auto executor = cxx::thread_pool { 2 };
+
+    auto future = cxx::when_any(cxx::async_exec(executor, [&] () -> int
+                                {
+                                    blocker.wait(false);
+
+                                    return 1;
+                                }),
+                                cxx::async_exec(executor, [] () -> int { return 2; }));
+
+    const auto result = future.get();
+
+    REQUIRE(result.index == 1);
+    REQUIRE(result.value == 2);
+
+    blocker.test_and_set();
+    blocker.notify_all();
+}
@@ -0,0 +1,168 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <cxx/mcs_mutex.hxx>
+
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+
+TEST_CASE ("[mcs_mutex] smoke test")
+{
+    auto counter = std::atomic<int> { 0 };
+    {
+        auto mutex = cxx::mcs_mutex { };
+
+        auto thread_main = [&] () -> void
+        {
+            auto lock = std::scoped_lock { mutex };
+
+            // note: At any point in time,
+            //       only one thread is allowed in the critical section.
+
+            REQUIRE(counter++ == 0);
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds { 100 });
+            }
+            REQUIRE(counter-- == 1);
+        };
+
+        auto threads = std::array
+                       {
+                           std::jthread { thread_main },
+                           std::jthread { thread_main },
+                       };
+    }
+    REQUIRE(counter == 0);
+}
+
+
+TEST_CASE ("[mcs_mutex] smoke test without spinning")
+{
+    auto counter = 0;
+    {
+        auto mutex = cxx::mcs_mutex { 0 };
+
+        auto thread_main = [&] () -> void
+        {
+            for (auto n = 0; n != 10'000; ++n)
+            {
+                auto lock = std::scoped_lock { mutex };
+
+                ++counter;
+            }
+        };
+
+        auto threads = std::array
+                       {
+                           std::jthread { thread_main },
+                           std::jthread { thread_main },
+                           std::jthread { thread_main },
+                       };
+    }
+    REQUIRE(counter == 30'000);
+}
+
+
+TEST_CASE ("[mcs_mutex] try_lock fails when locked")
+{
+    auto mutex = cxx::mcs_mutex { };
+
+    REQUIRE( mutex.try_lock());
+    REQUIRE(!mutex.try_lock());
+
+    mutex.unlock();
+
+    REQUIRE( mutex.try_lock());
+
+    mutex.unlock();
+}
+
+
+TEST_CASE ("[mcs_mutex] unlock mutexes in any order")
+{
+    auto first  = cxx::mcs_mutex { };
+    auto second = cxx::mcs_mutex { };
+
+    first.lock();
+    second.lock();
+
+    first.unlock();
+
+    REQUIRE(first.try_lock());
+
+    second.unlock();
+    first.unlock();
+
+    REQUIRE(second.try_lock());
+
+    second.unlock();
+}
+
+
+TEST_CASE ("[mcs_mutex] threads exiting right after unlocking")
+{
+    auto counter = 0;
+    {
+        auto mutex = cxx::mcs_mutex { 0 };
+
+        // note: Every thread exits right after unlocking the mcs_mutex,
+        //       possibly before the thread, which has handed the mcs_mutex
+        //       over to it, has finished notifying its node.
+        //
+        auto thread_main = [&] () -> void
+        {
+            auto lock = std::scoped_lock { mutex };
+
+            ++counter;
+        };
+
+        for (auto round = 0; round != 200; ++round)
+        {
+            auto threads = std::array
+                           {
+                               std::jthread { thread_main },
+                               std::jthread { thread_main },
+                               std::jthread { thread_main },
+                               std::jthread { thread_main },
+                           };
+        }
+    }
+    REQUIRE(counter == 800);
+}
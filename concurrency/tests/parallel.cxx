@@ -0,0 +1,240 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <cxx/parallel.hxx>
+
+#include <cxx/thread_pool.hxx>
+
+#include <catch2/catch.hpp>
+
+#include <stdexcept>
+
+#include <string>
+
+#include <functional>
+
+#include <algorithm>
+
+#include <numeric>
+
+#include <random>
+
+#include <atomic>
+
+#include <vector>
+
+#include <thread>
+
+#include <chrono>
+
+#include <utility>
+
+
+namespace
+{
+    auto generate_values (const int count) -> std::vector<int>
+    {
+        auto random_engine = std::minstd_rand { 7 };
+
+        auto values = std::vector<int>(count);
+
+        std::ranges::generate(values, [&] () -> int
+                                      {
+                                          return static_cast<int>(random_engine() % 1000);
+                                      });
+
+        return values;
+    }
+
+
+    // note: The failing_executor submits only the given number of tasks
+    //       to the thread_pool, and throws when submitting the next one.
+    //
+    struct failing_executor
+    {
+        cxx::thread_pool& thread_pool;
+        int               task_limit;
+
+        template <typename task_type>
+        auto submit (task_type&& task) -> void
+        {
+            if (task_limit == 0)
+            {
+                throw std::runtime_error { "submit" };
+            }
+
+            --task_limit;
+
+            thread_pool.submit(std::forward<task_type>(task));
+        }
+    };
+}
+
+
+TEST_CASE ("[parallel] for_each visits every element once")
+{
+    auto thread_pool = cxx::thread_pool { 4 };
+
+    for (const auto size : { 0, 1, 3, 1000 })
+    {
+        auto values = std::vector<int>(size, 1);
+
+        cxx::parallel::for_each(thread_pool, values, [] (int& value) -> void
+                                                     {
+                                                         value += 1;
+                                                     });
+
+        REQUIRE(std::ranges::all_of(values, [] (const int value)
+                                            {
+                                                return value == 2;
+                                            }));
+    }
+}
+
+
+TEST_CASE ("[parallel] for_each rethrows an exception")
+{
+    auto thread_pool = cxx::thread_pool { 4 };
+
+    auto values = std::vector<int>(100);
+
+    REQUIRE_THROWS_AS(cxx::parallel::for_each(thread_pool, values, [] (int&) -> void
+                                                                   {
+                                                                       throw std::runtime_error { "" };
+                                                                   }),
+                      std::runtime_error);
+}
+
+
+TEST_CASE ("[parallel] for_each waits for submitted tasks, when submitting fails")
+{
+    auto thread_pool = cxx::thread_pool { 4 };
+
+    auto executor = failing_executor { thread_pool, 3 };
+
+    auto values = std::vector<int>(100);
+
+    auto visited = std::atomic<int> { 0 };
+
+    REQUIRE_THROWS_AS(cxx::parallel::for_each(executor, values, [&] (int&) -> void
+                                                                {
+                                                                    std::this_thread::sleep_for(std::chrono::microseconds { 10 });
+
+                                                                    visited.fetch_add(1, std::memory_order::relaxed);
+                                                                }, 10),
+                      std::runtime_error);
+
+    REQUIRE(visited.load() == 30);
+}
+
+
+TEST_CASE ("[parallel] transform_reduce matches std::transform_reduce")
+{
+    auto thread_pool = cxx::thread_pool { 4 };
+
+    for (const auto size : { 0, 1, 5, 10'000 })
+    {
+        const auto values = generate_values(size);
+
+        const auto square = [] (const int value) -> long long
+                            {
+                                return 1LL * value * value;
+                            };
+
+        REQUIRE(cxx::parallel::transform_reduce(thread_pool, values, 3LL,
+                                                std::plus { }, square, 7)
+                ==
+                std::transform_reduce(values.begin(), values.end(), 3LL,
+                                      std::plus { }, square));
+    }
+}
+
+
+TEST_CASE ("[parallel] transform_reduce preserves order of chunks")
+{
+    auto thread_pool = cxx::thread_pool { 4 };
+
+    const auto letters = std::vector<char> { 'a', 'b', 'c', 'd', 'e', 'f', 'g' };
+
+    const auto result = cxx::parallel::transform_reduce(thread_pool, letters,
+                                                        std::string { '>' },
+                                                        std::plus { },
+                                                        [] (const char letter)
+                                                        {
+                                                            return std::string { letter };
+                                                        },
+                                                        3);
+    REQUIRE(result == ">abcdefg");
+}
+
+
+TEST_CASE ("[parallel] inclusive_scan matches std::inclusive_scan")
+{
+    auto thread_pool = cxx::thread_pool { 4 };
+
+    for (const auto size : { 0, 1, 2, 7, 10'000 })
+    {
+        const auto values = generate_values(size);
+
+        auto expected = std::vector<int>(size);
+        auto actual   = std::vector<int>(size);
+
+        std::inclusive_scan(values.begin(), values.end(), expected.begin());
+
+        const auto last = cxx::parallel::inclusive_scan(thread_pool, values,
+                                                        actual.begin(),
+                                                        std::plus { }, 5);
+        REQUIRE(last   == actual.end());
+        REQUIRE(actual == expected);
+    }
+}
+
+
+TEST_CASE ("[parallel] sort matches std::ranges::sort")
+{
+    auto thread_pool = cxx::thread_pool { 4 };
+
+    for (const auto chunk_count : { 1, 2, 3, 4, 7, 16 })
+    {
+        auto actual   = generate_values(10'000);
+        auto expected = actual;
+
+        std::ranges::sort(expected, std::ranges::greater { });
+
+        cxx::parallel::sort(thread_pool, actual, std::ranges::greater { }, chunk_count);
+
+        REQUIRE(actual == expected);
+    }
+}
@@ -38,6 +38,7 @@
 #include <catch2/catch.hpp>
 
 #include <array>
+#include <atomic>
 #include <mutex>
 #include <thread>
 
@@ -70,3 +71,90 @@ TEST_CASE ("[spin_mutex] smoke test")
     }
     REQUIRE(counter == 0);
 }
+
+
+TEST_CASE ("[spin_mutex] smoke test without spinning")
+{
+    auto counter = 0;
+    {
+        auto mutex = cxx::spin_mutex { 0 };
+
+        auto thread_main = [&] () -> void
+        {
+            for (auto n = 0; n != 10'000; ++n)
+            {
+                auto lock = std::scoped_lock { mutex };
+
+                ++counter;
+            }
+        };
+
+        auto threads = std::array
+                       {
+                           std::jthread { thread_main },
+                           std::jthread { thread_main },
+                           std::jthread { thread_main },
+                       };
+    }
+    REQUIRE(counter == 30'000);
+}
+
+
+TEST_CASE ("[spin_mutex] try_lock fails when locked")
+{
+    auto mutex = cxx::spin_mutex { };
+
+    REQUIRE( mutex.try_lock());
+    REQUIRE(!mutex.try_lock());
+
+    mutex.unlock();
+
+    REQUIRE( mutex.try_lock());
+
+    mutex.unlock();
+}
+
+
+TEST_CASE ("[spin_mutex] collect statistics")
+{
+    auto mutex = cxx::basic_spin_mutex<cxx::lock_statistics> { };
+
+    static_assert(sizeof(cxx::spin_mutex) < sizeof(mutex));
+
+    REQUIRE(mutex.stats().acquisitions() == 0);
+
+    for (auto n = 0; n != 3; ++n)
+    {
+        auto lock = std::scoped_lock { mutex };
+    }
+
+    REQUIRE(mutex.stats().acquisitions()           == 3);
+    REQUIRE(mutex.stats().contended_acquisitions() == 0);
+    REQUIRE(mutex.stats().spin_iterations()        == 0);
+
+    mutex.lock();
+    {
+        auto started = std::atomic_flag { };
+
+        auto thread  = std::jthread
+                       {
+                           [&] () -> void
+                           {
+                               started.test_and_set();
+                               started.notify_one();
+
+                               auto lock = std::scoped_lock { mutex };
+                           }
+                       };
+
+        started.wait(false);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds { 1 });
+
+        mutex.unlock();
+    }
+
+    REQUIRE(mutex.stats().acquisitions()           == 5);
+    REQUIRE(mutex.stats().contended_acquisitions() == 1);
+    REQUIRE(mutex.stats().spin_iterations()        >= 1);
+}
@@ -0,0 +1,168 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <cxx/task.hxx>
+
+#include <cxx/thread_pool.hxx>
+
+#include <cxx/new_thread.hxx>
+
+#include <catch2/catch.hpp>
+
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+
+namespace
+{
+    auto answer () -> cxx::task<int>
+    {
+        co_return 42;
+    }
+
+    auto fail () -> cxx::task<int>
+    {
+        throw std::runtime_error { "failure" };
+
+        co_return 0;
+    }
+
+    auto sum (const int count) -> cxx::task<long>
+    {
+        auto total = 0L;
+
+        for (auto n = 0; n != count; ++n)
+        {
+            total += co_await answer();
+        }
+
+        co_return total;
+    }
+
+    auto nested (const int depth) -> cxx::task<int>
+    {
+        if (depth == 0)
+        {
+            co_return 0;
+        }
+
+        co_return 1 + co_await nested(depth - 1);
+    }
+}
+
+
+TEST_CASE ("[task] sync_wait returns the result of a task")
+{
+    REQUIRE(cxx::sync_wait(answer()) == 42);
+}
+
+
+TEST_CASE ("[task] sync_wait rethrows an exception thrown by a task")
+{
+    REQUIRE_THROWS_AS(cxx::sync_wait(fail()), std::runtime_error);
+}
+
+
+TEST_CASE ("[task] tasks awaiting other tasks")
+{
+    // note: GCC turns the symmetric transfer into a tail call
+    //       only when optimizations are enabled, thus the number
+    //       of awaited tasks is kept low enough for debug builds,
+    //       whose stack still grows with every completed task.
+    //
+    REQUIRE(cxx::sync_wait(sum(10'000)) == 420'000L);
+
+    REQUIRE(cxx::sync_wait(nested(1'000)) == 1'000);
+}
+
+
+TEST_CASE ("[task] task of void")
+{
+    auto invoked = false;
+
+    auto coroutine = [&] () -> cxx::task<>
+    {
+        invoked = true;
+
+        co_return;
+    };
+
+    cxx::sync_wait(coroutine());
+
+    REQUIRE(invoked);
+}
+
+
+TEST_CASE ("[task] schedule resumes a coroutine on a thread of an executor")
+{
+    auto executor = cxx::new_thread { };
+
+    auto coroutine = [&] () -> cxx::task<std::thread::id>
+    {
+        co_await cxx::schedule(executor);
+
+        co_return std::this_thread::get_id();
+    };
+
+    const auto id = cxx::sync_wait(coroutine());
+
+    REQUIRE(id != std::this_thread::get_id());
+}
+
+
+TEST_CASE ("[task] hopping between executors")
+{
+    auto pool   = cxx::thread_pool { 2 };
+    auto thread = cxx::new_thread  {   };
+
+    auto coroutine = [&] () -> cxx::task<std::string>
+    {
+        auto result = std::string { };
+
+        for (auto n = 0; n != 100; ++n)
+        {
+            co_await cxx::schedule(pool);
+
+            result += co_await answer() == 42 ? "p" : "";
+
+            co_await cxx::schedule(thread);
+        }
+
+        co_return result;
+    };
+
+    REQUIRE(cxx::sync_wait(coroutine()) == std::string(100, 'p'));
+}
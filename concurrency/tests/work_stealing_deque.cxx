@@ -0,0 +1,164 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <cxx/work_stealing_deque.hxx>
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+
+#include <atomic>
+
+#include <array>
+
+#include <vector>
+
+#include <thread>
+
+
+TEST_CASE ("[work_stealing_deque] owner pops values in LIFO order")
+{
+    auto deque = cxx::work_stealing_deque<int> { };
+
+    deque.push(1);
+    deque.push(2);
+    deque.push(3);
+
+    REQUIRE(deque.size() == 3);
+
+    REQUIRE(deque.pop() == 3);
+    REQUIRE(deque.pop() == 2);
+    REQUIRE(deque.pop() == 1);
+    REQUIRE(deque.pop() == std::nullopt);
+
+    REQUIRE(deque.empty());
+}
+
+
+TEST_CASE ("[work_stealing_deque] thieves steal values in FIFO order")
+{
+    auto deque = cxx::work_stealing_deque<int> { };
+
+    deque.push(1);
+    deque.push(2);
+    deque.push(3);
+
+    REQUIRE(deque.steal() == 1);
+    REQUIRE(deque.steal() == 2);
+    REQUIRE(deque.pop()   == 3);
+    REQUIRE(deque.steal() == std::nullopt);
+}
+
+
+TEST_CASE ("[work_stealing_deque] grow beyond initial capacity")
+{
+    auto deque = cxx::work_stealing_deque<int> { 4 };
+
+    for (auto value = 0; value != 100; ++value)
+    {
+        deque.push(value);
+    }
+
+    REQUIRE(deque.size() == 100);
+
+    for (auto value = 0; value != 50; ++value)
+    {
+        REQUIRE(deque.steal() == value);
+    }
+
+    for (auto value = 99; value != 49; --value)
+    {
+        REQUIRE(deque.pop() == value);
+    }
+
+    REQUIRE(deque.empty());
+}
+
+
+TEST_CASE ("[work_stealing_deque] every value is taken exactly once")
+{
+    constexpr auto value_count = 100'000;
+
+    auto deque = cxx::work_stealing_deque<int> { 16 };
+
+    auto taken = std::vector<std::atomic<int>>(value_count);
+
+    auto done  = std::atomic<bool> { false };
+
+    auto thief_main = [&] () -> void
+    {
+        while (!done.load(std::memory_order::acquire) || !deque.empty())
+        {
+            if (auto value = deque.steal())
+            {
+                taken[*value].fetch_add(1, std::memory_order::relaxed);
+            }
+        }
+    };
+
+    {
+        auto thieves = std::array
+                       {
+                           std::jthread { thief_main },
+                           std::jthread { thief_main },
+                           std::jthread { thief_main },
+                       };
+
+        for (auto value = 0; value != value_count; ++value)
+        {
+            deque.push(value);
+
+            if (value % 3 == 0)
+            {
+                if (auto popped = deque.pop())
+                {
+                    taken[*popped].fetch_add(1, std::memory_order::relaxed);
+                }
+            }
+        }
+
+        while (auto popped = deque.pop())
+        {
+            taken[*popped].fetch_add(1, std::memory_order::relaxed);
+        }
+
+        done.store(true, std::memory_order::release);
+    }
+
+    REQUIRE(std::ranges::all_of(taken, [] (const std::atomic<int>& count)
+                                       {
+                                           return count.load() == 1;
+                                       }));
+}
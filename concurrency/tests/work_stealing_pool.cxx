@@ -0,0 +1,99 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <cxx/work_stealing_pool.hxx>
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+
+
+namespace
+{
+    auto spawn_recursively (cxx::work_stealing_pool& pool,
+                            std::atomic<int>&     counter,
+                            const int               depth) -> void
+    {
+        counter.fetch_add(1, std::memory_order::relaxed);
+
+        if (depth > 0)
+        {
+            pool.submit([&pool, &counter, depth] () -> void
+                        {
+                            spawn_recursively(pool, counter, depth - 1);
+                        });
+
+            pool.submit([&pool, &counter, depth] () -> void
+                        {
+                            spawn_recursively(pool, counter, depth - 1);
+                        });
+        }
+    }
+}
+
+
+TEST_CASE ("[work_stealing_pool] execute tasks submitted by other tasks")
+{
+    constexpr auto depth = 12;
+
+    auto counter = std::atomic<int> { 0 };
+    {
+        auto pool = cxx::work_stealing_pool { 4 };
+
+        pool.submit([&] () -> void
+                    {
+                        spawn_recursively(pool, counter, depth);
+                    });
+    }
+    REQUIRE(counter.load(std::memory_order::relaxed) == (1 << (depth + 1)) - 1);
+}
+
+
+TEST_CASE ("[work_stealing_pool] execute tasks with a single worker")
+{
+    auto counter = std::atomic<int> { 0 };
+    {
+        auto pool = cxx::work_stealing_pool { 1 };
+
+        for (auto n = 0; n != 1'000; ++n)
+        {
+            pool.submit([&] () -> void
+                        {
+                            counter.fetch_add(1, std::memory_order::relaxed);
+                        });
+        }
+    }
+    REQUIRE(counter.load(std::memory_order::relaxed) == 1'000);
+}
@@ -0,0 +1,240 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <cxx/arena.hxx>
+#include <cxx/scratch_stack.hxx>
+
+#include <cxx/allocator.hxx>
+#include <cxx/list.hxx>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <array>
+#include <memory_resource>
+#include <vector>
+
+
+namespace
+{
+    constexpr auto allocation_count = std::int64_t { 1'000 };
+
+    template <std::size_t size>
+    struct object
+    {
+        std::array<std::byte, size> bytes;
+    };
+
+    // note: The pointers are deallocated only after all allocations,
+    //       which is the lifetime pattern arenas are designed for.
+    //
+    template <std::size_t size>
+    auto allocate_with_cxx_allocator (benchmark::State& state) -> void
+    {
+        auto allocator = cxx::allocator<object<size>> { };
+        auto pointers  = std::vector<object<size>*> (allocation_count);
+
+        for (auto _ : state)
+        {
+            for (auto& pointer : pointers)
+            {
+                pointer = allocator.allocate(1);
+            }
+
+            benchmark::DoNotOptimize(pointers.data());
+
+            for (const auto pointer : pointers)
+            {
+                allocator.deallocate(pointer, 1);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * allocation_count);
+    }
+
+    template <std::size_t size>
+    auto allocate_with_monotonic_arena (benchmark::State& state) -> void
+    {
+        auto buffer = std::vector<std::byte> (allocation_count * size * 2);
+        auto arena  = cxx::monotonic_arena { buffer };
+
+        auto allocator = cxx::arena_allocator<object<size>> { arena };
+        auto pointers  = std::vector<object<size>*> (allocation_count);
+
+        for (auto _ : state)
+        {
+            for (auto& pointer : pointers)
+            {
+                pointer = allocator.allocate(1);
+            }
+
+            benchmark::DoNotOptimize(pointers.data());
+
+            arena.release();
+        }
+
+        state.SetItemsProcessed(state.iterations() * allocation_count);
+    }
+
+    template <std::size_t size>
+    auto allocate_with_frame_arena (benchmark::State& state) -> void
+    {
+        auto arena = cxx::frame_arena { allocation_count * size * 2 };
+
+        auto allocator = cxx::arena_allocator<object<size>, cxx::frame_arena> { arena };
+        auto pointers  = std::vector<object<size>*> (allocation_count);
+
+        for (auto _ : state)
+        {
+            for (auto& pointer : pointers)
+            {
+                pointer = allocator.allocate(1);
+            }
+
+            benchmark::DoNotOptimize(pointers.data());
+
+            arena.reset();
+        }
+
+        state.SetItemsProcessed(state.iterations() * allocation_count);
+    }
+
+    template <std::size_t size>
+    auto allocate_with_scratch_stack (benchmark::State& state) -> void
+    {
+        auto& stack = cxx::scratch_stack::local();
+
+        auto allocator = cxx::arena_allocator<object<size>, cxx::scratch_stack> { stack };
+        auto pointers  = std::vector<object<size>*> (allocation_count);
+
+        for (auto _ : state)
+        {
+            const auto marker = stack.mark();
+
+            for (auto& pointer : pointers)
+            {
+                pointer = allocator.allocate(1);
+            }
+
+            benchmark::DoNotOptimize(pointers.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * allocation_count);
+    }
+
+    template <std::size_t size>
+    auto allocate_with_monotonic_buffer_resource (benchmark::State& state) -> void
+    {
+        auto buffer   = std::vector<std::byte> (allocation_count * size * 2);
+        auto resource = std::pmr::monotonic_buffer_resource { buffer.data(), buffer.size() };
+
+        auto allocator = std::pmr::polymorphic_allocator<object<size>> { &resource };
+        auto pointers  = std::vector<object<size>*> (allocation_count);
+
+        for (auto _ : state)
+        {
+            for (auto& pointer : pointers)
+            {
+                pointer = allocator.allocate(1);
+            }
+
+            benchmark::DoNotOptimize(pointers.data());
+
+            resource.release();
+        }
+
+        state.SetItemsProcessed(state.iterations() * allocation_count);
+    }
+
+    auto build_list_with_cxx_allocator (benchmark::State& state) -> void
+    {
+        for (auto _ : state)
+        {
+            auto list = cxx::list<std::int64_t> { };
+
+            for (auto n = std::int64_t { 0 }; n != allocation_count; ++n)
+            {
+                list.push_back(n);
+            }
+
+            benchmark::DoNotOptimize(list.back());
+        }
+
+        state.SetItemsProcessed(state.iterations() * allocation_count);
+    }
+
+    auto build_list_with_frame_arena (benchmark::State& state) -> void
+    {
+        using allocator_type = cxx::arena_allocator<std::int64_t, cxx::frame_arena>;
+
+        auto arena = cxx::frame_arena { 64 * 1024 };
+
+        for (auto _ : state)
+        {
+            {
+                auto list = cxx::list<std::int64_t, allocator_type> { allocator_type { arena } };
+
+                for (auto n = std::int64_t { 0 }; n != allocation_count; ++n)
+                {
+                    list.push_back(n);
+                }
+
+                benchmark::DoNotOptimize(list.back());
+            }
+
+            arena.reset();
+        }
+
+        state.SetItemsProcessed(state.iterations() * allocation_count);
+    }
+}
+
+
+BENCHMARK_TEMPLATE(allocate_with_cxx_allocator,             16);
+BENCHMARK_TEMPLATE(allocate_with_monotonic_arena,           16);
+BENCHMARK_TEMPLATE(allocate_with_frame_arena,               16);
+BENCHMARK_TEMPLATE(allocate_with_scratch_stack,             16);
+BENCHMARK_TEMPLATE(allocate_with_monotonic_buffer_resource, 16);
+
+BENCHMARK_TEMPLATE(allocate_with_cxx_allocator,             256);
+BENCHMARK_TEMPLATE(allocate_with_monotonic_arena,           256);
+BENCHMARK_TEMPLATE(allocate_with_frame_arena,               256);
+BENCHMARK_TEMPLATE(allocate_with_scratch_stack,             256);
+BENCHMARK_TEMPLATE(allocate_with_monotonic_buffer_resource, 256);
+
+BENCHMARK(build_list_with_cxx_allocator);
+BENCHMARK(build_list_with_frame_arena);
@@ -0,0 +1,109 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <cxx/optional.hxx>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <optional>
+#include <random>
+#include <vector>
+
+
+namespace
+{
+    using flagged_index  = cxx::optional<std::uint32_t>;
+    using sentinel_index = cxx::optional<std::uint32_t, cxx::sentinel_niche<std::uint32_t, ~std::uint32_t { 0 }>>;
+
+    static_assert(sizeof(flagged_index)  == 2 * sizeof(std::uint32_t));
+    static_assert(sizeof(sentinel_index) == 1 * sizeof(std::uint32_t));
+
+    constexpr auto element_count = std::size_t { 10'000'000 };
+
+    // note: Every fourth element is left empty, in a regular pattern,
+    //       so that branch prediction is not measured instead of memory traffic.
+    //
+    template <typename optional_type>
+    auto make_indices () -> std::vector<optional_type>
+    {
+        auto engine = std::minstd_rand { 7 };
+
+        auto indices = std::vector<optional_type> (element_count);
+
+        for (auto position = std::size_t { 0 }; position != element_count; ++position)
+        {
+            const auto value = static_cast<std::uint32_t>(engine());
+
+            if (position % 4 != 3)
+            {
+                indices[position].emplace(value);
+            }
+        }
+
+        return indices;
+    }
+
+    template <typename optional_type>
+    auto sum_indices (benchmark::State& state) -> void
+    {
+        const auto indices = make_indices<optional_type>();
+
+        for (auto _ : state)
+        {
+            auto sum = std::uint64_t { 0 };
+
+            for (const auto& index : indices)
+            {
+                if (index.has_value())
+                {
+                    sum += *index;
+                }
+            }
+
+            benchmark::DoNotOptimize(sum);
+        }
+
+        state.SetItemsProcessed(state.iterations() * element_count);
+        state.SetBytesProcessed(state.iterations() * element_count * sizeof(optional_type));
+    }
+}
+
+
+BENCHMARK_TEMPLATE(sum_indices, std::optional<std::uint32_t>)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(sum_indices, flagged_index)               ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(sum_indices, sentinel_index)              ->Unit(benchmark::kMillisecond);
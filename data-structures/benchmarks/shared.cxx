@@ -0,0 +1,201 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <cxx/shared.hxx>
+#include <cxx/slab_allocator.hxx>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#include <array>
+#include <memory>
+
+
+namespace
+{
+    struct payload
+    {
+        std::int64_t value;
+    };
+
+    // note: The cxx::shared<> cannot be copied, so sharing a value
+    //       between count handles is benchmarked as bulk_create<count>(),
+    //       and as std::make_shared() followed by count - 1 copies.
+    //
+    template <typename ref_count_type, int count>
+    auto bulk_create_and_drop (benchmark::State& state) -> void
+    {
+        for (auto _ : state)
+        {
+            auto handles = cxx::shared<payload, ref_count_type>::template bulk_create<count>(payload { 1 });
+
+            benchmark::DoNotOptimize(handles.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+
+    template <typename ref_count_type, int count>
+    auto bulk_create_and_drop_from_slabs (benchmark::State& state) -> void
+    {
+        const auto allocator = cxx::slab_allocator<payload> { };
+
+        for (auto _ : state)
+        {
+            auto handles = cxx::shared<payload, ref_count_type>
+                              ::template bulk_create<count>(std::allocator_arg, allocator, payload { 1 });
+
+            benchmark::DoNotOptimize(handles.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+
+    template <int count>
+    auto make_shared_copy_and_drop (benchmark::State& state) -> void
+    {
+        for (auto _ : state)
+        {
+            auto handles = std::array<std::shared_ptr<payload>, count> { };
+
+            handles[0] = std::make_shared<payload>(payload { 1 });
+
+            for (auto index = 1; index != count; ++index)
+            {
+                handles[index] = handles[0];
+            }
+
+            benchmark::DoNotOptimize(handles.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+
+    template <int count>
+    auto allocate_shared_copy_and_drop_from_slabs (benchmark::State& state) -> void
+    {
+        const auto allocator = cxx::slab_allocator<payload> { };
+
+        for (auto _ : state)
+        {
+            auto handles = std::array<std::shared_ptr<payload>, count> { };
+
+            handles[0] = std::allocate_shared<payload>(allocator, payload { 1 });
+
+            for (auto index = 1; index != count; ++index)
+            {
+                handles[index] = handles[0];
+            }
+
+            benchmark::DoNotOptimize(handles.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+
+    // note: Copying and dropping a std::shared_ptr costs two locked RMWs,
+    //       as does keeping a cxx::shared<> value alive through a cxx::weak<>.
+    //       However, libstdc++ falls back to plain arithmetic, as long as
+    //       the process has not started any thread, which these benchmarks,
+    //       running on a single thread, do not.
+    //
+    auto shared_ptr_copy_and_drop (benchmark::State& state) -> void
+    {
+        const auto shared_ptr = std::make_shared<payload>(payload { 1 });
+
+        for (auto _ : state)
+        {
+            auto copy = shared_ptr;
+
+            benchmark::DoNotOptimize(copy);
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    auto weak_ptr_lock (benchmark::State& state) -> void
+    {
+        const auto shared_ptr = std::make_shared<payload>(payload { 1 });
+        const auto   weak_ptr = std::weak_ptr<payload> { shared_ptr };
+
+        for (auto _ : state)
+        {
+            if (const auto locked = weak_ptr.lock())
+            {
+                benchmark::DoNotOptimize(locked->value);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    template <typename ref_count_type>
+    auto weak_visit (benchmark::State& state) -> void
+    {
+        const auto handle = cxx::shared<payload, ref_count_type>::make(payload { 1 });
+        const auto weak   = cxx::weak   { handle };
+
+        for (auto _ : state)
+        {
+            weak.visit([] (payload& value)
+                       {
+                           benchmark::DoNotOptimize(value.value);
+                       });
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+}
+
+
+BENCHMARK_TEMPLATE(bulk_create_and_drop,            cxx::atomic_ref_count, 1);
+BENCHMARK_TEMPLATE(bulk_create_and_drop,            cxx:: local_ref_count, 1);
+BENCHMARK_TEMPLATE(bulk_create_and_drop_from_slabs, cxx::atomic_ref_count, 1);
+BENCHMARK_TEMPLATE(bulk_create_and_drop_from_slabs, cxx:: local_ref_count, 1);
+BENCHMARK_TEMPLATE(make_shared_copy_and_drop,                1);
+BENCHMARK_TEMPLATE(allocate_shared_copy_and_drop_from_slabs, 1);
+
+BENCHMARK_TEMPLATE(bulk_create_and_drop,            cxx::atomic_ref_count, 8);
+BENCHMARK_TEMPLATE(bulk_create_and_drop,            cxx:: local_ref_count, 8);
+BENCHMARK_TEMPLATE(bulk_create_and_drop_from_slabs, cxx::atomic_ref_count, 8);
+BENCHMARK_TEMPLATE(bulk_create_and_drop_from_slabs, cxx:: local_ref_count, 8);
+BENCHMARK_TEMPLATE(make_shared_copy_and_drop,                8);
+BENCHMARK_TEMPLATE(allocate_shared_copy_and_drop_from_slabs, 8);
+
+BENCHMARK(shared_ptr_copy_and_drop);
+BENCHMARK(weak_ptr_lock);
+BENCHMARK_TEMPLATE(weak_visit, cxx::atomic_ref_count);
+BENCHMARK_TEMPLATE(weak_visit, cxx:: local_ref_count);
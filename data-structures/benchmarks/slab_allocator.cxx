@@ -0,0 +1,262 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <cxx/slab_allocator.hxx>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <vector>
+
+#include <unistd.h>
+
+
+namespace
+{
+    constexpr auto live_objects = std::size_t { 1024 };
+    constexpr auto  batch_size  = std::size_t {  256 };
+
+    struct malloc_heap
+    {
+        static auto allocate (const std::size_t bytes) -> std::byte*
+        {
+            return static_cast<std::byte*>(std::malloc(bytes));
+        }
+
+        static auto deallocate (std::byte* const pointer, const std::size_t) -> void
+        {
+            std::free(pointer);
+        }
+    };
+
+    struct slab_heap
+    {
+        static auto allocate (const std::size_t bytes) -> std::byte*
+        {
+            return cxx::slab_allocator<std::byte> { }.allocate(bytes);
+        }
+
+        static auto deallocate (std::byte* const pointer, const std::size_t bytes) -> void
+        {
+            cxx::slab_allocator<std::byte> { }.deallocate(pointer, bytes);
+        }
+    };
+
+    struct allocation
+    {
+        std::byte*  pointer;
+        std::size_t bytes;
+    };
+
+    // [Paper] - George Marsaglia: Xorshift RNGs
+    //
+    // ~ https://www.jstatsoft.org/article/view/v008i14
+    //
+    class xorshift
+    {
+    private:
+        std::uint32_t state;
+
+    public:
+        explicit xorshift (const std::uint32_t seed) noexcept
+        :
+            state { seed }
+        {
+        }
+
+        auto operator () () noexcept -> std::uint32_t
+        {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state <<  5;
+
+            return state;
+        }
+    };
+
+    // note: Sizes are drawn uniformly from [16, 256] bytes,
+    //       which is the range of nodes and small control blocks.
+    //
+    template <typename heap>
+    auto allocate_random (xorshift& random) -> allocation
+    {
+        const auto bytes   = std::size_t { 16 + random() % 241 };
+        const auto pointer = heap::allocate(bytes);
+
+        *pointer = std::byte { 0xA5 };
+
+        return allocation { pointer, bytes };
+    }
+
+    // note: The resident set size includes memory retained by the heaps
+    //       from previously run benchmarks, so for a fair comparison run
+    //       each benchmark in a separate process with --benchmark_filter.
+    //
+    auto resident_set_size () -> double
+    {
+        constexpr auto mebibyte = 1024.0 * 1024.0;
+
+        auto statm = std::ifstream { "/proc/self/statm" };
+
+        auto total_pages    = std::int64_t { 0 };
+        auto resident_pages = std::int64_t { 0 };
+
+        statm >> total_pages >> resident_pages;
+
+        return static_cast<double>(resident_pages * ::sysconf(_SC_PAGESIZE)) / mebibyte;
+    }
+
+    // note: Every thread repeatedly replaces each of its live objects
+    //       with a new one of a random size, so objects are freed
+    //       on the same thread, which allocated them.
+    //
+    template <typename heap>
+    auto churn (benchmark::State& state) -> void
+    {
+        auto random = xorshift { static_cast<std::uint32_t>(state.thread_index + 1) };
+
+        auto allocations = std::vector<allocation> { };
+
+        for (auto n = std::size_t { 0 }; n != live_objects; ++n)
+        {
+            allocations.push_back(allocate_random<heap>(random));
+        }
+
+        for (auto _ : state)
+        {
+            for (auto& allocation : allocations)
+            {
+                heap::deallocate(allocation.pointer, allocation.bytes);
+
+                allocation = allocate_random<heap>(random);
+            }
+
+            benchmark::DoNotOptimize(allocations.data());
+        }
+
+        if (state.thread_index == 0)
+        {
+            state.counters["rss_mib"] = resident_set_size();
+        }
+
+        for (const auto& allocation : allocations)
+        {
+            heap::deallocate(allocation.pointer, allocation.bytes);
+        }
+
+        state.SetItemsProcessed(state.iterations() * live_objects);
+    }
+
+    // note: Every thread allocates batches of objects and hands them over
+    //       through a shared queue to whichever thread frees them next,
+    //       so most objects are freed on another thread than their own.
+    //
+    template <typename heap>
+    auto handoff (benchmark::State& state) -> void
+    {
+        static auto mutex   = std::mutex { };
+        static auto batches = std::deque<std::vector<allocation>> { };
+
+        auto random = xorshift { static_cast<std::uint32_t>(state.thread_index + 1) };
+
+        const auto free_batch = [] (const std::vector<allocation>& batch)
+        {
+            for (const auto& allocation : batch)
+            {
+                heap::deallocate(allocation.pointer, allocation.bytes);
+            }
+        };
+
+        for (auto _ : state)
+        {
+            auto batch = std::vector<allocation> { };
+
+            batch.reserve(batch_size);
+
+            for (auto n = std::size_t { 0 }; n != batch_size; ++n)
+            {
+                batch.push_back(allocate_random<heap>(random));
+            }
+
+            {
+                const auto lock = std::lock_guard { mutex };
+
+                batches.push_back(std::move(batch));
+
+                if (batches.size() <= static_cast<std::size_t>(state.threads))
+                {
+                    continue;
+                }
+
+                batch = std::move(batches.front());
+
+                batches.pop_front();
+            }
+
+            free_batch(batch);
+        }
+
+        if (state.thread_index == 0)
+        {
+            state.counters["rss_mib"] = resident_set_size();
+        }
+
+        {
+            const auto lock = std::lock_guard { mutex };
+
+            for (const auto& batch : batches)
+            {
+                free_batch(batch);
+            }
+
+            batches.clear();
+        }
+
+        state.SetItemsProcessed(state.iterations() * batch_size);
+    }
+}
+
+
+BENCHMARK_TEMPLATE(churn,   malloc_heap)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(churn,     slab_heap)->ThreadRange(1, 8)->UseRealTime();
+
+BENCHMARK_TEMPLATE(handoff, malloc_heap)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(handoff,   slab_heap)->ThreadRange(1, 8)->UseRealTime();
@@ -0,0 +1,177 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <cxx/list.hxx>
+#include <cxx/unrolled_list.hxx>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#include <algorithm>
+#include <vector>
+
+
+namespace
+{
+    template <typename container_type>
+    auto make_container (const std::int64_t size) -> container_type
+    {
+        auto container = container_type { };
+
+        for (auto n = std::int64_t { 0 }; n != size; ++n)
+        {
+            container.push_back(static_cast<std::int32_t>(n));
+        }
+
+        return container;
+    }
+
+    template <typename container_type>
+    auto middle_of (container_type& container)
+    {
+        if constexpr (requires { container.begin() + 1; })
+        {
+            return container.begin() + static_cast<std::ptrdiff_t>(container.size() / 2);
+        }
+        else
+        {
+            auto it = container.begin();
+
+            for (auto n = std::size_t { 0 }; n != container.size() / 2; ++n)
+            {
+                ++it;
+            }
+
+            return it;
+        }
+    }
+
+    template <typename container_type>
+    auto erase_every_other (container_type& container) -> void
+    {
+        auto it = container.begin();
+
+        while (it != container.end())
+        {
+            it = container.erase(it);
+
+            if (it != container.end())
+            {
+                ++it;
+            }
+        }
+    }
+
+    template <typename value_type>
+    auto erase_every_other (std::vector<value_type>& vector) -> void
+    {
+        auto index = std::size_t { 0 };
+
+        std::erase_if(vector, [&index] (const value_type&) { return index++ % 2 == 0; });
+    }
+
+    template <typename container_type>
+    auto iterate (benchmark::State& state) -> void
+    {
+        auto container = make_container<container_type>(state.range(0));
+
+        for (auto _ : state)
+        {
+            auto sum = std::int64_t { 0 };
+
+            for (const auto element : container)
+            {
+                sum += element;
+            }
+
+            benchmark::DoNotOptimize(sum);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    // note: The inserted element is erased right away,
+    //       so that the size of the container remains constant.
+    //
+    template <typename container_type>
+    auto insert_middle (benchmark::State& state) -> void
+    {
+        auto container = make_container<container_type>(state.range(0));
+
+        for (auto _ : state)
+        {
+            const auto inserted = container.insert(middle_of(container), std::int32_t { -1 });
+
+            benchmark::DoNotOptimize(*inserted);
+
+            container.erase(inserted);
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    template <typename container_type>
+    auto erase (benchmark::State& state) -> void
+    {
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+
+            auto container = make_container<container_type>(state.range(0));
+
+            state.ResumeTiming();
+
+            erase_every_other(container);
+
+            benchmark::DoNotOptimize(container.size());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0) / 2);
+    }
+}
+
+
+BENCHMARK_TEMPLATE(iterate,       cxx::list         <std::int32_t>)->RangeMultiplier(10)->Range(1'000, 10'000'000);
+BENCHMARK_TEMPLATE(iterate,       cxx::unrolled_list<std::int32_t>)->RangeMultiplier(10)->Range(1'000, 10'000'000);
+BENCHMARK_TEMPLATE(iterate,       std::vector       <std::int32_t>)->RangeMultiplier(10)->Range(1'000, 10'000'000);
+
+BENCHMARK_TEMPLATE(insert_middle, cxx::list         <std::int32_t>)->RangeMultiplier(10)->Range(1'000, 10'000'000);
+BENCHMARK_TEMPLATE(insert_middle, cxx::unrolled_list<std::int32_t>)->RangeMultiplier(10)->Range(1'000, 10'000'000);
+BENCHMARK_TEMPLATE(insert_middle, std::vector       <std::int32_t>)->RangeMultiplier(10)->Range(1'000, 10'000'000);
+
+BENCHMARK_TEMPLATE(erase,         cxx::list         <std::int32_t>)->RangeMultiplier(10)->Range(1'000, 10'000'000);
+BENCHMARK_TEMPLATE(erase,         cxx::unrolled_list<std::int32_t>)->RangeMultiplier(10)->Range(1'000, 10'000'000);
+BENCHMARK_TEMPLATE(erase,         std::vector       <std::int32_t>)->RangeMultiplier(10)->Range(1'000, 10'000'000);
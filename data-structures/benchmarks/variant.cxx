@@ -0,0 +1,210 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <cxx/variant.hxx>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <array>
+#include <random>
+#include <utility>
+#include <variant>
+#include <vector>
+
+
+namespace
+{
+    // note: The instructions imitate a decode and dispatch loop of an interpreter,
+    //       in which every kind of instruction performs slightly different work.
+    //
+    template <std::size_t kind>
+    struct instruction
+    {
+        std::uint32_t operand;
+
+        auto execute (const std::uint64_t accumulator) const noexcept -> std::uint64_t
+        {
+            if constexpr (kind % 3 == 0)
+            {
+                return accumulator + operand + kind;
+            }
+            else if constexpr (kind % 3 == 1)
+            {
+                return accumulator ^ (operand << (kind % 7));
+            }
+            else
+            {
+                return accumulator * (kind | 1) - operand;
+            }
+        }
+    };
+
+    template <template <typename ...> class variant_template, typename index_sequence>
+    struct instruction_set;
+
+    template <template <typename ...> class variant_template, std::size_t ... kinds>
+    struct instruction_set <variant_template, std::index_sequence<kinds...>>
+    {
+        using type = variant_template<instruction<kinds>...>;
+    };
+
+    template <template <typename ...> class variant_template, std::size_t count>
+    using any_instruction = typename instruction_set<variant_template, std::make_index_sequence<count>>::type;
+
+    struct std_visit
+    {
+        template <typename ... variant_types>
+        using variant = std::variant<variant_types...>;
+
+        template <typename visitor_type, typename ... variant_types>
+        static auto visit (visitor_type&& visitor, variant_types&& ... variants) -> decltype(auto)
+        {
+            return std::visit(std::forward<visitor_type>(visitor), std::forward<variant_types>(variants)...);
+        }
+    };
+
+    struct cxx_visit
+    {
+        template <typename ... variant_types>
+        using variant = cxx::variant<variant_types...>;
+
+        template <typename visitor_type, typename ... variant_types>
+        static auto visit (visitor_type&& visitor, variant_types&& ... variants) -> decltype(auto)
+        {
+            return cxx::visit(std::forward<visitor_type>(visitor), std::forward<variant_types>(variants)...);
+        }
+    };
+
+    template <typename variant_type, std::size_t kind>
+    auto make_instruction (const std::uint32_t operand) -> variant_type
+    {
+        return variant_type { std::in_place_index<kind>, instruction<kind> { operand } };
+    }
+
+    template <typename variant_type, std::size_t ... kinds>
+    auto make_program (const std::size_t length, std::index_sequence<kinds...>) -> std::vector<variant_type>
+    {
+        constexpr auto makers = std::array { &make_instruction<variant_type, kinds>... };
+
+        auto engine = std::minstd_rand { 7 };
+
+        auto program = std::vector<variant_type> { };
+
+        program.reserve(length);
+
+        for (auto index = std::size_t { 0 }; index != length; ++index)
+        {
+            program.push_back(makers[engine() % makers.size()](static_cast<std::uint32_t>(engine())));
+        }
+
+        return program;
+    }
+
+    constexpr auto program_length = std::size_t { 4096 };
+
+    template <typename visit_type, std::size_t count>
+    auto execute_program (benchmark::State& state) -> void
+    {
+        using variant_type = any_instruction<visit_type::template variant, count>;
+
+        const auto program = make_program<variant_type>(program_length, std::make_index_sequence<count> { });
+
+        for (auto _ : state)
+        {
+            auto accumulator = std::uint64_t { 0 };
+
+            for (const auto& instruction : program)
+            {
+                accumulator = visit_type::visit
+                (
+                    [accumulator] (const auto& instruction) { return instruction.execute(accumulator); },
+                    instruction
+                );
+            }
+
+            benchmark::DoNotOptimize(accumulator);
+        }
+
+        state.SetItemsProcessed(state.iterations() * program_length);
+
+        state.counters["bytes"] = sizeof(variant_type);
+    }
+
+    template <typename visit_type, std::size_t count>
+    auto execute_pairs (benchmark::State& state) -> void
+    {
+        using variant_type = any_instruction<visit_type::template variant, count>;
+
+        const auto lhs = make_program<variant_type>(program_length, std::make_index_sequence<count> { });
+        const auto rhs = make_program<variant_type>(program_length + 1, std::make_index_sequence<count> { });
+
+        for (auto _ : state)
+        {
+            auto accumulator = std::uint64_t { 0 };
+
+            for (auto index = std::size_t { 0 }; index != program_length; ++index)
+            {
+                accumulator = visit_type::visit
+                (
+                    [accumulator] (const auto& lhs, const auto& rhs)
+                    {
+                        return rhs.execute(lhs.execute(accumulator));
+                    },
+                    lhs[index], rhs[index + 1]
+                );
+            }
+
+            benchmark::DoNotOptimize(accumulator);
+        }
+
+        state.SetItemsProcessed(state.iterations() * program_length);
+    }
+}
+
+
+BENCHMARK_TEMPLATE(execute_program, std_visit,  3);
+BENCHMARK_TEMPLATE(execute_program, cxx_visit,  3);
+BENCHMARK_TEMPLATE(execute_program, std_visit, 12);
+BENCHMARK_TEMPLATE(execute_program, cxx_visit, 12);
+BENCHMARK_TEMPLATE(execute_program, std_visit, 48);
+BENCHMARK_TEMPLATE(execute_program, cxx_visit, 48);
+
+BENCHMARK_TEMPLATE(execute_pairs, std_visit,  4);
+BENCHMARK_TEMPLATE(execute_pairs, cxx_visit,  4);
+BENCHMARK_TEMPLATE(execute_pairs, std_visit, 12);
+BENCHMARK_TEMPLATE(execute_pairs, cxx_visit, 12);
@@ -0,0 +1,148 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <cxx/vector.hxx>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#include <ranges>
+
+#include <string>
+#include <vector>
+
+
+namespace
+{
+    template <typename vector_type>
+    auto push_back (benchmark::State& state) -> void
+    {
+        const auto count = state.range(0);
+
+        for (auto _ : state)
+        {
+            auto vector = vector_type { };
+
+            for (auto n = std::int64_t { 0 }; n != count; ++n)
+            {
+                vector.push_back(std::ranges::range_value_t<vector_type> { });
+            }
+
+            benchmark::DoNotOptimize(vector.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+
+    template <typename vector_type>
+    auto insert_front (benchmark::State& state) -> void
+    {
+        const auto count = state.range(0);
+
+        for (auto _ : state)
+        {
+            auto vector = vector_type { };
+
+            for (auto n = std::int64_t { 0 }; n != count; ++n)
+            {
+                vector.insert(vector.begin(), std::ranges::range_value_t<vector_type> { });
+            }
+
+            benchmark::DoNotOptimize(vector.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+
+    // note: Vectors of vectors are reallocated often, while each reallocation
+    //       moves every inner vector, thus relocating them with memcpy,
+    //       rather than move constructing and destroying them, pays off.
+    //
+    template <typename vector_type>
+    auto reallocate_nested (benchmark::State& state) -> void
+    {
+        const auto count = state.range(0);
+
+        for (auto _ : state)
+        {
+            auto vectors = vector_type { };
+
+            for (auto n = std::int64_t { 0 }; n != count; ++n)
+            {
+                vectors.emplace_back(4, std::ranges::range_value_t<std::ranges::range_value_t<vector_type>> { });
+            }
+
+            benchmark::DoNotOptimize(vectors.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+
+    template <typename vector_type>
+    auto short_lived (benchmark::State& state) -> void
+    {
+        for (auto _ : state)
+        {
+            auto vector = vector_type { };
+
+            for (auto n = 0; n != 8; ++n)
+            {
+                vector.push_back(n);
+            }
+
+            benchmark::DoNotOptimize(vector.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * 8);
+    }
+}
+
+
+BENCHMARK_TEMPLATE(push_back, std::vector<std::int32_t>)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK_TEMPLATE(push_back, cxx::vector<std::int32_t>)->RangeMultiplier(16)->Range(16, 1 << 16);
+
+BENCHMARK_TEMPLATE(push_back, std::vector<std::string>)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK_TEMPLATE(push_back, cxx::vector<std::string>)->RangeMultiplier(16)->Range(16, 1 << 16);
+
+BENCHMARK_TEMPLATE(insert_front, std::vector<std::int32_t>)->RangeMultiplier(8)->Range(8, 1 << 12);
+BENCHMARK_TEMPLATE(insert_front, cxx::vector<std::int32_t>)->RangeMultiplier(8)->Range(8, 1 << 12);
+
+BENCHMARK_TEMPLATE(reallocate_nested, std::vector<std::vector<std::int32_t>>)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK_TEMPLATE(reallocate_nested, cxx::vector<cxx::vector<std::int32_t>>)->RangeMultiplier(16)->Range(16, 1 << 16);
+
+BENCHMARK_TEMPLATE(short_lived, std::vector<std::int32_t>);
+BENCHMARK_TEMPLATE(short_lived, cxx::vector<std::int32_t>);
+BENCHMARK_TEMPLATE(short_lived, cxx::small_vector<std::int32_t, 8>);
@@ -0,0 +1,493 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef CXX_ARENA
+#define CXX_ARENA
+
+
+#include <cxx/contracts.hxx>
+
+#include <algorithm>
+
+#include <bit>
+
+#include <cstddef>
+
+#include <cstdint>
+
+#include <limits>
+
+#include <memory_resource>
+
+#include <span>
+
+#include <type_traits>
+
+
+namespace cxx
+{
+    // [Blog] - Ryan Fleury: Untangling Lifetimes: The Arena Allocator
+    //
+    // ~ https://www.rfleury.com/p/untangling-lifetimes-the-arena-allocator
+
+    // note: The monotonic_arena hands out memory by bumping a pointer,
+    //       first through the caller-supplied buffer, then through blocks
+    //       of geometrically growing size requested from the upstream resource.
+    //       Deallocating memory is a no-op, while releasing the arena
+    //       returns all blocks upstream at once and rewinds the buffer.
+    //
+    class monotonic_arena
+    {
+    private:
+        struct block
+        {
+            block*       previous;
+            std::size_t  size;
+        };
+
+        std::byte*                  current;
+        std::byte*                  limit;
+
+        std::span<std::byte>        buffer;
+
+        block*                      blocks;
+        std::size_t                 next_block_size;
+        std::size_t                 block_bytes;
+
+        std::pmr::memory_resource*  upstream;
+
+        static constexpr auto block_alignment = alignof(std::max_align_t);
+
+        [[nodiscard]]
+        static auto align_up (std::byte* const pointer, const std::size_t alignment) noexcept
+        -> std::uintptr_t
+        {
+            const auto address = reinterpret_cast<std::uintptr_t>(pointer);
+
+            return (address + alignment - 1) & ~(alignment - 1);
+        }
+
+        [[nodiscard]]
+        auto allocate_from_new_block (const std::size_t bytes,
+                                      const std::size_t alignment) -> void*
+        {
+            const auto required = sizeof(block) + bytes + alignment;
+            const auto size     = (next_block_size >= required) ? next_block_size : required;
+
+            const auto memory = static_cast<std::byte*>(upstream->allocate(size, block_alignment));
+
+            blocks = ::new (static_cast<void*>(memory)) block { blocks, size };
+
+            block_bytes     += size;
+            next_block_size  = size * 2;
+
+            current = memory + sizeof(block);
+            limit   = memory + size;
+
+            const auto aligned = reinterpret_cast<std::byte*>(align_up(current, alignment));
+
+            current = aligned + bytes;
+
+            return aligned;
+        }
+
+    public:
+        explicit monotonic_arena (const std::span<std::byte>       buffer,
+                                  std::pmr::memory_resource* const upstream =
+                                      std::pmr::new_delete_resource()) noexcept
+        :
+            current         { buffer.data()                 },
+            limit           { buffer.data() + buffer.size() },
+            buffer          { buffer                        },
+            blocks          { nullptr                       },
+            next_block_size { std::max<std::size_t>(buffer.size(), 1024) },
+            block_bytes     { 0                             },
+            upstream        { upstream                      }
+        {
+            cxx_expects(upstream != nullptr);
+        }
+
+        explicit monotonic_arena (std::pmr::memory_resource* const upstream =
+                                      std::pmr::new_delete_resource()) noexcept
+        :
+            monotonic_arena { std::span<std::byte> { }, upstream }
+        {
+        }
+
+        ~monotonic_arena () noexcept
+        {
+            release();
+        }
+
+        monotonic_arena (const monotonic_arena&) = delete;
+        auto operator = (const monotonic_arena&) -> monotonic_arena& = delete;
+
+        [[nodiscard]]
+        auto allocate (const std::size_t bytes,
+                       const std::size_t alignment = alignof(std::max_align_t)) -> void*
+        {
+            cxx_expects(std::has_single_bit(alignment));
+
+            const auto aligned = align_up(current, alignment);
+            const auto end     = reinterpret_cast<std::uintptr_t>(limit);
+
+            if ((current != nullptr) && (aligned <= end) && (bytes <= end - aligned))
+            {
+                current = reinterpret_cast<std::byte*>(aligned) + bytes;
+
+                return reinterpret_cast<std::byte*>(aligned);
+            }
+
+            return allocate_from_new_block(bytes, alignment);
+        }
+
+        auto deallocate (void* const, const std::size_t, const std::size_t) noexcept -> void
+        {
+        }
+
+        auto release () noexcept -> void
+        {
+            while (blocks != nullptr)
+            {
+                const auto previous = blocks->previous;
+                const auto size     = blocks->size;
+
+                upstream->deallocate(blocks, size, block_alignment);
+
+                blocks = previous;
+            }
+
+            current         = buffer.data();
+            limit           = buffer.data() + buffer.size();
+            next_block_size = std::max<std::size_t>(buffer.size(), 1024);
+            block_bytes     = 0;
+        }
+
+        // note: The number of bytes requested from the upstream resource,
+        //       once the caller-supplied buffer has been exhausted.
+        //
+        [[nodiscard]]
+        auto upstream_bytes () const noexcept -> std::size_t
+        {
+            return block_bytes;
+        }
+
+        [[nodiscard]]
+        auto upstream_resource () const noexcept -> std::pmr::memory_resource*
+        {
+            return upstream;
+        }
+    };
+
+    // note: The frame_arena serves allocations, which all die at once,
+    //       when the frame, for example a request, ends and the arena is reset.
+    //       Allocations, which do not fit into its buffer, spill over
+    //       into a monotonic_arena, after which the buffer is enlarged
+    //       on the next reset, so that the following frames do not spill.
+    //
+    class frame_arena
+    {
+    private:
+        std::byte*                  buffer;
+        std::size_t                 capacity;
+
+        std::byte*                  current;
+
+        monotonic_arena             overflow;
+
+        static constexpr auto buffer_alignment = alignof(std::max_align_t);
+
+    public:
+        explicit frame_arena (const std::size_t                capacity,
+                              std::pmr::memory_resource* const upstream =
+                                  std::pmr::new_delete_resource())
+        :
+            buffer   { static_cast<std::byte*>(upstream->allocate(capacity, buffer_alignment)) },
+            capacity { capacity },
+            current  { buffer   },
+            overflow { upstream }
+        {
+        }
+
+        ~frame_arena () noexcept
+        {
+            overflow.upstream_resource()->deallocate(buffer, capacity, buffer_alignment);
+        }
+
+        frame_arena (const frame_arena&) = delete;
+        auto operator = (const frame_arena&) -> frame_arena& = delete;
+
+        [[nodiscard]]
+        auto allocate (const std::size_t bytes,
+                       const std::size_t alignment = alignof(std::max_align_t)) -> void*
+        {
+            cxx_expects(std::has_single_bit(alignment));
+
+            const auto address = reinterpret_cast<std::uintptr_t>(current);
+            const auto aligned = (address + alignment - 1) & ~(alignment - 1);
+            const auto end     = reinterpret_cast<std::uintptr_t>(buffer + capacity);
+
+            if ((aligned <= end) && (bytes <= end - aligned))
+            {
+                current = reinterpret_cast<std::byte*>(aligned) + bytes;
+
+                return reinterpret_cast<std::byte*>(aligned);
+            }
+
+            return overflow.allocate(bytes, alignment);
+        }
+
+        auto deallocate (void* const, const std::size_t, const std::size_t) noexcept -> void
+        {
+        }
+
+        auto reset () -> void
+        {
+            if (const auto spilled = overflow.upstream_bytes(); spilled != 0)
+            {
+                const auto upstream = overflow.upstream_resource();
+
+                const auto enlarged = static_cast<std::byte*>(
+                    upstream->allocate(capacity + spilled, buffer_alignment));
+
+                upstream->deallocate(buffer, capacity, buffer_alignment);
+
+                buffer    = enlarged;
+                capacity += spilled;
+
+                overflow.release();
+            }
+
+            current = buffer;
+        }
+
+        [[nodiscard]]
+        auto used () const noexcept -> std::size_t
+        {
+            return static_cast<std::size_t>(current - buffer) + overflow.upstream_bytes();
+        }
+
+        [[nodiscard]]
+        auto size () const noexcept -> std::size_t
+        {
+            return capacity;
+        }
+    };
+
+    // note: The arena_allocator has the same interface as the cxx::allocator,
+    //       but allocates memory from an arena, which it refers to.
+    //
+    template <typename type, typename arena_type = cxx::monotonic_arena>
+    requires std::is_object_v<type>
+    //
+    class arena_allocator
+    {
+        static_assert(sizeof(type) != 0, "incomplete types are not supported");
+
+        template <typename other_type, typename other_arena_type>
+        requires std::is_object_v<other_type>
+        //
+        friend class arena_allocator;
+
+    private:
+        arena_type* arena;
+
+    public:
+        using      value_type = type;
+        using       size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+
+        constexpr explicit(false) arena_allocator (arena_type& arena) noexcept
+        :
+            arena { &arena }
+        {
+        }
+
+        template <typename other>
+        constexpr explicit(false) arena_allocator (const arena_allocator<other, arena_type>& allocator) noexcept
+        :
+            arena { allocator.arena }
+        {
+        }
+
+        [[nodiscard]]
+        auto allocate (const std::size_t count) -> type*
+        {
+            cxx_expects(count <= max_size());
+
+            return static_cast<type*>(arena->allocate(count * sizeof(type), alignof(type)));
+        }
+
+        auto deallocate (type* const       pointer,
+                         const std::size_t count) noexcept -> void
+        {
+            arena->deallocate(pointer, count * sizeof(type), alignof(type));
+        }
+
+        [[nodiscard]]
+        constexpr auto max_size () const noexcept -> std::size_t
+        {
+            return static_cast<std::size_t>(std::numeric_limits<std::ptrdiff_t>::max()) / sizeof(type);
+        }
+
+        [[nodiscard]]
+        constexpr auto get_arena () const noexcept -> arena_type&
+        {
+            return *arena;
+        }
+
+        template <typename other>
+        [[nodiscard]]
+        constexpr
+        auto operator == (const arena_allocator<other, arena_type>& allocator) const noexcept -> bool
+        {
+            return arena == allocator.arena;
+        }
+    };
+
+    // note: The memory_resource_adapter exposes an arena,
+    //       as the std::pmr::memory_resource, to the standard containers.
+    //
+    template <typename arena_type>
+    class memory_resource_adapter final : public std::pmr::memory_resource
+    {
+    private:
+        arena_type* arena;
+
+        auto do_allocate (const std::size_t bytes, const std::size_t alignment) -> void* override
+        {
+            return arena->allocate(bytes, alignment);
+        }
+
+        auto do_deallocate (void* const pointer, const std::size_t bytes,
+                            const std::size_t alignment) -> void override
+        {
+            arena->deallocate(pointer, bytes, alignment);
+        }
+
+        auto do_is_equal (const std::pmr::memory_resource& other) const noexcept -> bool override
+        {
+            return this == &other;
+        }
+
+    public:
+        explicit memory_resource_adapter (arena_type& arena) noexcept
+        :
+            arena { &arena }
+        {
+        }
+    };
+
+    // note: The resource_allocator has the same interface as the cxx::allocator,
+    //       but allocates memory from any std::pmr::memory_resource,
+    //       such as the std::pmr::monotonic_buffer_resource.
+    //
+    template <typename type>
+    requires std::is_object_v<type>
+    //
+    class resource_allocator
+    {
+        static_assert(sizeof(type) != 0, "incomplete types are not supported");
+
+        template <typename other_type>
+        requires std::is_object_v<other_type>
+        //
+        friend class resource_allocator;
+
+    private:
+        std::pmr::memory_resource* resource;
+
+    public:
+        using      value_type = type;
+        using       size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+
+        resource_allocator () noexcept
+        :
+            resource { std::pmr::get_default_resource() }
+        {
+        }
+
+        explicit(false) resource_allocator (std::pmr::memory_resource* const resource) noexcept
+        :
+            resource { resource }
+        {
+            cxx_expects(resource != nullptr);
+        }
+
+        template <typename other>
+        explicit(false) resource_allocator (const resource_allocator<other>& allocator) noexcept
+        :
+            resource { allocator.resource }
+        {
+        }
+
+        [[nodiscard]]
+        auto allocate (const std::size_t count) -> type*
+        {
+            cxx_expects(count <= max_size());
+
+            return static_cast<type*>(resource->allocate(count * sizeof(type), alignof(type)));
+        }
+
+        auto deallocate (type* const       pointer,
+                         const std::size_t count) noexcept -> void
+        {
+            resource->deallocate(pointer, count * sizeof(type), alignof(type));
+        }
+
+        [[nodiscard]]
+        constexpr auto max_size () const noexcept -> std::size_t
+        {
+            return static_cast<std::size_t>(std::numeric_limits<std::ptrdiff_t>::max()) / sizeof(type);
+        }
+
+        [[nodiscard]]
+        auto get_resource () const noexcept -> std::pmr::memory_resource*
+        {
+            return resource;
+        }
+
+        template <typename other>
+        [[nodiscard]]
+        auto operator == (const resource_allocator<other>& allocator) const noexcept -> bool
+        {
+            return (resource == allocator.resource) || resource->is_equal(*allocator.resource);
+        }
+    };
+}
+
+
+#endif
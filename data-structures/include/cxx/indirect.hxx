@@ -39,6 +39,10 @@
 
 #include <cstdlib>
 
+#include <cstddef>
+
+#include <memory>
+
 #include <utility>
 
 #include <concepts>
@@ -99,41 +103,118 @@ namespace cxx
     //       though it requires accessing value indirectly,
     //       through either the dereference operator or the arrow operator.
     //
-    template <std::destructible value_type>
+    //       When the value_type fits into inline_size bytes
+    //       and can be moved without throwing, the cxx::indirect<> stores
+    //       the value inline instead, so that it doesn't allocate at all,
+    //       at the cost of moving the value, rather than a pointer,
+    //       whenever the cxx::indirect<> itself is moved.
+    //
+    template <std::destructible value_type, std::size_t inline_size = 0>
     class indirect
     {
     private:
-        value_type* ptr;
+        static constexpr auto is_inline = bool
+        {
+            (sizeof(value_type) <= inline_size) &&
+            std::is_nothrow_move_constructible_v<value_type>
+        };
+
+        struct heap_storage
+        {
+            value_type* ptr;
+        };
+
+        union inline_storage
+        {
+            value_type value;
+
+            constexpr  inline_storage () noexcept { }
+            constexpr ~inline_storage () noexcept { }
+        };
+
+        std::conditional_t<is_inline, inline_storage, heap_storage> storage;
+
+        [[nodiscard]]
+        constexpr auto get () const noexcept -> value_type*
+        {
+            if constexpr (is_inline)
+            {
+                return const_cast<value_type*>(std::addressof(storage.value));
+            }
+            else
+            {
+                return storage.ptr;
+            }
+        }
+
+        constexpr auto destroy () noexcept -> void
+        {
+            if constexpr (is_inline)
+            {
+                std::destroy_at(std::addressof(storage.value));
+            }
+            else
+            {
+                delete storage.ptr;
+            }
+        }
 
 
     public:
         template <typename ... types>
         constexpr explicit indirect (types&& ... args)
         requires std::constructible_from<value_type, types&&...>
-        :
-            ptr { new value_type(std::forward<types>(args)...) }
         {
+            if constexpr (is_inline)
+            {
+                std::construct_at(std::addressof(storage.value), std::forward<types>(args)...);
+            }
+            else
+            {
+                storage.ptr = new value_type(std::forward<types>(args)...);
+            }
         }
 
         constexpr ~indirect () noexcept
         {
-            delete ptr;
+            destroy();
         }
 
 
+        // note: A moved from cxx::indirect<> with inline storage
+        //       holds a moved from value, while one with heap storage
+        //       holds no value at all. Either can only be destroyed
+        //       or assigned to.
+        //
         constexpr indirect (indirect&& other) noexcept
-        :
-            ptr { other.ptr }
         {
-            other.ptr = nullptr;
+            if constexpr (is_inline)
+            {
+                std::construct_at(std::addressof(storage.value), std::move(other.storage.value));
+            }
+            else
+            {
+                storage.ptr = std::exchange(other.storage.ptr, nullptr);
+            }
         }
 
         constexpr auto operator = (indirect&& other) noexcept -> indirect&
         {
-            delete ptr;
-
-            this->ptr = other.ptr;
-            other.ptr = nullptr;
+            if constexpr (is_inline)
+            {
+                if (this != &other)
+                {
+                    destroy();
+
+                    std::construct_at(std::addressof(storage.value), std::move(other.storage.value));
+                }
+            }
+            else
+            {
+                delete storage.ptr;
+
+                storage.ptr = std::exchange(other.storage.ptr, nullptr);
+            }
 
             return *this;
         }
@@ -142,7 +223,7 @@ namespace cxx
         constexpr indirect (const indirect& other)
         requires std::is_copy_constructible_v<value_type>
         :
-            ptr { new value_type(*other) }
+            indirect(*other)
         {
         }
 
@@ -153,7 +234,7 @@ namespace cxx
             // note: The cxx::indirect<> template class relies on
             //       the value_type to handle self-assignment correctly.
             //
-            *ptr = *other;
+            **this = *other;
 
             return *this;
         }
@@ -164,45 +245,52 @@ namespace cxx
         noexcept(cxx::is_nothrow_equality_comparable<value_type>) -> bool
         requires std::           equality_comparable<value_type>
         {
-            return *this->ptr == *other.ptr;
+            return *get() == *other.get();
         }
 
 
         [[nodiscard]]
         constexpr auto operator * () const &  noexcept -> const value_type&
         {
-            return *ptr;
+            return *get();
         }
 
         [[nodiscard]]
         constexpr auto operator * ()       &  noexcept ->       value_type&
         {
-            return *ptr;
+            return *get();
         }
 
         [[nodiscard]]
         constexpr auto operator * () const && noexcept -> const value_type&&
         {
-            return std::move(*ptr);
+            return std::move(*get());
         }
 
         [[nodiscard]]
         constexpr auto operator * ()       && noexcept ->       value_type&&
         {
-            return std::move(*ptr);
+            return std::move(*get());
         }
 
 
         [[nodiscard]]
         constexpr auto operator -> () const noexcept -> const value_type*
         {
-            return ptr;
+            return get();
         }
 
         [[nodiscard]]
         constexpr auto operator -> ()       noexcept ->       value_type*
         {
-            return ptr;
+            return get();
+        }
+
+
+        [[nodiscard]]
+        static constexpr auto is_stored_inline () noexcept -> bool
+        {
+            return is_inline;
         }
     };
 }
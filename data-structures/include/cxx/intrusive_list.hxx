@@ -0,0 +1,452 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef CXX_INTRUSIVE_LIST
+#define CXX_INTRUSIVE_LIST
+
+
+#include <cassert>
+
+#include <cstddef>
+
+#include <type_traits>
+
+
+namespace cxx
+{
+    // note: Elements of the intrusive_list embed their own links,
+    //       by deriving from the intrusive_list_hook, thus linking them
+    //       never allocates memory. The tag allows a single element
+    //       to be linked into several lists at the same time.
+    //
+    template <typename tag = void>
+    class intrusive_list_hook
+    {
+    private:
+        template <typename value_type, typename list_tag>
+        requires std::is_base_of_v<intrusive_list_hook<list_tag>, value_type>
+        //
+        friend class intrusive_list;
+
+        intrusive_list_hook* next;
+        intrusive_list_hook* prev;
+
+    public:
+        constexpr intrusive_list_hook () noexcept
+        :
+            next { nullptr },
+            prev { nullptr }
+        {
+        }
+
+        // note: Copying an element does not copy its links.
+        //
+        constexpr intrusive_list_hook (const intrusive_list_hook&) noexcept
+        :
+            intrusive_list_hook { }
+        {
+        }
+
+        constexpr
+        auto operator = (const intrusive_list_hook&) noexcept -> intrusive_list_hook&
+        {
+            return *this;
+        }
+    };
+
+    //                +-------+   +-------+   +-------+
+    //    sentinel -->| next  |-->| next  |-->| next  |--> sentinel
+    //                |-------|   |-------|   |-------|
+    //    sentinel <--| prev  |<--| prev  |<--| prev  |<-- sentinel
+    //                |-------|   |-------|   |-------|
+    //                | value |   | value |   | value |
+    //                +-------+   +-------+   +-------+
+    //
+    // note: The list does not own its elements, which have to outlive
+    //       their membership in the list.
+    //
+    template <typename value_type, typename tag = void>
+    requires std::is_base_of_v<intrusive_list_hook<tag>, value_type>
+    //
+    class intrusive_list
+    {
+    private:
+        using hook = intrusive_list_hook<tag>;
+
+        hook         sentinel;
+        std::size_t  length;
+
+        template <bool constant>
+        struct iterator
+        {
+        private:
+            friend intrusive_list;
+            friend iterator<!constant>;
+
+            hook* hook_ptr;
+
+            using element_type = std::conditional_t<constant, const value_type,
+                                                                    value_type>;
+
+        public:
+            explicit constexpr iterator (hook* const h = nullptr) noexcept
+            :
+                hook_ptr { h }
+            {
+            }
+
+            template <bool other_constant> requires (constant && !other_constant)
+            //
+            constexpr explicit(false) iterator (const iterator<other_constant>& it) noexcept
+            :
+                hook_ptr { it.hook_ptr }
+            {
+            }
+
+            constexpr auto operator * () const noexcept -> element_type&
+            {
+                assert(hook_ptr != nullptr);
+
+                return static_cast<element_type&>(*hook_ptr);
+            }
+
+            constexpr auto operator -> () const noexcept -> element_type*
+            {
+                assert(hook_ptr != nullptr);
+
+                return static_cast<element_type*>(hook_ptr);
+            }
+
+            constexpr auto operator ++ () noexcept -> iterator&
+            {
+                assert(hook_ptr != nullptr);
+
+                hook_ptr = hook_ptr->next;
+
+                return *this;
+            }
+
+            constexpr auto operator -- () noexcept -> iterator&
+            {
+                assert(hook_ptr != nullptr);
+
+                hook_ptr = hook_ptr->prev;
+
+                return *this;
+            }
+
+            constexpr
+            auto operator == (const iterator& it) const noexcept -> bool
+            {
+                return this->hook_ptr == it.hook_ptr;
+            }
+
+            constexpr
+            auto operator != (const iterator& it) const noexcept -> bool
+            {
+                return this->hook_ptr != it.hook_ptr;
+            }
+        };
+
+        using mutable_iterator = iterator<false>;
+        using   const_iterator = iterator<true >;
+
+        static constexpr auto link (hook* const position, hook* const h) noexcept -> void
+        {
+            h->next = position;
+            h->prev = position->prev;
+
+            position->prev->next = h;
+            position->prev       = h;
+        }
+
+        static constexpr auto unlink (hook* const h) noexcept -> void
+        {
+            h->prev->next = h->next;
+            h->next->prev = h->prev;
+
+            h->next = nullptr;
+            h->prev = nullptr;
+        }
+
+    public:
+        constexpr intrusive_list () noexcept
+        :
+            sentinel { },
+            length   { 0 }
+        {
+            sentinel.next = &sentinel;
+            sentinel.prev = &sentinel;
+        }
+
+        // note: Destroying the list clears it, so that its elements,
+        //       which outlive it, can be linked into another list.
+        //
+        constexpr ~intrusive_list () noexcept
+        {
+            clear();
+        }
+
+        intrusive_list (const intrusive_list&) = delete;
+        auto operator = (const intrusive_list&) -> intrusive_list& = delete;
+
+        constexpr intrusive_list (intrusive_list&& other) noexcept
+        :
+            intrusive_list { }
+        {
+            splice(end(), other);
+        }
+
+        constexpr auto operator = (intrusive_list&& other) noexcept -> intrusive_list&
+        {
+            if (this != &other)
+            {
+                clear();
+                splice(end(), other);
+            }
+
+            return *this;
+        }
+
+        constexpr auto push_back (value_type& value) noexcept -> void
+        {
+            insert(end(), value);
+        }
+
+        constexpr auto push_front (value_type& value) noexcept -> void
+        {
+            insert(begin(), value);
+        }
+
+        constexpr auto pop_front () noexcept -> void
+        {
+            assert(length > 0);
+
+            erase(begin());
+        }
+
+        constexpr auto pop_back () noexcept -> void
+        {
+            assert(length > 0);
+
+            erase(const_iterator { sentinel.prev });
+        }
+
+        constexpr
+        auto insert (const const_iterator position, value_type& value) noexcept -> mutable_iterator
+        {
+            auto& h = static_cast<hook&>(value);
+
+            assert((h.next == nullptr) && (h.prev == nullptr));
+
+            link(position.hook_ptr, &h);
+
+            ++length;
+
+            return mutable_iterator { &h };
+        }
+
+        constexpr auto erase (const const_iterator position) noexcept -> mutable_iterator
+        {
+            assert((length > 0) && (position.hook_ptr != &sentinel));
+
+            const auto next = position.hook_ptr->next;
+
+            unlink(position.hook_ptr);
+
+            --length;
+
+            return mutable_iterator { next };
+        }
+
+        // note: The iterator_to allows erasing or splicing an element,
+        //       found by other means than traversing the list, in constant time.
+        //
+        [[nodiscard]]
+        constexpr auto iterator_to (value_type& value) noexcept -> mutable_iterator
+        {
+            return mutable_iterator { &static_cast<hook&>(value) };
+        }
+
+        constexpr auto splice (const const_iterator position, intrusive_list& other) noexcept -> void
+        {
+            if ((this == &other) || other.empty())
+            {
+                return;
+            }
+
+            const auto first = other.sentinel.next;
+            const auto last  = other.sentinel.prev;
+
+            const auto next  = position.hook_ptr;
+            const auto prev  = next->prev;
+
+            first->prev = prev;
+            last ->next = next;
+            prev ->next = first;
+            next ->prev = last;
+
+            length += other.length;
+
+            other.sentinel.next = &other.sentinel;
+            other.sentinel.prev = &other.sentinel;
+            other.length        = 0;
+        }
+
+        constexpr auto splice (const const_iterator position,
+                               intrusive_list&      other,
+                               const const_iterator it) noexcept -> void
+        {
+            assert(it.hook_ptr != &other.sentinel);
+
+            if ((position == it) || (position.hook_ptr == it.hook_ptr->next))
+            {
+                return;
+            }
+
+            unlink(it.hook_ptr);
+            link(position.hook_ptr, it.hook_ptr);
+
+            --other.length;
+            ++      length;
+        }
+
+        [[nodiscard]]
+        constexpr auto front () const noexcept -> const value_type&
+        {
+            assert(length > 0);
+
+            return *begin();
+        }
+
+        [[nodiscard]]
+        constexpr auto front () noexcept -> value_type&
+        {
+            assert(length > 0);
+
+            return *begin();
+        }
+
+        [[nodiscard]]
+        constexpr auto back () const noexcept -> const value_type&
+        {
+            assert(length > 0);
+
+            return *const_iterator { sentinel.prev };
+        }
+
+        [[nodiscard]]
+        constexpr auto back () noexcept -> value_type&
+        {
+            assert(length > 0);
+
+            return *mutable_iterator { sentinel.prev };
+        }
+
+        [[nodiscard]]
+        constexpr auto size () const noexcept -> std::size_t
+        {
+            return length;
+        }
+
+        [[nodiscard]]
+        constexpr auto empty () const noexcept -> bool
+        {
+            return length == 0;
+        }
+
+        // note: Clearing the list never deallocates memory,
+        //       it only resets links embedded in the elements,
+        //       so that they can be linked into a list again.
+        //
+        constexpr auto clear () noexcept -> void
+        {
+            auto current = sentinel.next;
+
+            while (current != &sentinel)
+            {
+                const auto next = current->next;
+
+                current->next = nullptr;
+                current->prev = nullptr;
+
+                current = next;
+            }
+
+            sentinel.next = &sentinel;
+            sentinel.prev = &sentinel;
+            length        = 0;
+        }
+
+        [[nodiscard]]
+        constexpr auto begin () noexcept -> mutable_iterator
+        {
+            return mutable_iterator { sentinel.next };
+        }
+
+        [[nodiscard]]
+        constexpr auto begin () const noexcept -> const_iterator
+        {
+            return const_iterator { sentinel.next };
+        }
+
+        [[nodiscard]]
+        constexpr auto cbegin () const noexcept -> const_iterator
+        {
+            return begin();
+        }
+
+        [[nodiscard]]
+        constexpr auto end () noexcept -> mutable_iterator
+        {
+            return mutable_iterator { &sentinel };
+        }
+
+        [[nodiscard]]
+        constexpr auto end () const noexcept -> const_iterator
+        {
+            return const_iterator { const_cast<hook*>(&sentinel) };
+        }
+
+        [[nodiscard]]
+        constexpr auto cend () const noexcept -> const_iterator
+        {
+            return end();
+        }
+    };
+}
+
+
+#endif
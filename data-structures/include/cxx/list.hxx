@@ -37,17 +37,250 @@
 #define CXX_LIST
 
 
+#include <cxx/allocator.hxx>
+
 #include <cassert>
 
 #include <cstddef>
 
+#include <algorithm>
+
 #include <initializer_list>
 
+#include <memory>
+
+#include <new>
+
 #include <type_traits>
 
+#include <utility>
+
 
 namespace cxx
 {
+    namespace detail
+    {
+        //    first_slab
+        //        |
+        //        v
+        //    +--------+   +--------+   +--------+
+        //    |  next  |-->|  next  |-->|  next  |--> null
+        //    |--------|   |--------|   |--------|
+        //    |  slot  |   |  slot  |   |  slot  |
+        //    |  slot  |   |  slot  |   |  slot  |
+        //    |  ....  |   |  ....  |   |  ....  |
+        //    +--------+   +--------+   +--------+
+        //                                  ^
+        //                                  |
+        //                              last_slab
+        //
+        // note: The node_pool allocates nodes in slabs of slots,
+        //       handing out never used slots of the first slab,
+        //       or slots returned to the free list, and frees
+        //       whole slabs at once, only when it is released.
+        //
+        //       Slabs grow geometrically, starting from a few slots,
+        //       so that short lists do not reserve a whole page,
+        //       up to a page, so that long lists do not overallocate.
+        //
+        template <typename node_type, typename allocator_type>
+        class node_pool
+        {
+        private:
+            union slot;
+
+            struct slab_header
+            {
+                slot*       next;
+                std::size_t slot_count;
+            };
+
+            // note: The first slot of every slab holds its header,
+            //       so that slabs of different sizes share a single type.
+            //
+            union slot
+            {
+                slab_header header;
+                slot*       next_free;
+                node_type   node;
+
+                slot  () noexcept { }
+                ~slot () noexcept { }
+            };
+
+            static constexpr auto min_slot_count = std::size_t { 4 };
+
+            static constexpr auto max_slot_count =
+                std::max(std::size_t { 4096 } / sizeof(slot), std::size_t { 16 });
+
+            using slab_allocator_type =
+                typename std::allocator_traits<allocator_type>::template rebind_alloc<slot>;
+
+            using slab_allocator_traits = std::allocator_traits<slab_allocator_type>;
+
+            slot*        first_slab;
+            slot*         last_slab;
+            slot*        free_slots;
+            std::size_t  unused_slots;
+
+            [[no_unique_address]] slab_allocator_type slab_allocator;
+
+            auto forget () noexcept -> void
+            {
+                first_slab   = nullptr;
+                last_slab    = nullptr;
+                free_slots   = nullptr;
+                unused_slots = 0;
+            }
+
+        public:
+            explicit node_pool (const allocator_type& allocator) noexcept
+            :
+                first_slab     { nullptr   },
+                last_slab      { nullptr   },
+                free_slots     { nullptr   },
+                unused_slots   {    0      },
+                slab_allocator { allocator }
+            {
+            }
+
+            ~node_pool () noexcept
+            {
+                release();
+            }
+
+            node_pool (const node_pool&) = delete;
+            auto operator = (const node_pool&) -> node_pool& = delete;
+
+            node_pool (node_pool&& other) noexcept
+            :
+                first_slab     { other.first_slab   },
+                last_slab      { other.last_slab    },
+                free_slots     { other.free_slots   },
+                unused_slots   { other.unused_slots },
+                slab_allocator { std::move(other.slab_allocator) }
+            {
+                other.forget();
+            }
+
+            auto operator = (node_pool&& other) noexcept -> node_pool&
+            {
+                if (this != &other)
+                {
+                    release();
+
+                    first_slab     = other.first_slab;
+                    last_slab      = other.last_slab;
+                    free_slots     = other.free_slots;
+                    unused_slots   = other.unused_slots;
+                    slab_allocator = std::move(other.slab_allocator);
+
+                    other.forget();
+                }
+
+                return *this;
+            }
+
+            [[nodiscard]]
+            auto get_allocator () const noexcept -> allocator_type
+            {
+                return allocator_type { slab_allocator };
+            }
+
+            [[nodiscard]]
+            auto allocate () -> node_type*
+            {
+                if (free_slots != nullptr)
+                {
+                    const auto free_slot = free_slots;
+
+                    free_slots = free_slot->next_free;
+
+                    return &free_slot->node;
+                }
+
+                if (unused_slots == 0)
+                {
+                    const auto slot_count = (first_slab == nullptr)
+                                          ? min_slot_count
+                                          : std::min(2 * first_slab->header.slot_count, max_slot_count);
+
+                    const auto new_slab = slab_allocator_traits::allocate(slab_allocator, slot_count + 1);
+
+                    ::new (static_cast<void*>(new_slab)) slot { };
+
+                    new_slab->header = slab_header { first_slab, slot_count };
+                    first_slab       = new_slab;
+
+                    if (last_slab == nullptr)
+                    {
+                        last_slab = new_slab;
+                    }
+
+                    unused_slots = slot_count;
+                }
+
+                return &first_slab[1 + first_slab->header.slot_count - unused_slots--].node;
+            }
+
+            auto deallocate (node_type* const node) noexcept -> void
+            {
+                const auto free_slot = reinterpret_cast<slot*>(node);
+
+                free_slot->next_free = free_slots;
+                free_slots           = free_slot;
+            }
+
+            // note: The slabs of the other pool are appended to this pool,
+            //       but its free and never used slots are not, because
+            //       linking them would not take constant time.
+            //       They are freed along with their slabs instead.
+            //
+            auto adopt (node_pool& other) noexcept -> void
+            {
+                assert(slab_allocator == other.slab_allocator);
+
+                if (other.first_slab == nullptr)
+                {
+                    return;
+                }
+
+                if (first_slab == nullptr)
+                {
+                    first_slab   = other.first_slab;
+                    free_slots   = other.free_slots;
+                    unused_slots = other.unused_slots;
+                }
+                else
+                {
+                    last_slab->header.next = other.first_slab;
+                }
+
+                last_slab = other.last_slab;
+
+                other.forget();
+            }
+
+            auto release () noexcept -> void
+            {
+                auto current = first_slab;
+
+                while (current != nullptr)
+                {
+                    const auto next       = current->header.next;
+                    const auto slot_count = current->header.slot_count;
+
+                    current->~slot();
+                    slab_allocator_traits::deallocate(slab_allocator, current, slot_count + 1);
+
+                    current = next;
+                }
+
+                forget();
+            }
+        };
+    }
+
     //            +-------+   +-------+   +-------+
     //    head -->| next  |-->| next  |-->| next  |--> null
     //            |-------|   |-------|   |-------|
@@ -56,7 +289,7 @@ namespace cxx
     //            | value |   | value |   | value |
     //            +-------+   +-------+   +-------+
 
-    template <typename value_type>
+    template <typename value_type, typename allocator_type = cxx::allocator<value_type>>
     class list
     {
     private:
@@ -71,10 +304,15 @@ namespace cxx
         node*          tail;
         std::size_t  length;
 
+        detail::node_pool<node, allocator_type> pool;
+
         template <bool constant>
         struct iterator
         {
         private:
+            friend list;
+            friend iterator<!constant>;
+
             node* node_ptr;
 
             using element_type = std::conditional_t<constant, const value_type,
@@ -87,6 +325,14 @@ namespace cxx
             {
             }
 
+            template <bool other_constant> requires (constant && !other_constant)
+            //
+            constexpr explicit(false) iterator (const iterator<other_constant>& it) noexcept
+            :
+                node_ptr { it.node_ptr }
+            {
+            }
+
             constexpr auto operator * () const noexcept -> element_type&
             {
                 assert(node_ptr != nullptr);
@@ -135,18 +381,49 @@ namespace cxx
         using mutable_iterator = iterator<false>;
         using   const_iterator = iterator<true >;
 
+        auto create_node (node* const next, node* const prev,
+                          const value_type& value) -> node*
+        {
+            const auto storage = pool.allocate();
+
+            try
+            {
+                return ::new (static_cast<void*>(storage)) node { next, prev, value };
+            }
+            catch (...)
+            {
+                pool.deallocate(storage);
+                throw;
+            }
+        }
+
+        auto destroy_node (node* const n) noexcept -> void
+        {
+            std::destroy_at(n);
+
+            pool.deallocate(n);
+        }
+
     public:
-        constexpr list () noexcept
+        list () noexcept(std::is_nothrow_default_constructible_v<allocator_type>)
         :
-            head   { nullptr },
-            tail   { nullptr },
-            length {    0    }
+            list ( allocator_type { } )
         {
         }
 
-        explicit list (const std::initializer_list<value_type> init_list)
+        explicit list (const allocator_type& allocator) noexcept
         :
-            list { }
+            head   {  nullptr  },
+            tail   {  nullptr  },
+            length {     0     },
+            pool   { allocator }
+        {
+        }
+
+        explicit list (const std::initializer_list<value_type> init_list,
+                       const allocator_type& allocator = allocator_type { })
+        :
+            list ( allocator )
         {
             for (auto& elem : init_list)
             {
@@ -161,7 +438,8 @@ namespace cxx
 
         list (const list& other)
         :
-            list { }
+            list ( std::allocator_traits<allocator_type>::
+                   select_on_container_copy_construction(other.get_allocator()) )
         {
             for (const auto& elem : other)
             {
@@ -197,11 +475,12 @@ namespace cxx
             return *this;
         }
 
-        constexpr list (list&& other) noexcept
+        list (list&& other) noexcept
         :
             head   { other.head   },
             tail   { other.tail   },
-            length { other.length }
+            length { other.length },
+            pool   { std::move(other.pool) }
         {
             other.head   = nullptr;
             other.tail   = nullptr;
@@ -215,6 +494,7 @@ namespace cxx
             head   = other.head;
             tail   = other.tail;
             length = other.length;
+            pool   = std::move(other.pool);
 
             other.head   = nullptr;
             other.tail   = nullptr;
@@ -223,9 +503,15 @@ namespace cxx
             return *this;
         }
 
+        [[nodiscard]]
+        auto get_allocator () const noexcept -> allocator_type
+        {
+            return pool.get_allocator();
+        }
+
         auto push_back (const value_type& value) -> void
         {
-            const auto last = new node { nullptr, tail, value };
+            const auto last = create_node(nullptr, tail, value);
 
             if (length == 0)
             {
@@ -245,7 +531,7 @@ namespace cxx
 
         auto push_front (const value_type& value) -> void
         {
-            const auto first = new node { head, nullptr, value };
+            const auto first = create_node(head, nullptr, value);
 
             if (length == 0)
             {
@@ -282,7 +568,7 @@ namespace cxx
 
             --length;
 
-            delete first;
+            destroy_node(first);
         }
 
         auto pop_back () noexcept -> void
@@ -304,7 +590,86 @@ namespace cxx
 
             --length;
 
-            delete last;
+            destroy_node(last);
+        }
+
+        auto insert (const const_iterator position, const value_type& value) -> mutable_iterator
+        {
+            const auto next = position.node_ptr;
+            const auto prev = (next == nullptr) ? tail : next->prev;
+
+            const auto inserted = create_node(next, prev, value);
+
+            if (prev == nullptr) { head       = inserted; }
+            else                 { prev->next = inserted; }
+
+            if (next == nullptr) { tail       = inserted; }
+            else                 { next->prev = inserted; }
+
+            ++length;
+
+            return mutable_iterator { inserted };
+        }
+
+        auto erase (const const_iterator position) noexcept -> mutable_iterator
+        {
+            const auto erased = position.node_ptr;
+
+            assert((length > 0) && (erased != nullptr));
+
+            const auto next = erased->next;
+            const auto prev = erased->prev;
+
+            if (prev == nullptr) { head       = next; }
+            else                 { prev->next = next; }
+
+            if (next == nullptr) { tail       = prev; }
+            else                 { next->prev = prev; }
+
+            --length;
+
+            destroy_node(erased);
+
+            return mutable_iterator { next };
+        }
+
+        // note: Splicing moves all nodes of the other list in constant time,
+        //       along with the slabs they have been allocated from,
+        //       thus both lists have to use equal allocators.
+        //
+        auto splice (const const_iterator position, list& other) noexcept -> void
+        {
+            assert(this != &other);
+
+            if (other.empty())
+            {
+                return;
+            }
+
+            const auto next = position.node_ptr;
+            const auto prev = (next == nullptr) ? tail : next->prev;
+
+            other.head->prev = prev;
+            other.tail->next = next;
+
+            if (prev == nullptr) { head       = other.head; }
+            else                 { prev->next = other.head; }
+
+            if (next == nullptr) { tail       = other.tail; }
+            else                 { next->prev = other.tail; }
+
+            length += other.length;
+
+            pool.adopt(other.pool);
+
+            other.head   = nullptr;
+            other.tail   = nullptr;
+            other.length = 0;
+        }
+
+        auto splice (const const_iterator position, list&& other) noexcept -> void
+        {
+            splice(position, other);
         }
 
         [[nodiscard]]
@@ -351,12 +716,25 @@ namespace cxx
             return length == 0;
         }
 
+        // note: Instead of returning nodes to the pool one by one,
+        //       all slabs are freed at once, once elements are destroyed,
+        //       which is skipped entirely for trivially destructible types.
+        //
         auto clear () noexcept -> void
         {
-            while (!empty())
+            if constexpr (!std::is_trivially_destructible_v<value_type>)
             {
-                pop_back();
+                for (auto current = head; current != nullptr; current = current->next)
+                {
+                    std::destroy_at(&current->value);
+                }
             }
+
+            head   = nullptr;
+            tail   = nullptr;
+            length = 0;
+
+            pool.release();
         }
 
         [[nodiscard]]
@@ -408,10 +786,10 @@ namespace cxx
         }
     };
 
-    template <typename value_type>
+    template <typename value_type, typename allocator_type>
     [[nodiscard]]
-    constexpr auto operator == (const list<value_type>& left,
-                                const list<value_type>& right) noexcept -> bool
+    constexpr auto operator == (const list<value_type, allocator_type>& left,
+                                const list<value_type, allocator_type>& right) noexcept -> bool
     {
         if (left.size() != right.size())
         {
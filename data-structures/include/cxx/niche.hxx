@@ -0,0 +1,187 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef CXX_NICHE
+#define CXX_NICHE
+
+
+#include <concepts>
+
+#include <cstddef>
+
+#include <cstdint>
+
+#include <cstring>
+
+#include <limits>
+
+#include <type_traits>
+
+
+namespace cxx
+{
+    // note: A niche is an object representation, which no valid value
+    //       of a type can have, such as any byte other than 0 and 1 of a bool.
+    //
+    //       Wrapper types, like cxx::variant, use niches of their elements
+    //       to encode their own state, instead of storing a separate tag.
+    //
+    //       The niche_traits describe how many niches a type has
+    //       and how to read them from and write them to its raw storage.
+    //       The load() function returns the index of the niche stored,
+    //       or the count of niches, whenever the storage holds a valid value.
+    //
+    // [Rust] - Representation of Option<T> and enum layout optimizations
+    // ~ https://doc.rust-lang.org/std/option/index.html#representation
+    //
+    template <typename type>
+    struct niche_traits
+    {
+        static constexpr auto count = std::size_t { 0 };
+    };
+
+    template <typename type>
+    concept has_niche = (niche_traits<type>::count > 0);
+
+
+    // note: The tag_niche describes niches of an integer tag,
+    //       stored at the offset within the storage of a type,
+    //       whose valid values are all lower than first_spare.
+    //
+    template <std::unsigned_integral tag_type, std::size_t offset, std::size_t first_spare>
+    requires (first_spare <= std::numeric_limits<tag_type>::max())
+    //
+    struct tag_niche
+    {
+        static constexpr auto count = std::size_t
+        {
+            std::numeric_limits<tag_type>::max() - first_spare + 1
+        };
+
+        static auto store (void* const storage, const std::size_t niche) noexcept -> void
+        {
+            const auto tag = static_cast<tag_type>(first_spare + niche);
+
+            std::memcpy(static_cast<std::byte*>(storage) + offset, &tag, sizeof(tag));
+        }
+
+        [[nodiscard]]
+        static auto load (const void* const storage) noexcept -> std::size_t
+        {
+            auto tag = tag_type { };
+
+            std::memcpy(&tag, static_cast<const std::byte*>(storage) + offset, sizeof(tag));
+
+            return (tag < first_spare) ? count : (tag - first_spare);
+        }
+    };
+
+
+    // note: Only 0 and 1 are valid object representations of a bool,
+    //       which is assumed to occupy a single byte.
+    //
+    template <>
+    struct niche_traits<bool>
+    :
+        tag_niche<unsigned char, 0, 2>
+    {
+        static_assert(sizeof(bool) == sizeof(unsigned char));
+    };
+
+
+    // note: Non-null addresses lower than the alignment of a type are misaligned,
+    //       hence they never point to an object of that type.
+    //
+    template <typename type>
+    requires requires { sizeof(type); } && (alignof(type) > 1)
+    //
+    struct niche_traits <type*>
+    {
+        static_assert(sizeof(std::uintptr_t) == sizeof(type*));
+
+        static constexpr auto count = std::size_t { alignof(type) - 1 };
+
+        static auto store (void* const storage, const std::size_t niche) noexcept -> void
+        {
+            const auto address = static_cast<std::uintptr_t>(niche + 1);
+
+            std::memcpy(storage, &address, sizeof(address));
+        }
+
+        [[nodiscard]]
+        static auto load (const void* const storage) noexcept -> std::size_t
+        {
+            auto address = std::uintptr_t { };
+
+            std::memcpy(&address, storage, sizeof(address));
+
+            return ((address == 0) || (address >= alignof(type))) ? count : (address - 1);
+        }
+    };
+
+
+    // note: The sentinel_niche turns a single value of a type into its niche,
+    //       for types, which have no niches of their own, such as integers.
+    //
+    //         cxx::optional<std::uint32_t, cxx::sentinel_niche<std::uint32_t, ~0u>>
+    //
+    //       The sentinel value cannot be stored in a type using the niche.
+    //
+    template <typename type, type sentinel>
+    requires std::is_trivially_copyable_v<type>
+    //
+    struct sentinel_niche
+    {
+        static constexpr auto count = std::size_t { 1 };
+
+        static auto store (void* const storage, std::size_t) noexcept -> void
+        {
+            const auto value = sentinel;
+
+            std::memcpy(storage, &value, sizeof(value));
+        }
+
+        [[nodiscard]]
+        static auto load (const void* const storage) noexcept -> std::size_t
+        {
+            const auto value = sentinel;
+
+            return (std::memcmp(storage, &value, sizeof(value)) == 0) ? 0 : count;
+        }
+    };
+}
+
+
+#endif
@@ -37,12 +37,18 @@
 #define CXX_OPTIONAL
 
 
+#include <cxx/niche.hxx>
+
 #include <type_traits>
 
 #include <utility>
 
 #include <cassert>
 
+#include <cstddef>
+
+#include <new>
+
 
 namespace cxx
 {
@@ -52,78 +58,207 @@ namespace cxx
 
     inline constexpr auto nullopt = nullopt_t { };
 
-    template <typename value_type>
+    namespace detail
+    {
+        // note: Unless the value_type has a niche, the optional
+        //       has to store whether it is initialized next to its value,
+        //       what doubles the size of optionals of most scalar types.
+        //
+        template <typename value_type, typename niche_type>
+        struct optional_storage
+        {
+            bool initialized;
+            std::aligned_storage_t<sizeof(value_type), alignof(value_type)> storage;
+
+            static constexpr auto niche_count = niche_traits<bool>::count;
+
+            static auto store_niche (void* const storage, const std::size_t niche) noexcept -> void
+            {
+                niche_traits<bool>::store(storage, niche);
+            }
+
+            static auto load_niche (const void* const storage) noexcept -> std::size_t
+            {
+                return niche_traits<bool>::load(storage);
+            }
+
+            constexpr auto engaged () const noexcept -> bool
+            {
+                return initialized;
+            }
+
+            constexpr auto mark_engaged () noexcept -> void
+            {
+                initialized = true;
+            }
+
+            constexpr auto mark_empty () noexcept -> void
+            {
+                initialized = false;
+            }
+        };
+
+        // note: Otherwise the first niche of the value_type marks the empty optional,
+        //       while the remaining ones are left to the types wrapping the optional.
+        //
+        template <typename value_type, typename niche_type>
+        requires (niche_type::count > 0)
+        //
+        struct optional_storage <value_type, niche_type>
+        {
+            std::aligned_storage_t<sizeof(value_type), alignof(value_type)> storage;
+
+            static constexpr auto niche_count = niche_type::count - 1;
+
+            static auto store_niche (void* const storage, const std::size_t niche) noexcept -> void
+            {
+                niche_type::store(storage, niche + 1);
+            }
+
+            static auto load_niche (const void* const storage) noexcept -> std::size_t
+            {
+                const auto niche = niche_type::load(storage);
+
+                return ((niche == niche_type::count) || (niche == 0)) ? niche_count : (niche - 1);
+            }
+
+            auto engaged () const noexcept -> bool
+            {
+                return niche_type::load(&storage) == niche_type::count;
+            }
+
+            auto mark_engaged () const noexcept -> void
+            {
+                assert(engaged() && "Value of the optional is one of niches.");
+            }
+
+            auto mark_empty () noexcept -> void
+            {
+                niche_type::store(&storage, 0);
+            }
+        };
+    }
+
+    // note: Special member functions of the optional are trivial,
+    //       whenever the corresponding ones of the value_type are trivial,
+    //       so that optionals of trivial types are passed in registers
+    //       and copied as plain bytes.
+    //
+    //       Moving from an optional resets it, unless the value_type
+    //       is trivially move constructible, in which case it is copied.
+    //
+    template <typename value_type, typename niche_type = niche_traits<value_type>>
     class optional
     {
     private:
-        bool initialized;
-        std::aligned_storage_t<sizeof(value_type), alignof(value_type)> storage;
+        detail::optional_storage<value_type, niche_type> state;
+
+        template <typename ... types>
+        auto construct (types&& ... args) -> void
+        {
+            new (&state.storage) value_type (std::forward<types>(args)...);
+
+            state.mark_engaged();
+        }
+
+        static constexpr auto trivially_copy_assignable = std::is_trivially_copy_constructible_v<value_type>
+                                                       && std::is_trivially_copy_assignable_v   <value_type>
+                                                       && std::is_trivially_destructible_v      <value_type>;
+
+        static constexpr auto trivially_move_assignable = std::is_trivially_move_constructible_v<value_type>
+                                                       && std::is_trivially_move_assignable_v   <value_type>
+                                                       && std::is_trivially_destructible_v      <value_type>;
 
     public:
         constexpr optional () noexcept
-        :
-            initialized { false }
         {
+            state.mark_empty();
         }
 
         constexpr optional (nullopt_t) noexcept
-        :
-            initialized { false }
         {
+            state.mark_empty();
         }
 
+        ~optional ()
+        requires std::is_trivially_destructible_v<value_type>
+        //
+        = default;
+
         ~optional () noexcept
         {
             reset();
         }
 
+        optional (const optional&)
+        requires std::is_trivially_copy_constructible_v<value_type>
+        //
+        = default;
+
         optional (const optional& other)
-        :
-            initialized { other.initialized }
         {
+            state.mark_empty();
+
             if (other)
             {
-                new (&storage) value_type (other.value());
+                construct(other.value());
             }
         }
 
+        auto operator = (const optional&) -> optional&
+        requires trivially_copy_assignable
+        //
+        = default;
+
         auto operator = (const optional& other) -> optional&
         {
-            reset();
-
-            initialized = other.initialized;
-
-            if (other)
+            if (this != &other)
             {
-                new (&storage) value_type (other.value());
+                reset();
+
+                if (other)
+                {
+                    construct(other.value());
+                }
             }
 
             return *this;
         }
 
+        optional (optional&&)
+        requires std::is_trivially_move_constructible_v<value_type>
+        //
+        = default;
+
         optional (optional&& other)
-        :
-            initialized { other.initialized }
         {
+            state.mark_empty();
+
             if (other)
             {
-                new (&storage) value_type (std::move(other.value()));
+                construct(std::move(other.value()));
 
                 other.reset();
             }
         }
 
+        auto operator = (optional&&) -> optional&
+        requires trivially_move_assignable
+        //
+        = default;
+
         auto operator = (optional&& other) -> optional&
         {
-            reset();
-
-            initialized = other.initialized;
-
-            if (other)
+            if (this != &other)
             {
-                new (&storage) value_type (std::move(other.value()));
+                reset();
 
-                other.reset();
+                if (other)
+                {
+                    construct(std::move(other.value()));
+
+                    other.reset();
+                }
             }
 
             return *this;
@@ -141,9 +276,7 @@ namespace cxx
         {
             reset();
 
-            new (&storage) value_type (std::forward<types>(args)...);
-
-            initialized = true;
+            construct(std::forward<types>(args)...);
 
             return value();
         }
@@ -154,14 +287,14 @@ namespace cxx
             {
                 value().~value_type();
 
-                initialized = false;
+                state.mark_empty();
             }
         }
 
         [[nodiscard]]
         constexpr auto has_value() const noexcept -> bool
         {
-            return initialized;
+            return state.engaged();
         }
 
         explicit constexpr operator bool() const noexcept
@@ -174,7 +307,7 @@ namespace cxx
             assert(has_value());
 
             return *static_cast<value_type*>(
-                    static_cast<      void*>(&storage));
+                    static_cast<      void*>(&state.storage));
         }
 
         constexpr auto value () const noexcept -> const value_type&
@@ -182,7 +315,7 @@ namespace cxx
             assert(has_value());
 
             return *static_cast<const value_type*>(
-                    static_cast<const       void*>(&storage));
+                    static_cast<const       void*>(&state.storage));
         }
 
         constexpr auto operator * () noexcept -> value_type&
@@ -213,49 +346,49 @@ namespace cxx
             }
             else if (optional.has_value())
             {
-                new (&this->storage) value_type (std::move(optional.value()));
+                this->construct(std::move(optional.value()));
 
                 optional.value().~value_type();
+                optional.state.mark_empty();
             }
             else if (has_value())
             {
-                new (&optional.storage) value_type (std::move(this->value()));
+                optional.construct(std::move(this->value()));
 
                 this->value().~value_type();
+                this->state.mark_empty();
             }
-
-            std::swap(this->initialized, optional.initialized);
         }
     };
 
-    template <typename value_type>
+    template <typename value_type, typename niche_type>
     constexpr
-    auto operator == (const optional<value_type>& optional,
-                                                 nullopt_t) noexcept -> bool
+    auto operator == (const optional<value_type, niche_type>& optional,
+                                                             nullopt_t) noexcept -> bool
     {
         return !optional.has_value();
     }
 
-    template <typename value_type>
+    template <typename value_type, typename niche_type>
     constexpr
-    auto operator != (const optional<value_type>& optional,
-                                                 nullopt_t) noexcept -> bool
+    auto operator != (const optional<value_type, niche_type>& optional,
+                                                             nullopt_t) noexcept -> bool
     {
         return optional.has_value();
     }
 
-    template <typename value_type>
+    template <typename value_type, typename niche_type>
     constexpr
     auto operator == (nullopt_t,
-                      const optional<value_type>& optional) noexcept -> bool
+                      const optional<value_type, niche_type>& optional) noexcept -> bool
     {
         return !optional.has_value();
     }
 
-    template <typename value_type>
+    template <typename value_type, typename niche_type>
     constexpr
     auto operator != (std::nullptr_t,
-                      const optional<value_type>& optional) noexcept -> bool
+                      const optional<value_type, niche_type>& optional) noexcept -> bool
     {
         return optional.has_value();
     }
@@ -269,6 +402,28 @@ namespace cxx
 
         return opt;
     }
+
+
+    template <typename value_type, typename niche_type>
+    struct niche_traits <optional<value_type, niche_type>>
+    {
+        using storage_type = detail::optional_storage<value_type, niche_type>;
+
+        static_assert(std::is_standard_layout_v<storage_type>);
+
+        static constexpr auto count = storage_type::niche_count;
+
+        static auto store (void* const storage, const std::size_t niche) noexcept -> void
+        {
+            storage_type::store_niche(storage, niche);
+        }
+
+        [[nodiscard]]
+        static auto load (const void* const storage) noexcept -> std::size_t
+        {
+            return storage_type::load_niche(storage);
+        }
+    };
 }
 
 
@@ -37,6 +37,8 @@
 #define CXX_RESULT
 
 
+#include <cxx/optional.hxx>
+
 #include <type_traits>
 
 #include <concepts>
@@ -114,6 +116,10 @@ namespace cxx
     //
     //        ~ https://doc.rust-lang.org/stable/std/result
     //
+    //       The cxx::result<T> stores a value or an error, the latter of which
+    //       is currently empty, hence it is represented as a cxx::optional<T>,
+    //       inheriting its niche optimization and trivial special members.
+    //
     template <typename return_type>
     class result
     {
@@ -123,48 +129,53 @@ namespace cxx
         static_assert(!
         cxx::is_specialization_of<std::remove_cvref_t<return_type>, cxx::result>);
 
+        static_assert(std::is_empty_v<cxx::error>);
+
     private:
-        union
-        {
-            return_type ret;
-            cxx::error  err;
-        };
-        bool success;
+        cxx::optional<return_type> ret;
+
+        static constexpr auto err = cxx::error { };
 
     public:
         explicit result (std::same_as<return_type> auto&& return_value)
-        :
-            ret     { std::forward<decltype(return_value)>(return_value) },
-            success { true                                               }
         {
+            ret.emplace(std::forward<decltype(return_value)>(return_value));
         }
 
-        explicit result (cxx::error error)
+        explicit result (cxx::error)
         :
-            err     { error },
-            success { false }
+            ret { cxx::nullopt }
         {
         }
 
         explicit operator bool () const
         {
-            return success;
+            return ret.has_value();
         }
 
         [[nodiscard]]
         auto value () const -> const return_type&
         {
-            assert(success);
-            return ret;
+            assert(ret.has_value());
+            return ret.value();
         }
 
         [[nodiscard]]
         auto error () const -> const cxx::error&
         {
-            assert(!success);
+            assert(!ret.has_value());
             return err;
         }
     };
+
+
+    template <typename return_type>
+    struct niche_traits <result<return_type>>
+    :
+        niche_traits<optional<return_type>>
+    {
+        static_assert(std::is_standard_layout_v<result<return_type>>);
+    };
 }
 
 
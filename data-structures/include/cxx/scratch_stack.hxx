@@ -0,0 +1,389 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef CXX_SCRATCH_STACK
+#define CXX_SCRATCH_STACK
+
+
+#include <cxx/contracts.hxx>
+
+#include <bit>
+
+#include <cstddef>
+
+#include <cstdint>
+
+#include <cstring>
+
+#include <memory>
+
+#include <new>
+
+#include <span>
+
+#include <type_traits>
+
+#include <utility>
+
+
+#if defined(__linux__)
+
+    // [Linux] - mmap, munmap, mprotect, madvise
+    // ~ https://man7.org/linux/man-pages/man2/mmap.2.html
+    #include <sys/mman.h>
+
+#elif defined(_WIN32)
+
+    // [Win32] - VirtualAlloc, VirtualFree
+    // ~ https://learn.microsoft.com/en-us/windows/win32/api/memoryapi/nf-memoryapi-virtualalloc
+    #include <windows.h>
+
+#else
+
+    #error "Unsupported platform!"
+
+#endif
+
+
+#if defined(__SANITIZE_ADDRESS__)
+
+    // [AddressSanitizer] - Manual Poisoning
+    // ~ https://github.com/google/sanitizers/wiki/AddressSanitizerManualPoisoning
+    #include <sanitizer/asan_interface.h>
+
+#endif
+
+
+namespace cxx
+{
+    namespace detail::virtual_memory
+    {
+        [[nodiscard]]
+        inline auto reserve (const std::size_t bytes) -> std::byte*
+        {
+        #if defined(__linux__)
+
+            const auto memory = ::mmap(nullptr, bytes, PROT_NONE,
+                                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+
+            if (memory == MAP_FAILED) { throw std::bad_alloc { }; }
+
+        #elif defined(_WIN32)
+
+            const auto memory = ::VirtualAlloc(nullptr, bytes, MEM_RESERVE, PAGE_NOACCESS);
+
+            if (memory == nullptr) { throw std::bad_alloc { }; }
+
+        #endif
+
+            return static_cast<std::byte*>(memory);
+        }
+
+        inline auto release (std::byte* const memory, const std::size_t bytes) noexcept -> void
+        {
+        #if defined(__linux__)
+
+            ::munmap(memory, bytes);
+
+        #elif defined(_WIN32)
+
+            static_cast<void>(bytes);
+
+            ::VirtualFree(memory, 0, MEM_RELEASE);
+
+        #endif
+        }
+
+        inline auto commit (std::byte* const memory, const std::size_t bytes) -> void
+        {
+        #if defined(__linux__)
+
+            if (::mprotect(memory, bytes, PROT_READ | PROT_WRITE) != 0) { throw std::bad_alloc { }; }
+
+        #elif defined(_WIN32)
+
+            if (::VirtualAlloc(memory, bytes, MEM_COMMIT, PAGE_READWRITE) == nullptr) { throw std::bad_alloc { }; }
+
+        #endif
+        }
+
+        inline auto decommit (std::byte* const memory, const std::size_t bytes) noexcept -> void
+        {
+        #if defined(__linux__)
+
+            ::madvise (memory, bytes, MADV_DONTNEED);
+            ::mprotect(memory, bytes, PROT_NONE);
+
+        #elif defined(_WIN32)
+
+            ::VirtualFree(memory, bytes, MEM_DECOMMIT);
+
+        #endif
+        }
+    }
+
+    // [Blog] - Ryan Fleury: Untangling Lifetimes: The Arena Allocator
+    //
+    // ~ https://www.rfleury.com/p/untangling-lifetimes-the-arena-allocator
+
+    // note: The scratch_stack reserves a large region of virtual address space
+    //       up front, but commits it to physical memory only in granules,
+    //       as the top of the stack grows. Memory is allocated by bumping
+    //       the top and is freed in LIFO order, when a marker taken earlier
+    //       goes out of scope and rewinds the top to where it used to be.
+    //
+    //       Committed memory is kept after rewinding, so the following
+    //       allocations are served without any system calls, until trim()
+    //       returns the memory above the top to the system.
+    //
+    //       In debug builds the freed memory is overwritten with a pattern,
+    //       while with AddressSanitizer it is poisoned instead,
+    //       so that uses of memory released by a marker are caught.
+    //
+    class scratch_stack
+    {
+    private:
+        std::byte*   base;
+        std::byte*   top;
+        std::byte*   committed;
+        std::byte*   limit;
+
+        static constexpr auto commit_granule = std::size_t { 64 * 1024 };
+
+        static constexpr auto freed_pattern  = std::byte { 0xDD };
+
+        auto commit_up_to (std::byte* const end) -> void
+        {
+            const auto offset  = static_cast<std::size_t>(end - base);
+            const auto rounded = (offset + commit_granule - 1) & ~(commit_granule - 1);
+
+            const auto new_committed = (rounded < static_cast<std::size_t>(limit - base))
+                                     ? base + rounded
+                                     : limit;
+
+            detail::virtual_memory::commit(committed, static_cast<std::size_t>(new_committed - committed));
+
+        #if defined(__SANITIZE_ADDRESS__)
+
+            ASAN_POISON_MEMORY_REGION(committed, static_cast<std::size_t>(new_committed - committed));
+
+        #endif
+
+            committed = new_committed;
+        }
+
+        auto rewind (std::byte* const position) noexcept -> void
+        {
+            cxx_expects((base <= position) && (position <= top));
+
+        #if defined(__SANITIZE_ADDRESS__)
+
+            ASAN_POISON_MEMORY_REGION(position, static_cast<std::size_t>(top - position));
+
+        #elif !defined(NDEBUG)
+
+            std::memset(position, std::to_integer<int>(freed_pattern), static_cast<std::size_t>(top - position));
+
+        #endif
+
+            top = position;
+        }
+
+    public:
+        static constexpr auto default_reservation = std::size_t { 256 * 1024 * 1024 };
+
+        // note: The marker rewinds the scratch_stack, when it is destroyed.
+        //       Markers have to be destroyed in the reverse order
+        //       of their creation, which scoping them guarantees.
+        //
+        class marker
+        {
+        private:
+            scratch_stack* stack;
+            std::byte*     position;
+
+        public:
+            explicit marker (scratch_stack& stack) noexcept
+            :
+                stack    { &stack    },
+                position { stack.top }
+            {
+            }
+
+            ~marker () noexcept
+            {
+                stack->rewind(position);
+            }
+
+            marker (const marker&) = delete;
+            auto operator = (const marker&) -> marker& = delete;
+        };
+
+        explicit scratch_stack (const std::size_t reservation = default_reservation)
+        :
+            base      { detail::virtual_memory::reserve(reservation) },
+            top       { base               },
+            committed { base               },
+            limit     { base + reservation }
+        {
+        }
+
+        ~scratch_stack () noexcept
+        {
+        #if defined(__SANITIZE_ADDRESS__)
+
+            ASAN_UNPOISON_MEMORY_REGION(base, static_cast<std::size_t>(committed - base));
+
+        #endif
+
+            detail::virtual_memory::release(base, static_cast<std::size_t>(limit - base));
+        }
+
+        scratch_stack (const scratch_stack&) = delete;
+        auto operator = (const scratch_stack&) -> scratch_stack& = delete;
+
+        // note: The scratch_stack of the calling thread,
+        //       which is reserved on its first use.
+        //
+        [[nodiscard]]
+        static auto local () -> scratch_stack&
+        {
+            thread_local auto stack = scratch_stack { };
+
+            return stack;
+        }
+
+        [[nodiscard]]
+        auto mark () noexcept -> marker
+        {
+            return marker { *this };
+        }
+
+        [[nodiscard]]
+        auto allocate (const std::size_t bytes,
+                       const std::size_t alignment = alignof(std::max_align_t)) -> void*
+        {
+            cxx_expects(std::has_single_bit(alignment));
+
+            const auto address = reinterpret_cast<std::uintptr_t>(top);
+            const auto aligned = reinterpret_cast<std::byte*>((address + alignment - 1) & ~(alignment - 1));
+
+            if ((aligned > limit) || (bytes > static_cast<std::size_t>(limit - aligned)))
+            {
+                throw std::bad_alloc { };
+            }
+
+            const auto end = aligned + bytes;
+
+            if (end > committed)
+            {
+                commit_up_to(end);
+            }
+
+        #if defined(__SANITIZE_ADDRESS__)
+
+            ASAN_UNPOISON_MEMORY_REGION(aligned, bytes);
+
+        #endif
+
+            top = end;
+
+            return aligned;
+        }
+
+        template <typename type>
+        requires std::is_trivially_destructible_v<type>
+        //
+        [[nodiscard]]
+        auto allocate_array (const std::size_t count) -> std::span<type>
+        {
+            const auto first = static_cast<type*>(allocate(count * sizeof(type), alignof(type)));
+
+            std::uninitialized_value_construct_n(first, count);
+
+            return std::span<type> { first, count };
+        }
+
+        auto deallocate (void* const, const std::size_t, const std::size_t) noexcept -> void
+        {
+        }
+
+        // note: Returns the committed memory above the top to the system.
+        //
+        auto trim () noexcept -> void
+        {
+            const auto offset  = static_cast<std::size_t>(top - base);
+            const auto rounded = (offset + commit_granule - 1) & ~(commit_granule - 1);
+
+            const auto keep = (rounded < static_cast<std::size_t>(committed - base))
+                            ? base + rounded
+                            : committed;
+
+            if (keep != committed)
+            {
+            #if defined(__SANITIZE_ADDRESS__)
+
+                ASAN_UNPOISON_MEMORY_REGION(keep, static_cast<std::size_t>(committed - keep));
+
+            #endif
+
+                detail::virtual_memory::decommit(keep, static_cast<std::size_t>(committed - keep));
+
+                committed = keep;
+            }
+        }
+
+        [[nodiscard]]
+        auto used () const noexcept -> std::size_t
+        {
+            return static_cast<std::size_t>(top - base);
+        }
+
+        [[nodiscard]]
+        auto committed_bytes () const noexcept -> std::size_t
+        {
+            return static_cast<std::size_t>(committed - base);
+        }
+
+        [[nodiscard]]
+        auto reserved_bytes () const noexcept -> std::size_t
+        {
+            return static_cast<std::size_t>(limit - base);
+        }
+    };
+}
+
+
+#endif
@@ -53,6 +53,10 @@
 
 #include <array>
 
+#include <memory>
+
+#include <cxx/allocator.hxx>
+
 
 namespace cxx
 {
@@ -77,15 +81,227 @@ namespace cxx
     }
 
 
-    template <std::destructible value_type>
+    // note: The atomic_ref_count is the reference counting policy,
+    //       which allows shared handles to be destroyed on any thread.
+    //
+    class atomic_ref_count
+    {
+    private:
+        std::atomic_int count;
+
+    public:
+        explicit constexpr atomic_ref_count (const int initial) noexcept
+        :
+            count { initial }
+        {
+        }
+
+        auto increment () noexcept -> void
+        {
+            count.fetch_add(1, std::memory_order::relaxed);
+        }
+
+        [[nodiscard]]
+        auto increment_if_not_zero () noexcept -> bool
+        {
+            auto expected = count.load(std::memory_order::relaxed);
+
+            while (expected != 0)
+            {
+                if (count.compare_exchange_weak(expected, expected + 1,
+                                                std::memory_order::acq_rel,
+                                                std::memory_order::relaxed))
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        // [CppCon] - Hans Boehm: Using weakly ordered C++ atomics correctly
+        // ~ https://www.youtube.com/watch?v=M15UKpNlpeM
+        //
+        // [C++ and Beyond] - Herb Sutter: atomic<> Weapons
+        // ~ https://herbsutter.com/2013/02/11/atomic-weapons-the-c-memory-model-and-modern-hardware
+        // ~ https://sec.ch9.ms/ch9/0b96/086be40b-912f-4cd7-a038-d09612ee0b96/CB2012SessionHerbSutterAtomicP2_mid.mp4
+        // ~ https://sec.ch9.ms/ch9/aa79/4a4e75bd-46c5-4674-bc6f-34d740f9aa79/CB2012SessionHerbSutterAtomicP1_mid.mp4
+        //
+        // [Boost.Atomic] - Usage examples: Reference counting
+        // ~ https://www.boost.org/doc/libs/1_78_0/doc/html/atomic/usage_examples.html
+        //
+        [[nodiscard]]
+        auto decrement () noexcept -> bool
+        {
+            if (count.fetch_sub(1, std::memory_order::release) == 1)
+            {
+                // note : The acquire memory fence is required to ensure that
+                //        all operations on the shared value will happen-before
+                //        that shared value will be destroyed.
+                //
+                //        Relying on data-flow / control-flow dependencies
+                //        to establish ordering is not sufficient,
+                //        since CPUs can perform speculative execution.
+                //
+                std::atomic_thread_fence(std::memory_order::acquire);
+
+                return true;
+            }
+
+            return false;
+        }
+
+        [[nodiscard]]
+        auto load () const noexcept -> int
+        {
+            return count.load(std::memory_order::relaxed);
+        }
+    };
+
+    // note: The local_ref_count is the reference counting policy,
+    //       which uses plain arithmetic instead of locked RMW instructions.
+    //       All handles referencing the same value, including weak ones,
+    //       have to be used and destroyed on a single thread.
+    //
+    class local_ref_count
+    {
+    private:
+        int count;
+
+    public:
+        explicit constexpr local_ref_count (const int initial) noexcept
+        :
+            count { initial }
+        {
+        }
+
+        constexpr auto increment () noexcept -> void
+        {
+            ++count;
+        }
+
+        [[nodiscard]]
+        constexpr auto increment_if_not_zero () noexcept -> bool
+        {
+            if (count != 0)
+            {
+                ++count;
+
+                return true;
+            }
+
+            return false;
+        }
+
+        [[nodiscard]]
+        constexpr auto decrement () noexcept -> bool
+        {
+            return --count == 0;
+        }
+
+        [[nodiscard]]
+        constexpr auto load () const noexcept -> int
+        {
+            return count;
+        }
+    };
+
+    template <typename ref_count_type>
+    concept ref_count_policy = requires (ref_count_type ref_count)
+    {
+        ref_count_type { 1 };
+
+        { ref_count.increment             () } -> std::same_as<void>;
+        { ref_count.increment_if_not_zero () } -> std::same_as<bool>;
+        { ref_count.decrement             () } -> std::same_as<bool>;
+        { ref_count.load                  () } -> std::same_as<int>;
+    };
+
+
+    namespace detail
+    {
+        template <typename ... types>
+        inline constexpr auto starts_with_allocator_arg = false;
+
+        template <typename first_type, typename ... types>
+        inline constexpr auto starts_with_allocator_arg<first_type, types...> =
+            std::same_as<std::remove_cvref_t<first_type>, std::allocator_arg_t>;
+    }
+
+
+    template <std::destructible value_type,
+              ref_count_policy  ref_count_type = atomic_ref_count>
+    class weak;
+
+
+    template <std::destructible value_type,
+              ref_count_policy  ref_count_type = atomic_ref_count>
     class shared
     {
+        friend class weak<value_type, ref_count_type>;
+
     private:
 
+        // note: The value is destroyed, when the last shared handle is,
+        //       but the memory of the shared_state is deallocated only,
+        //       when the last weak handle is destroyed as well.
+        //       All shared handles together hold a single weak reference.
+        //
+        //       The shared_state is allocated along with the allocator,
+        //       which has allocated it, and the deallocate function pointer
+        //       erases the type of that allocator from the cxx::shared<>.
+        //
         struct shared_state
         {
-            value_type      value;
-            std::atomic_int ref_count;
+            union
+            {
+                value_type value;
+            };
+
+            ref_count_type strong_count;
+            ref_count_type   weak_count;
+
+            auto (*deallocate) (shared_state*) noexcept -> void;
+
+            constexpr shared_state (const int count,
+                                    auto (*deallocate) (shared_state*) noexcept -> void) noexcept
+            :
+                strong_count { count      },
+                  weak_count { 1          },
+                deallocate   { deallocate }
+            {
+            }
+
+            constexpr ~shared_state () noexcept
+            {
+            }
+        };
+
+        template <typename allocator_type>
+        struct allocated_state : shared_state
+        {
+            [[no_unique_address]] allocator_type allocator;
+
+            using allocator_traits = typename std::allocator_traits<allocator_type>::
+                                     template rebind_traits<allocated_state>;
+
+            static auto deallocate (shared_state* const state) noexcept -> void
+            {
+                const auto allocated = static_cast<allocated_state*>(state);
+
+                auto rebound = typename allocator_traits::allocator_type { allocated->allocator };
+
+                std::destroy_at(allocated);
+
+                allocator_traits::deallocate(rebound, allocated, 1);
+            }
+
+            constexpr allocated_state (const int count, const allocator_type& allocator) noexcept
+            :
+                shared_state { count, &deallocate },
+                allocator    { allocator          }
+            {
+            }
         };
 
         shared_state* state;
@@ -97,6 +313,54 @@ namespace cxx
             assert(state != nullptr);
         }
 
+        template <int count, typename allocator_type, typename ... types>
+        static
+        auto allocate_state (const allocator_type& allocator, types&& ... args) -> shared_state*
+        {
+            using state_type       = allocated_state<allocator_type>;
+            using allocator_traits = typename state_type::allocator_traits;
+
+            auto rebound = typename allocator_traits::allocator_type { allocator };
+
+            const auto state = allocator_traits::allocate(rebound, 1);
+
+            ::new (static_cast<void*>(state)) state_type { count, allocator };
+
+            try
+            {
+                ::new (const_cast<void*>(static_cast<const void*>(std::addressof(state->value))))
+                value_type(std::forward<types&&>(args)...);
+            }
+            catch (...)
+            {
+                std::destroy_at(state);
+
+                allocator_traits::deallocate(rebound, state, 1);
+
+                throw;
+            }
+
+            return state;
+        }
+
+        static auto release_weak (shared_state* const state) noexcept -> void
+        {
+            if (state->weak_count.decrement())
+            {
+                state->deallocate(state);
+            }
+        }
+
+        static auto release_strong (shared_state* const state) noexcept -> void
+        {
+            if ((state != nullptr) && state->strong_count.decrement())
+            {
+                std::destroy_at(std::addressof(state->value));
+
+                release_weak(state);
+            }
+        }
+
     public:
 
         // note: The cxx::shared<type>::bulk_create<count>() function
@@ -113,15 +377,14 @@ namespace cxx
         //  +--------+--------+--------+-----+--------+
         //  <----------------- count ----------------->
         //
-        template <int count, typename ... types> requires (count > 0)
+        template <int count, typename ... types>
+        requires (count > 0) && (!detail::starts_with_allocator_arg<types...>)
+        //
         static constexpr
         auto bulk_create (types&& ... args) -> std::array<shared, count>
         {
-            auto* const state = new shared_state
-            {
-                .value     = value_type(std::forward<types&&>(args)...),
-                .ref_count = std::atomic_int { count }
-            };
+            const auto state = allocate_state<count>(cxx::allocator<value_type> { },
+                                                     std::forward<types&&>(args)...);
 
             return cxx::generate_array<count>([state] () noexcept
                                               {
@@ -129,40 +392,49 @@ namespace cxx
                                               });
         }
 
+        // note: The allocator is rebound to the type of the shared_state,
+        //       so that the value and its ref_counts are allocated together.
+        //
+        template <int count, typename allocator_type, typename ... types> requires (count > 0)
+        static constexpr
+        auto bulk_create (std::allocator_arg_t, const allocator_type& allocator,
+                          types&& ... args) -> std::array<shared, count>
+        {
+            const auto state = allocate_state<count>(allocator, std::forward<types&&>(args)...);
+
+            return cxx::generate_array<count>([state] () noexcept
+                                              {
+                                                  return shared { state };
+                                              });
+        }
+
+        template <typename ... types>
+        requires (!detail::starts_with_allocator_arg<types...>)
+        //
+        static constexpr
+        auto make (types&& ... args) -> shared
+        {
+            return shared { allocate_state<1>(cxx::allocator<value_type> { },
+                                              std::forward<types&&>(args)...) };
+        }
+
+        template <typename allocator_type, typename ... types>
+        static constexpr
+        auto make (std::allocator_arg_t, const allocator_type& allocator,
+                   types&& ... args) -> shared
+        {
+            return shared { allocate_state<1>(allocator, std::forward<types&&>(args)...) };
+        }
+
 
         // note: Only moved from objects of type cxx::shared<>
         //       can exist in the empty state.
         //
         shared () = delete;
 
-        // [CppCon] - Hans Boehm: Using weakly ordered C++ atomics correctly
-        // ~ https://www.youtube.com/watch?v=M15UKpNlpeM
-        //
-        // [C++ and Beyond] - Herb Sutter: atomic<> Weapons
-        // ~ https://herbsutter.com/2013/02/11/atomic-weapons-the-c-memory-model-and-modern-hardware
-        // ~ https://sec.ch9.ms/ch9/0b96/086be40b-912f-4cd7-a038-d09612ee0b96/CB2012SessionHerbSutterAtomicP2_mid.mp4
-        // ~ https://sec.ch9.ms/ch9/aa79/4a4e75bd-46c5-4674-bc6f-34d740f9aa79/CB2012SessionHerbSutterAtomicP1_mid.mp4
-        //
-        // [Boost.Atomic] - Usage examples: Reference counting
-        // ~ https://www.boost.org/doc/libs/1_78_0/doc/html/atomic/usage_examples.html
-        //
         ~shared () noexcept
         {
-            if ((state != nullptr) &&
-                (state->ref_count.fetch_sub(1, std::memory_order::release) == 1))
-            {
-                // note : The acquire memory fence is required to ensure that
-                //        all operations on the shared value will happen-before
-                //        that shared value will be destroyed.
-                //
-                //        Relying on data-flow / control-flow dependencies
-                //        to establish ordering is not sufficient,
-                //        since CPUs can perform speculative execution.
-                //
-                std::atomic_thread_fence(std::memory_order::acquire);
-
-                delete state;
-            }
+            release_strong(state);
         }
 
 
@@ -190,13 +462,7 @@ namespace cxx
 
         auto operator = (shared&& other) noexcept -> shared&
         {
-            if ((state != nullptr) &&
-                (state->ref_count.fetch_sub(1, std::memory_order::release) == 1))
-            {
-                std::atomic_thread_fence(std::memory_order::acquire);
-
-                delete state;
-            }
+            release_strong(state);
 
             state = other.state;
             other.state = nullptr;
@@ -224,6 +490,100 @@ namespace cxx
             return &state->value;
         }
     };
+
+
+    // note: The cxx::weak<> refers to a shared value without keeping it alive.
+    //       Unlike std::weak_ptr, it cannot be promoted to a shared handle,
+    //       since that would break the limit on the number of shared handles,
+    //       which cxx::shared::bulk_create<count>() guarantees. Instead,
+    //       the visit() function keeps the value alive only for the duration
+    //       of the call of the given function.
+    //
+    template <std::destructible value_type,
+              ref_count_policy  ref_count_type>
+    class weak
+    {
+    private:
+        using shared_type  = shared<value_type, ref_count_type>;
+        using shared_state = typename shared_type::shared_state;
+
+        shared_state* state;
+
+    public:
+        explicit weak (const shared_type& handle) noexcept
+        :
+            state { handle.state }
+        {
+            assert(state != nullptr);
+
+            state->weak_count.increment();
+        }
+
+        ~weak () noexcept
+        {
+            if (state != nullptr)
+            {
+                shared_type::release_weak(state);
+            }
+        }
+
+        weak (const weak& other) noexcept
+        :
+            state { other.state }
+        {
+            if (state != nullptr)
+            {
+                state->weak_count.increment();
+            }
+        }
+
+        weak (weak&& other) noexcept
+        :
+            state { std::exchange(other.state, nullptr) }
+        {
+        }
+
+        auto operator = (weak other) noexcept -> weak&
+        {
+            std::swap(state, other.state);
+
+            return *this;
+        }
+
+        [[nodiscard]]
+        auto expired () const noexcept -> bool
+        {
+            return (state == nullptr) || (state->strong_count.load() == 0);
+        }
+
+        template <std::invocable<value_type&> function>
+        auto visit (function&& visitor) const -> bool
+        {
+            if ((state == nullptr) || !state->strong_count.increment_if_not_zero())
+            {
+                return false;
+            }
+
+            struct strong_reference
+            {
+                shared_state* state;
+
+                ~strong_reference () noexcept
+                {
+                    shared_type::release_strong(state);
+                }
+            };
+
+            const auto reference = strong_reference { state };
+
+            std::invoke(std::forward<function>(visitor), state->value);
+
+            return true;
+        }
+
+        auto operator == (const weak& other) const noexcept -> bool = default;
+    };
+
 }
 
 
@@ -0,0 +1,549 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef CXX_SLAB_ALLOCATOR
+#define CXX_SLAB_ALLOCATOR
+
+
+#include <cxx/allocator.hxx>
+#include <cxx/contracts.hxx>
+
+#include <algorithm>
+
+#include <array>
+
+#include <bit>
+
+#include <cstddef>
+
+#include <mutex>
+
+#include <new>
+
+#include <type_traits>
+
+#include <utility>
+
+
+namespace cxx
+{
+    // [Paper] - Jeff Bonwick: The Slab Allocator: An Object-Caching Kernel Memory Allocator
+    //
+    // ~ https://www.usenix.org/legacy/publications/library/proceedings/bos94/full_papers/bonwick.a
+
+    // [Paper] - Jeff Bonwick, Jonathan Adams: Magazines and Vmem:
+    //           Extending the Slab Allocator to Many CPUs and Arbitrary Resources
+    //
+    // ~ https://www.usenix.org/legacy/event/usenix01/full_papers/bonwick/bonwick.pdf
+
+    // note: Sizes up to 128 bytes are rounded up to a multiple of 16 bytes,
+    //       while larger sizes are rounded up to one of four evenly spaced
+    //       size classes per power of two, which bounds the internal
+    //       fragmentation to 25%. All size classes are multiples of 16 bytes,
+    //       hence every object in a slab is aligned to 16 bytes.
+    //
+    inline constexpr auto slab_alignment   = std::size_t {   16 };
+    inline constexpr auto slab_max_size    = std::size_t { 4096 };
+    inline constexpr auto slab_class_count = std::size_t {   28 };
+
+    [[nodiscard]]
+    constexpr auto slab_size_class (const std::size_t bytes) noexcept -> std::size_t
+    {
+        cxx_expects(bytes <= slab_max_size);
+
+        if (bytes <= 128)
+        {
+            return (std::max<std::size_t>(bytes, 1) + 15) / 16 - 1;
+        }
+
+        const auto log2 = static_cast<std::size_t>(std::bit_width(bytes - 1) - 1);
+        const auto step = std::size_t { 1 } << (log2 - 2);
+
+        return 8 + (log2 - 7) * 4 + (bytes - 1 - (std::size_t { 1 } << log2)) / step;
+    }
+
+    [[nodiscard]]
+    constexpr auto slab_class_size (const std::size_t size_class) noexcept -> std::size_t
+    {
+        cxx_expects(size_class < slab_class_count);
+
+        if (size_class < 8)
+        {
+            return (size_class + 1) * 16;
+        }
+
+        const auto base = std::size_t { 128 } << ((size_class - 8) / 4);
+
+        return base + ((size_class - 8) % 4 + 1) * (base / 4);
+    }
+
+    namespace detail::slab
+    {
+        // note: Free objects are linked through their own storage.
+        //       The first object of a full magazine, which is kept in the depot,
+        //       additionally links the next full magazine.
+        //
+        struct free_object
+        {
+            free_object* next;
+            free_object* next_magazine;
+        };
+
+        struct magazine
+        {
+            free_object* top;
+            std::size_t  count;
+
+            auto push (void* const pointer) noexcept -> void
+            {
+                top = ::new (pointer) free_object { top, nullptr };
+
+                ++count;
+            }
+
+            [[nodiscard]]
+            auto pop () noexcept -> void*
+            {
+                const auto object = top;
+
+                top = object->next;
+
+                --count;
+
+                return object;
+            }
+        };
+
+        // note: Magazines of small objects hold more objects,
+        //       so that every exchange with the depot moves about 8 KiB.
+        //
+        [[nodiscard]]
+        constexpr auto magazine_capacity (const std::size_t size_class) noexcept -> std::size_t
+        {
+            return std::clamp<std::size_t>(8192 / slab_class_size(size_class), 4, 64);
+        }
+
+        inline constexpr auto magazine_capacities = []
+        {
+            auto capacities = std::array<std::size_t, slab_class_count> { };
+
+            for (auto size_class = std::size_t { 0 }; size_class != slab_class_count; ++size_class)
+            {
+                capacities[size_class] = magazine_capacity(size_class);
+            }
+
+            return capacities;
+        }();
+
+        inline constexpr auto slab_size = std::size_t { 64 * 1024 };
+
+        struct slab_header
+        {
+            slab_header* next;
+            std::size_t  padding;
+        };
+
+        static_assert(sizeof(slab_header) % slab_alignment == 0);
+
+        // note: The depot of a size class is shared by all threads.
+        //       It keeps full magazines returned by threads, which free more
+        //       objects than they allocate, until they are taken by threads,
+        //       which allocate more objects than they free. This way objects
+        //       freed on another thread than the one, which allocated them,
+        //       travel back through the depot in batches. Objects left behind
+        //       by exited threads are kept loose, and fresh objects are carved
+        //       from slabs, which are never returned to the system.
+        //
+        class alignas(64) depot
+        {
+        private:
+            std::mutex    mutex;
+
+            free_object*  full_magazines = nullptr;
+
+            free_object*  loose_objects  = nullptr;
+            std::size_t   loose_count    = 0;
+
+            std::byte*    slab_cursor    = nullptr;
+            std::byte*    slab_limit     = nullptr;
+            slab_header*  slabs          = nullptr;
+
+            auto carve (const std::size_t size_class) -> magazine
+            {
+                const auto size     = slab_class_size(size_class);
+                const auto capacity = magazine_capacities[size_class];
+
+                if (static_cast<std::size_t>(slab_limit - slab_cursor) < size)
+                {
+                    const auto memory = static_cast<std::byte*>(::operator new(slab_size));
+
+                    slabs = ::new (static_cast<void*>(memory)) slab_header { slabs, 0 };
+
+                    slab_cursor = memory + sizeof(slab_header);
+                    slab_limit  = memory + slab_size;
+                }
+
+                const auto available = static_cast<std::size_t>(slab_limit - slab_cursor) / size;
+
+                auto carved = magazine { nullptr, 0 };
+
+                for (auto count = std::min(capacity, available); count != 0; --count)
+                {
+                    carved.push(slab_cursor);
+
+                    slab_cursor += size;
+                }
+
+                return carved;
+            }
+
+        public:
+            [[nodiscard]]
+            auto take (const std::size_t size_class) -> magazine
+            {
+                const auto lock = std::lock_guard { mutex };
+
+                if (full_magazines != nullptr)
+                {
+                    const auto top = full_magazines;
+
+                    full_magazines = top->next_magazine;
+
+                    return magazine { top, magazine_capacities[size_class] };
+                }
+
+                if (loose_count != 0)
+                {
+                    auto taken = magazine { nullptr, 0 };
+
+                    for (auto count = std::min(loose_count, magazine_capacities[size_class]);
+                         count != 0; --count)
+                    {
+                        const auto object = loose_objects;
+
+                        loose_objects = object->next;
+
+                        taken.push(object);
+                    }
+
+                    loose_count -= taken.count;
+
+                    return taken;
+                }
+
+                return carve(size_class);
+            }
+
+            auto put (const std::size_t size_class, const magazine returned) noexcept -> void
+            {
+                cxx_expects(returned.count <= magazine_capacities[size_class]);
+
+                if (returned.count == 0)
+                {
+                    return;
+                }
+
+                const auto lock = std::lock_guard { mutex };
+
+                if (returned.count == magazine_capacities[size_class])
+                {
+                    returned.top->next_magazine = full_magazines;
+
+                    full_magazines = returned.top;
+                }
+                else
+                {
+                    auto last = returned.top;
+
+                    while (last->next != nullptr)
+                    {
+                        last = last->next;
+                    }
+
+                    last->next = loose_objects;
+
+                    loose_objects  = returned.top;
+                    loose_count   += returned.count;
+                }
+            }
+        };
+
+        // note: The depots are intentionally never destroyed,
+        //       because objects may still be freed by destructors of statics
+        //       and thread-locals, which run after the depots would have been.
+        //
+        [[nodiscard]]
+        inline auto depots () -> std::array<depot, slab_class_count>&
+        {
+            static auto& instance = *new std::array<depot, slab_class_count> { };
+
+            return instance;
+        }
+
+        // note: Every thread caches two magazines per size class.
+        //       The loaded one serves allocations and deallocations, while
+        //       the previous one is swapped in, when the loaded one runs empty
+        //       or full, so that a thread, which alternates between allocating
+        //       and freeing around the boundary, does not thrash the depot.
+        //
+        //       The cache itself is trivially destructible, so it remains usable
+        //       after its thread has started to exit. Its magazines are flushed
+        //       by the separate thread_cache_flusher, after which the thread
+        //       goes directly to the depots.
+        //
+        struct thread_cache
+        {
+            std::array<magazine, slab_class_count> loaded;
+            std::array<magazine, slab_class_count> previous;
+
+            bool registered;
+            bool retired;
+        };
+
+        inline constinit thread_local auto cache = thread_cache { };
+
+        struct thread_cache_flusher
+        {
+            ~thread_cache_flusher () noexcept
+            {
+                for (auto size_class = std::size_t { 0 }; size_class != slab_class_count; ++size_class)
+                {
+                    depots()[size_class].put(size_class, std::exchange(cache.  loaded[size_class], { }));
+                    depots()[size_class].put(size_class, std::exchange(cache.previous[size_class], { }));
+                }
+
+                cache.retired = true;
+            }
+
+            auto touch () noexcept -> void
+            {
+            }
+        };
+
+        inline thread_local auto flusher = thread_cache_flusher { };
+
+        inline auto register_thread_cache () -> void
+        {
+            if (!cache.registered)
+            {
+                flusher.touch();
+
+                cache.registered = true;
+            }
+        }
+
+        [[gnu::noinline]]
+        inline auto allocate_slow (const std::size_t size_class) -> void*
+        {
+            auto& depot = depots()[size_class];
+
+            if (cache.retired)
+            {
+                auto taken = depot.take(size_class);
+
+                const auto object = taken.pop();
+
+                depot.put(size_class, taken);
+
+                return object;
+            }
+
+            register_thread_cache();
+
+            auto& loaded   = cache.  loaded[size_class];
+            auto& previous = cache.previous[size_class];
+
+            if (previous.count != 0)
+            {
+                std::swap(loaded, previous);
+            }
+            else
+            {
+                loaded = depot.take(size_class);
+            }
+
+            return loaded.pop();
+        }
+
+        [[gnu::noinline]]
+        inline auto deallocate_slow (void* const pointer, const std::size_t size_class) -> void
+        {
+            auto& depot = depots()[size_class];
+
+            if (cache.retired)
+            {
+                auto returned = magazine { nullptr, 0 };
+
+                returned.push(pointer);
+
+                depot.put(size_class, returned);
+
+                return;
+            }
+
+            register_thread_cache();
+
+            auto& loaded   = cache.  loaded[size_class];
+            auto& previous = cache.previous[size_class];
+
+            if (previous.count != 0)
+            {
+                depot.put(size_class, previous);
+            }
+
+            previous = std::exchange(loaded, magazine { nullptr, 0 });
+
+            loaded.push(pointer);
+        }
+
+        [[nodiscard]]
+        inline auto allocate (const std::size_t size_class) -> void*
+        {
+            auto& loaded = cache.loaded[size_class];
+
+            if (loaded.count != 0)
+            {
+                return loaded.pop();
+            }
+
+            return allocate_slow(size_class);
+        }
+
+        inline auto deallocate (void* const pointer, const std::size_t size_class) -> void
+        {
+            auto& loaded = cache.loaded[size_class];
+
+            if (loaded.count < magazine_capacities[size_class])
+            {
+                loaded.push(pointer);
+
+                return;
+            }
+
+            deallocate_slow(pointer, size_class);
+        }
+    }
+
+    // note: The slab_allocator has the same interface as the cxx::allocator.
+    //       Like it, the slab_allocator is stateless, so all instances
+    //       compare equal and memory allocated by one of them can be freed
+    //       by any other, on any thread. Allocations larger than the largest
+    //       size class, or over-aligned ones, are forwarded to cxx::allocator.
+    //
+    template <typename type> requires std::is_object_v<type>
+    //
+    class slab_allocator
+    {
+        static_assert(sizeof(type) != 0, "incomplete types are not supported");
+
+    private:
+        [[nodiscard]]
+        static constexpr auto is_slab_allocated (const std::size_t count) noexcept -> bool
+        {
+            return (alignof(type) <= slab_alignment) && (count <= slab_max_size / sizeof(type));
+        }
+
+    public:
+        using      value_type = type;
+        using       size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+
+        constexpr  slab_allocator () noexcept = default;
+        constexpr ~slab_allocator () noexcept = default;
+
+        constexpr slab_allocator (const slab_allocator&) noexcept                    = default;
+        constexpr
+        auto      operator =     (const slab_allocator&) noexcept -> slab_allocator& = default;
+
+        template <typename other>
+        constexpr explicit(false) slab_allocator (const slab_allocator<other>&) noexcept
+        { }
+
+        [[nodiscard]]
+        auto allocate (const std::size_t count) -> type*
+        {
+            cxx_expects(count <= max_size());
+
+            if (is_slab_allocated(count))
+            {
+                const auto size_class = slab_size_class(count * sizeof(type));
+
+                return static_cast<type*>(detail::slab::allocate(size_class));
+            }
+
+            return cxx::allocator<type> { }.allocate(count);
+        }
+
+        auto deallocate (type* const       pointer,
+                         const std::size_t count) noexcept -> void
+        {
+            if (is_slab_allocated(count))
+            {
+                const auto size_class = slab_size_class(count * sizeof(type));
+
+                detail::slab::deallocate(pointer, size_class);
+            }
+            else
+            {
+                cxx::allocator<type> { }.deallocate(pointer, count);
+            }
+        }
+
+        [[nodiscard]]
+        constexpr auto max_size () const noexcept -> std::size_t
+        {
+            return cxx::allocator<type> { }.max_size();
+        }
+    };
+
+    template<typename left_type, typename right_type>
+    //
+    constexpr auto operator == (const slab_allocator< left_type>&,
+                                const slab_allocator<right_type>&) noexcept -> bool
+    {
+        return true;
+    }
+
+    template<typename left_type, typename right_type>
+    //
+    constexpr auto operator != (const slab_allocator< left_type>&,
+                                const slab_allocator<right_type>&) noexcept -> bool
+    {
+        return false;
+    }
+}
+
+
+#endif
@@ -37,6 +37,8 @@
 #define CXX_UNIQUE_PTR
 
 
+#include <memory>
+
 #include <utility>
 
 #include <cassert>
@@ -45,11 +47,51 @@
 namespace cxx
 {
     template <typename value_type>
+    struct default_delete
+    {
+        auto operator () (value_type* const ptr) const noexcept -> void
+        {
+            delete ptr;
+        }
+    };
+
+    // note: The allocator_delete destroys and deallocates objects,
+    //       which have been allocated by the allocate_unique() function.
+    //
+    template <typename value_type, typename allocator_type>
+    struct allocator_delete
+    {
+        [[no_unique_address]] allocator_type allocator;
+
+        auto operator () (value_type* const ptr) noexcept -> void
+        {
+            using allocator_traits = typename std::allocator_traits<allocator_type>::
+                                     template rebind_traits<value_type>;
+
+            auto rebound = typename allocator_traits::allocator_type { allocator };
+
+            allocator_traits::destroy   (rebound, ptr);
+            allocator_traits::deallocate(rebound, ptr, 1);
+        }
+    };
+
+    template <typename value_type,
+              typename deleter_type = default_delete<value_type>>
     class unique_ptr
     {
     private:
         value_type* ptr;
 
+        [[no_unique_address]] deleter_type deleter;
+
+        auto delete_ptr () noexcept -> void
+        {
+            if (ptr != nullptr)
+            {
+                deleter(ptr);
+            }
+        }
+
     public:
         constexpr unique_ptr () noexcept
         :
@@ -65,13 +107,22 @@ namespace cxx
 
         explicit constexpr unique_ptr (value_type* const raw_ptr) noexcept
         :
-            ptr { raw_ptr }
+            ptr     { raw_ptr },
+            deleter {         }
+        {
+        }
+
+        constexpr unique_ptr (value_type* const   raw_ptr,
+                              const deleter_type& deleter) noexcept
+        :
+            ptr     { raw_ptr },
+            deleter { deleter }
         {
         }
 
         ~unique_ptr () noexcept
         {
-            delete ptr;
+            delete_ptr();
         }
 
         unique_ptr (const unique_ptr&) = delete;
@@ -80,16 +131,18 @@ namespace cxx
 
         constexpr unique_ptr (unique_ptr&& uptr) noexcept
         :
-            ptr { uptr.ptr }
+            ptr     { uptr.ptr                },
+            deleter { std::move(uptr.deleter) }
         {
             uptr.ptr = nullptr;
         }
 
         auto operator = (unique_ptr&& uptr) noexcept -> unique_ptr&
         {
-            delete ptr;
+            delete_ptr();
 
-            ptr = uptr.ptr;
+            ptr     = uptr.ptr;
+            deleter = std::move(uptr.deleter);
 
             uptr.ptr = nullptr;
 
@@ -98,7 +151,7 @@ namespace cxx
 
         auto operator = (std::nullptr_t) noexcept -> unique_ptr&
         {
-            delete ptr;
+            delete_ptr();
 
             ptr = nullptr;
 
@@ -138,58 +191,64 @@ namespace cxx
             return raw_ptr;
         }
 
+        [[nodiscard]]
+        constexpr auto get_deleter () const noexcept -> const deleter_type&
+        {
+            return deleter;
+        }
+
         auto reset (value_type* const raw_ptr = nullptr) -> void
         {
-            delete ptr;
+            delete_ptr();
 
             ptr = raw_ptr;
         }
     };
 
-    template <typename value_type>
+    template <typename value_type, typename deleter_type>
     constexpr
-    auto operator == (const unique_ptr<value_type>& uptr,
-                                          std::nullptr_t) noexcept -> bool
+    auto operator == (const unique_ptr<value_type, deleter_type>& uptr,
+                                                        std::nullptr_t) noexcept -> bool
     {
         return uptr.get() == nullptr;
     }
 
-    template <typename value_type>
+    template <typename value_type, typename deleter_type>
     constexpr
-    auto operator != (const unique_ptr<value_type>& uptr,
-                                          std::nullptr_t) noexcept -> bool
+    auto operator != (const unique_ptr<value_type, deleter_type>& uptr,
+                                                        std::nullptr_t) noexcept -> bool
     {
         return uptr.get() != nullptr;
     }
 
-    template <typename value_type>
+    template <typename value_type, typename deleter_type>
     constexpr
     auto operator == (std::nullptr_t,
-                      const unique_ptr<value_type>& uptr) noexcept -> bool
+                      const unique_ptr<value_type, deleter_type>& uptr) noexcept -> bool
     {
         return nullptr == uptr.get();
     }
 
-    template <typename value_type>
+    template <typename value_type, typename deleter_type>
     constexpr
     auto operator != (std::nullptr_t,
-                      const unique_ptr<value_type>& uptr) noexcept -> bool
+                      const unique_ptr<value_type, deleter_type>& uptr) noexcept -> bool
     {
         return nullptr != uptr.get();
     }
 
-    template <typename value_type>
+    template <typename value_type, typename deleter_type>
     constexpr
-    auto operator == (const unique_ptr<value_type>&  left_uptr,
-                      const unique_ptr<value_type>& right_uptr) noexcept -> bool
+    auto operator == (const unique_ptr<value_type, deleter_type>&  left_uptr,
+                      const unique_ptr<value_type, deleter_type>& right_uptr) noexcept -> bool
     {
         return left_uptr.get() == right_uptr.get();
     }
 
-    template <typename value_type>
+    template <typename value_type, typename deleter_type>
     constexpr
-    auto operator != (const unique_ptr<value_type>&  left_uptr,
-                      const unique_ptr<value_type>& right_uptr) noexcept -> bool
+    auto operator != (const unique_ptr<value_type, deleter_type>&  left_uptr,
+                      const unique_ptr<value_type, deleter_type>& right_uptr) noexcept -> bool
     {
         return left_uptr.get() != right_uptr.get();
     }
@@ -202,6 +261,33 @@ namespace cxx
                    new value_type(std::forward<args_types>(args)...)
                };
     }
+
+    template <typename value_type, typename allocator_type, typename... args_types>
+    auto allocate_unique (const allocator_type& allocator, args_types&&... args)
+    -> unique_ptr<value_type, allocator_delete<value_type, allocator_type>>
+    {
+        using allocator_traits = typename std::allocator_traits<allocator_type>::
+                                 template rebind_traits<value_type>;
+
+        auto rebound = typename allocator_traits::allocator_type { allocator };
+
+        const auto ptr = allocator_traits::allocate(rebound, 1);
+
+        try
+        {
+            allocator_traits::construct(rebound, ptr, std::forward<args_types>(args)...);
+        }
+        catch (...)
+        {
+            allocator_traits::deallocate(rebound, ptr, 1);
+            throw;
+        }
+
+        return unique_ptr<value_type, allocator_delete<value_type, allocator_type>>
+               {
+                   ptr, allocator_delete<value_type, allocator_type> { allocator }
+               };
+    }
 }
 
 
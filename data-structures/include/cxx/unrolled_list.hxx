@@ -0,0 +1,715 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef CXX_UNROLLED_LIST
+#define CXX_UNROLLED_LIST
+
+
+#include <cxx/allocator.hxx>
+
+#include <cxx/vector.hxx>
+
+#include <cassert>
+
+#include <cstddef>
+
+#include <cstring>
+
+#include <algorithm>
+
+#include <initializer_list>
+
+#include <memory>
+
+#include <new>
+
+#include <type_traits>
+
+#include <utility>
+
+
+namespace cxx
+{
+    // [Paper] - Shao, Reppy, Appel: Unrolling Lists
+    //
+    // ~ https://dl.acm.org/doi/10.1145/182409.182453
+
+    //            +-------+   +-------+   +-------+
+    //    head -->| next  |-->| next  |-->| next  |--> null
+    //            |-------|   |-------|   |-------|
+    //    null <--| prev  |<--| prev  |<--| prev  |<-- tail
+    //            |-------|   |-------|   |-------|
+    //            | count |   | count |   | count |
+    //            |-------|   |-------|   |-------|
+    //            | value |   | value |   | value |
+    //            | value |   | value |   | ..... |
+    //            | ..... |   | ..... |   |       |
+    //            +-------+   +-------+   +-------+
+    //
+    // note: The unrolled_list stores up to per_node elements in each node,
+    //       thus traversing it chases a single pointer per node,
+    //       rather than per element, while inserting and erasing elements
+    //       in the middle still moves at most per_node elements.
+    //
+    //       Inserting an element into a full node splits the node in half,
+    //       unless it is inserted at either end of the node, while
+    //       erasing elements merges a sparse node with its successor.
+    //       Both invalidate iterators to elements of the affected nodes.
+    //
+    template <typename    value_type,
+              std::size_t per_node       = std::max(std::size_t { 256 } / sizeof(value_type),
+                                                    std::size_t {   4 }),
+              typename    allocator_type = cxx::allocator<value_type>>
+    requires (per_node > 1) && std::is_nothrow_move_constructible_v<value_type>
+    //
+    class unrolled_list
+    {
+    private:
+        struct node
+        {
+            node*        next;
+            node*        prev;
+            std::size_t  count;
+
+            alignas(value_type) std::byte storage [sizeof(value_type) * per_node];
+
+            [[nodiscard]]
+            auto elements () noexcept -> value_type*
+            {
+                return std::launder(reinterpret_cast<value_type*>(storage));
+            }
+        };
+
+        using node_allocator_type =
+            typename std::allocator_traits<allocator_type>::template rebind_alloc<node>;
+
+        using node_allocator_traits = std::allocator_traits<node_allocator_type>;
+
+        static constexpr auto relocatable = cxx::is_trivially_relocatable_v<value_type>;
+
+        node*          head;
+        node*          tail;
+        std::size_t  length;
+
+        [[no_unique_address]] node_allocator_type allocator;
+
+        template <bool constant>
+        struct iterator
+        {
+        private:
+            friend unrolled_list;
+            friend iterator<!constant>;
+
+            node*        node_ptr;
+            std::size_t  index;
+
+            using element_type = std::conditional_t<constant, const value_type,
+                                                                    value_type>;
+
+        public:
+            explicit constexpr iterator (node* const n = nullptr,
+                                         const std::size_t i = 0) noexcept
+            :
+                node_ptr { n },
+                index    { i }
+            {
+            }
+
+            template <bool other_constant> requires (constant && !other_constant)
+            //
+            constexpr explicit(false) iterator (const iterator<other_constant>& it) noexcept
+            :
+                node_ptr { it.node_ptr },
+                index    { it.index    }
+            {
+            }
+
+            auto operator * () const noexcept -> element_type&
+            {
+                assert((node_ptr != nullptr) && (index < node_ptr->count));
+
+                return node_ptr->elements()[index];
+            }
+
+            auto operator -> () const noexcept -> element_type*
+            {
+                assert((node_ptr != nullptr) && (index < node_ptr->count));
+
+                return node_ptr->elements() + index;
+            }
+
+            // note: The iterator past the last element points to
+            //       the last node, rather than to a null node,
+            //       so that it can be decremented.
+            //
+            constexpr auto operator ++ () noexcept -> iterator&
+            {
+                assert((node_ptr != nullptr) && (index < node_ptr->count));
+
+                if ((++index == node_ptr->count) && (node_ptr->next != nullptr))
+                {
+                    node_ptr = node_ptr->next;
+                    index    = 0;
+                }
+
+                return *this;
+            }
+
+            constexpr auto operator -- () noexcept -> iterator&
+            {
+                assert(node_ptr != nullptr);
+
+                if (index == 0)
+                {
+                    node_ptr = node_ptr->prev;
+
+                    assert(node_ptr != nullptr);
+
+                    index = node_ptr->count;
+                }
+
+                --index;
+
+                return *this;
+            }
+
+            constexpr auto operator ++ (int) noexcept -> iterator
+            {
+                auto copy = *this;
+                ++*this;
+                return copy;
+            }
+
+            constexpr auto operator -- (int) noexcept -> iterator
+            {
+                auto copy = *this;
+                --*this;
+                return copy;
+            }
+
+            constexpr
+            auto operator == (const iterator& it) const noexcept -> bool
+            {
+                return (this->node_ptr == it.node_ptr) && (this->index == it.index);
+            }
+
+            constexpr
+            auto operator != (const iterator& it) const noexcept -> bool
+            {
+                return !(*this == it);
+            }
+        };
+
+        using mutable_iterator = iterator<false>;
+        using   const_iterator = iterator<true >;
+
+        // note: Ranges are relocated towards either lower or higher addresses,
+        //       thus they may overlap, as long as the moved elements
+        //       are relocated before being overwritten.
+        //
+        static auto relocate (value_type* const first, value_type* const last,
+                              value_type* const target) noexcept -> void
+        {
+            if constexpr (relocatable)
+            {
+                std::memmove(static_cast<void*>(target), static_cast<const void*>(first),
+                             static_cast<std::size_t>(last - first) * sizeof(value_type));
+            }
+            else if (target < first)
+            {
+                for (auto source = first; source != last; ++source)
+                {
+                    std::construct_at(target + (source - first), std::move(*source));
+                    std::destroy_at(source);
+                }
+            }
+            else
+            {
+                for (auto source = last; source != first; --source)
+                {
+                    std::construct_at(target + (source - 1 - first), std::move(*(source - 1)));
+                    std::destroy_at(source - 1);
+                }
+            }
+        }
+
+        auto create_node (node* const prev, node* const next) -> node*
+        {
+            const auto n = ::new (static_cast<void*>(node_allocator_traits::allocate(allocator, 1))) node;
+
+            n->next  = next;
+            n->prev  = prev;
+            n->count = 0;
+
+            if (prev == nullptr) { head       = n; }
+            else                 { prev->next = n; }
+
+            if (next == nullptr) { tail       = n; }
+            else                 { next->prev = n; }
+
+            return n;
+        }
+
+        auto destroy_node (node* const n) noexcept -> void
+        {
+            if (n->prev == nullptr) { head          = n->next; }
+            else                    { n->prev->next = n->next; }
+
+            if (n->next == nullptr) { tail          = n->prev; }
+            else                    { n->next->prev = n->prev; }
+
+            std::destroy(n->elements(), n->elements() + n->count);
+
+            n->~node();
+            node_allocator_traits::deallocate(allocator, n, 1);
+        }
+
+        // note: Makes room for a single element, before the given position,
+        //       and returns the node and the index of the uninitialized slot.
+        //
+        auto make_room (node* n, std::size_t index) -> std::pair<node*, std::size_t>
+        {
+            if (n == nullptr)
+            {
+                n = create_node(nullptr, nullptr);
+            }
+            else if (n->count == per_node)
+            {
+                if (index == per_node)
+                {
+                    if ((n->next == nullptr) || (n->next->count == per_node))
+                    {
+                        create_node(n, n->next);
+                    }
+
+                    n     = n->next;
+                    index = 0;
+                }
+                else if (index == 0)
+                {
+                    if ((n->prev == nullptr) || (n->prev->count == per_node))
+                    {
+                        create_node(n->prev, n);
+                    }
+
+                    n     = n->prev;
+                    index = n->count;
+                }
+                else
+                {
+                    constexpr auto half = per_node / 2;
+
+                    const auto upper = create_node(n, n->next);
+
+                    relocate(n->elements() + half, n->elements() + per_node, upper->elements());
+
+                    upper->count = per_node - half;
+                        n->count =            half;
+
+                    if (index > half)
+                    {
+                        n      = upper;
+                        index -= half;
+                    }
+                }
+            }
+
+            relocate(n->elements() + index, n->elements() + n->count, n->elements() + index + 1);
+
+            ++n->count;
+
+            return { n, index };
+        }
+
+        constexpr auto last_position () const noexcept -> mutable_iterator
+        {
+            return (tail == nullptr) ? mutable_iterator { }
+                                     : mutable_iterator { tail, tail->count };
+        }
+
+    public:
+        unrolled_list () noexcept(std::is_nothrow_default_constructible_v<allocator_type>)
+        :
+            unrolled_list ( allocator_type { } )
+        {
+        }
+
+        explicit unrolled_list (const allocator_type& allocator) noexcept
+        :
+            head      {  nullptr  },
+            tail      {  nullptr  },
+            length    {     0     },
+            allocator { allocator }
+        {
+        }
+
+        explicit unrolled_list (const std::initializer_list<value_type> init_list,
+                                const allocator_type& allocator = allocator_type { })
+        :
+            unrolled_list ( allocator )
+        {
+            for (auto& elem : init_list)
+            {
+                push_back(elem);
+            }
+        }
+
+        ~unrolled_list () noexcept
+        {
+            clear();
+        }
+
+        unrolled_list (const unrolled_list& other)
+        :
+            unrolled_list ( std::allocator_traits<allocator_type>::
+                            select_on_container_copy_construction(other.get_allocator()) )
+        {
+            for (const auto& elem : other)
+            {
+                push_back(elem);
+            }
+        }
+
+        auto operator = (const unrolled_list& other) -> unrolled_list&
+        {
+            if (this != &other)
+            {
+                auto copy = unrolled_list { other };
+
+                swap(*this, copy);
+            }
+
+            return *this;
+        }
+
+        unrolled_list (unrolled_list&& other) noexcept
+        :
+            head      { std::exchange(other.head,   nullptr) },
+            tail      { std::exchange(other.tail,   nullptr) },
+            length    { std::exchange(other.length, 0      ) },
+            allocator { std::move(other.allocator) }
+        {
+        }
+
+        auto operator = (unrolled_list&& other) noexcept -> unrolled_list&
+        {
+            if (this != &other)
+            {
+                clear();
+
+                head      = std::exchange(other.head,   nullptr);
+                tail      = std::exchange(other.tail,   nullptr);
+                length    = std::exchange(other.length, 0      );
+                allocator = std::move(other.allocator);
+            }
+
+            return *this;
+        }
+
+        friend auto swap (unrolled_list& left, unrolled_list& right) noexcept -> void
+        {
+            using std::swap;
+
+            swap(left.head,      right.head     );
+            swap(left.tail,      right.tail     );
+            swap(left.length,    right.length   );
+            swap(left.allocator, right.allocator);
+        }
+
+        [[nodiscard]]
+        auto get_allocator () const noexcept -> allocator_type
+        {
+            return allocator_type { allocator };
+        }
+
+        template <typename ... args_types>
+        auto emplace (const const_iterator position, args_types&& ... args) -> mutable_iterator
+        {
+            // note: The element is constructed before making room for it,
+            //       because the arguments may refer to elements of this list.
+            //
+            auto value = value_type ( std::forward<args_types>(args) ... );
+
+            const auto [n, index] = make_room(position.node_ptr, position.index);
+
+            std::construct_at(n->elements() + index, std::move(value));
+
+            ++length;
+
+            return mutable_iterator { n, index };
+        }
+
+        auto insert (const const_iterator position, const value_type& value) -> mutable_iterator
+        {
+            return emplace(position, value);
+        }
+
+        auto insert (const const_iterator position, value_type&& value) -> mutable_iterator
+        {
+            return emplace(position, std::move(value));
+        }
+
+        auto erase (const const_iterator position) noexcept -> mutable_iterator
+        {
+            const auto n     = position.node_ptr;
+            const auto index = position.index;
+
+            assert((n != nullptr) && (index < n->count));
+
+            std::destroy_at(n->elements() + index);
+
+            relocate(n->elements() + index + 1, n->elements() + n->count, n->elements() + index);
+
+            --n->count;
+            --length;
+
+            if (n->count == 0)
+            {
+                const auto next = n->next;
+
+                destroy_node(n);
+
+                return (next == nullptr) ? last_position() : mutable_iterator { next, 0 };
+            }
+
+            if (const auto next = n->next; (next != nullptr)             &&
+                                           (n->count < per_node / 4)     &&
+                                           (n->count + next->count <= per_node))
+            {
+                relocate(next->elements(), next->elements() + next->count,
+                         n->elements() + n->count);
+
+                n->count   += next->count;
+                next->count = 0;
+
+                destroy_node(next);
+            }
+
+            if ((index == n->count) && (n->next != nullptr))
+            {
+                return mutable_iterator { n->next, 0 };
+            }
+
+            return mutable_iterator { n, index };
+        }
+
+        template <typename ... args_types>
+        auto emplace_back (args_types&& ... args) -> value_type&
+        {
+            return *emplace(end(), std::forward<args_types>(args) ...);
+        }
+
+        auto push_back (const value_type& value) -> void
+        {
+            emplace(end(), value);
+        }
+
+        auto push_back (value_type&& value) -> void
+        {
+            emplace(end(), std::move(value));
+        }
+
+        auto push_front (const value_type& value) -> void
+        {
+            emplace(begin(), value);
+        }
+
+        auto push_front (value_type&& value) -> void
+        {
+            emplace(begin(), std::move(value));
+        }
+
+        auto pop_front () noexcept -> void
+        {
+            assert(length > 0);
+
+            erase(begin());
+        }
+
+        auto pop_back () noexcept -> void
+        {
+            assert(length > 0);
+
+            erase(const_iterator { tail, tail->count - 1 });
+        }
+
+        [[nodiscard]]
+        auto front () const noexcept -> const value_type&
+        {
+            assert(head != nullptr);
+
+            return head->elements()[0];
+        }
+
+        [[nodiscard]]
+        auto front () noexcept -> value_type&
+        {
+            assert(head != nullptr);
+
+            return head->elements()[0];
+        }
+
+        [[nodiscard]]
+        auto back () const noexcept -> const value_type&
+        {
+            assert(tail != nullptr);
+
+            return tail->elements()[tail->count - 1];
+        }
+
+        [[nodiscard]]
+        auto back () noexcept -> value_type&
+        {
+            assert(tail != nullptr);
+
+            return tail->elements()[tail->count - 1];
+        }
+
+        [[nodiscard]]
+        constexpr auto size () const noexcept -> std::size_t
+        {
+            return length;
+        }
+
+        [[nodiscard]]
+        constexpr auto empty () const noexcept -> bool
+        {
+            return length == 0;
+        }
+
+        auto clear () noexcept -> void
+        {
+            while (head != nullptr)
+            {
+                destroy_node(head);
+            }
+
+            length = 0;
+        }
+
+        // note: Visiting elements node by node lets the inner loop
+        //       run over contiguous memory, like over an array.
+        //
+        template <typename function_type>
+        auto for_each (function_type&& function) -> void
+        {
+            for (auto n = head; n != nullptr; n = n->next)
+            {
+                for (auto element = n->elements(); element != n->elements() + n->count; ++element)
+                {
+                    function(*element);
+                }
+            }
+        }
+
+        template <typename function_type>
+        auto for_each (function_type&& function) const -> void
+        {
+            for (auto n = head; n != nullptr; n = n->next)
+            {
+                const auto elements = static_cast<const value_type*>(n->elements());
+
+                for (auto element = elements; element != elements + n->count; ++element)
+                {
+                    function(*element);
+                }
+            }
+        }
+
+        [[nodiscard]]
+        constexpr auto begin () noexcept -> mutable_iterator
+        {
+            return mutable_iterator { head, 0 };
+        }
+
+        [[nodiscard]]
+        constexpr auto begin () const noexcept -> const_iterator
+        {
+            return const_iterator { head, 0 };
+        }
+
+        [[nodiscard]]
+        constexpr auto cbegin () const noexcept -> const_iterator
+        {
+            return begin();
+        }
+
+        [[nodiscard]]
+        constexpr auto end () noexcept -> mutable_iterator
+        {
+            return last_position();
+        }
+
+        [[nodiscard]]
+        constexpr auto end () const noexcept -> const_iterator
+        {
+            return last_position();
+        }
+
+        [[nodiscard]]
+        constexpr auto cend () const noexcept -> const_iterator
+        {
+            return end();
+        }
+    };
+
+    template <typename value_type, std::size_t per_node, typename allocator_type>
+    [[nodiscard]]
+    auto operator == (const unrolled_list<value_type, per_node, allocator_type>& left,
+                      const unrolled_list<value_type, per_node, allocator_type>& right) noexcept -> bool
+    {
+        if (left.size() != right.size())
+        {
+            return false;
+        }
+
+        auto right_it = right.begin();
+
+        for (const auto& element : left)
+        {
+            if (element != *right_it)
+            {
+                return false;
+            }
+
+            ++right_it;
+        }
+
+        return true;
+    }
+}
+
+
+#endif
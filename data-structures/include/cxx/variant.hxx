@@ -0,0 +1,787 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef CXX_VARIANT
+#define CXX_VARIANT
+
+
+#include <cxx/niche.hxx>
+
+#include <algorithm>
+
+#include <array>
+
+#include <cassert>
+
+#include <concepts>
+
+#include <cstddef>
+
+#include <cstdint>
+
+#include <functional>
+
+#include <limits>
+
+#include <memory>
+
+#include <new>
+
+#include <tuple>
+
+#include <type_traits>
+
+#include <utility>
+
+
+namespace cxx
+{
+    struct monostate
+    {
+        constexpr
+        auto operator == (const monostate&) const noexcept -> bool = default;
+    };
+
+
+    template <typename ... types>
+    class variant;
+
+
+    namespace detail
+    {
+        template <std::size_t index, typename ... types>
+        using nth_type = std::tuple_element_t<index, std::tuple<types...>>;
+
+        template <typename type, typename ... types>
+        inline constexpr auto occurrences = (std::size_t { std::is_same_v<type, types> } + ... + 0);
+
+        template <typename type, typename ... types>
+        requires (occurrences<type, types...> == 1)
+        //
+        inline constexpr auto index_of = []
+        {
+            constexpr bool matches [] = { std::is_same_v<type, types>... };
+
+            return static_cast<std::size_t>(std::ranges::find(matches, true) - std::ranges::begin(matches));
+        }
+        ();
+
+        template <typename type>
+        inline constexpr auto is_variant = false;
+
+        template <typename ... types>
+        inline constexpr auto is_variant <variant<types...>> = true;
+    }
+
+    template <typename variant_type>
+    requires detail::is_variant<variant_type>
+    //
+    inline constexpr auto variant_size = std::size_t { 0 };
+
+    template <typename ... types>
+    inline constexpr auto variant_size <variant<types...>> = sizeof...(types);
+
+    template <std::size_t index, typename variant_type>
+    struct variant_alternative;
+
+    template <std::size_t index, typename ... types>
+    struct variant_alternative <index, variant<types...>>
+    {
+        using type = detail::nth_type<index, types...>;
+    };
+
+    template <std::size_t index, typename variant_type>
+    using variant_alternative_t = typename variant_alternative<index, variant_type>::type;
+
+
+    namespace detail
+    {
+        // note: Every call dispatched on an index goes through a table
+        //       of function pointers, generated at compile time,
+        //       instead of a switch statement, which compilers lower
+        //       to jump tables, binary searches or chains of branches,
+        //       depending on their heuristics, hence the cost of visiting
+        //       is the same single indirect call, regardless of the compiler
+        //       and of the number of alternatives.
+        //
+        //       The price is paid for variants of very few alternatives,
+        //       whose switch statements compilers may turn into branchless code.
+        //
+        template <typename result_type, typename function_type, std::size_t index>
+        auto dispatch_thunk (function_type&& function) -> result_type
+        {
+            static_assert
+            (
+                std::is_same_v<std::invoke_result_t<function_type, std::integral_constant<std::size_t, index>>, result_type>,
+                "Visitor has to return the same type for all alternatives."
+            );
+
+            return std::forward<function_type>(function)(std::integral_constant<std::size_t, index> { });
+        }
+
+        template <typename result_type, typename function_type, typename index_sequence>
+        struct dispatch_table;
+
+        template <typename result_type, typename function_type, std::size_t ... indices>
+        struct dispatch_table <result_type, function_type, std::index_sequence<indices...>>
+        {
+            static constexpr auto thunks = std::array
+            {
+                &dispatch_thunk<result_type, function_type, indices>...
+            };
+        };
+
+        template <std::size_t count, typename function_type>
+        auto dispatch (const std::size_t index, function_type&& function) -> decltype(auto)
+        {
+            using result_type = std::invoke_result_t<function_type, std::integral_constant<std::size_t, 0>>;
+            using table       = dispatch_table<result_type, function_type, std::make_index_sequence<count>>;
+
+            assert(index < count);
+
+            return table::thunks[index](std::forward<function_type>(function));
+        }
+
+
+        template <std::size_t count>
+        using discriminant_for = std::conditional_t<(count <= std::numeric_limits<std::uint8_t >::max()), std::uint8_t,
+                                 std::conditional_t<(count <= std::numeric_limits<std::uint16_t>::max()), std::uint16_t,
+                                                                                                          std::uint32_t>>;
+
+        // note: The tagged layout stores the index of the alternative,
+        //       in the smallest unsigned integer capable of representing it,
+        //       right after the storage of alternatives, hence its unused values
+        //       are niches of the variant.
+        //
+        template <typename ... types>
+        struct tagged_layout
+        {
+            using discriminant_type = discriminant_for<sizeof...(types)>;
+
+            alignas(types...) unsigned char storage [std::max({ sizeof(types)... })];
+
+            discriminant_type discriminant;
+
+            static constexpr auto niche_count = std::size_t
+            {
+                std::numeric_limits<discriminant_type>::max() - sizeof...(types) + 1
+            };
+
+            static auto store_niche (void* const storage, const std::size_t niche) noexcept -> void
+            {
+                using niche_type = tag_niche<discriminant_type, offsetof(tagged_layout, discriminant), sizeof...(types)>;
+
+                niche_type::store(storage, niche);
+            }
+
+            static auto load_niche (const void* const storage) noexcept -> std::size_t
+            {
+                using niche_type = tag_niche<discriminant_type, offsetof(tagged_layout, discriminant), sizeof...(types)>;
+
+                return niche_type::load(storage);
+            }
+
+            auto index () const noexcept -> std::size_t
+            {
+                return discriminant;
+            }
+
+            template <std::size_t index>
+            auto pointer () noexcept -> nth_type<index, types...>*
+            {
+                return std::launder(reinterpret_cast<nth_type<index, types...>*>(storage));
+            }
+
+            template <std::size_t index>
+            auto pointer () const noexcept -> const nth_type<index, types...>*
+            {
+                return std::launder(reinterpret_cast<const nth_type<index, types...>*>(storage));
+            }
+
+            template <std::size_t index, typename ... arguments>
+            auto construct (arguments&& ... args) -> void
+            {
+                ::new (static_cast<void*>(storage)) nth_type<index, types...> (std::forward<arguments>(args)...);
+
+                discriminant = static_cast<discriminant_type>(index);
+            }
+
+            template <std::size_t index>
+            auto destroy () noexcept -> void
+            {
+                std::destroy_at(pointer<index>());
+            }
+        };
+
+
+        template <typename type>
+        inline constexpr auto is_niche_filler = std::is_empty_v<type>
+                                             && std::is_trivially_copyable_v<type>
+                                             && std::semiregular<type>;
+
+        // note: Empty alternatives have no state, hence all of them share
+        //       a single instance, instead of occupying the storage of a variant.
+        //
+        template <typename type>
+        inline auto empty_instance = type { };
+
+        // note: The niche layout is used, whenever all alternatives but one,
+        //       the dataful one, are empty and the dataful alternative
+        //       has enough niches to encode indices of all the others,
+        //       as it is the case for cxx::variant<cxx::monostate, bool>.
+        //
+        //       Then the storage fits exactly the dataful alternative.
+        //
+        template <std::size_t dataful, typename ... types>
+        struct niche_layout
+        {
+            using dataful_type  = nth_type<dataful, types...>;
+            using dataful_niche = niche_traits<dataful_type>;
+
+            static constexpr auto empty_count = sizeof...(types) - 1;
+
+            alignas(dataful_type) unsigned char storage [sizeof(dataful_type)];
+
+            static constexpr auto niche_count = std::size_t
+            {
+                dataful_niche::count - empty_count
+            };
+
+            static auto store_niche (void* const storage, const std::size_t niche) noexcept -> void
+            {
+                dataful_niche::store(storage, empty_count + niche);
+            }
+
+            static auto load_niche (const void* const storage) noexcept -> std::size_t
+            {
+                const auto niche = dataful_niche::load(storage);
+
+                return (niche == dataful_niche::count) || (niche < empty_count)
+                     ? niche_count
+                     : niche - empty_count;
+            }
+
+            auto index () const noexcept -> std::size_t
+            {
+                const auto niche = dataful_niche::load(storage);
+
+                if (niche == dataful_niche::count)
+                {
+                    return dataful;
+                }
+
+                return (niche < dataful) ? niche : niche + 1;
+            }
+
+            template <std::size_t index>
+            auto pointer () noexcept -> nth_type<index, types...>*
+            {
+                if constexpr (index == dataful)
+                {
+                    return std::launder(reinterpret_cast<dataful_type*>(storage));
+                }
+                else
+                {
+                    return &empty_instance<nth_type<index, types...>>;
+                }
+            }
+
+            template <std::size_t index>
+            auto pointer () const noexcept -> const nth_type<index, types...>*
+            {
+                return const_cast<niche_layout*>(this)->pointer<index>();
+            }
+
+            template <std::size_t index, typename ... arguments>
+            auto construct (arguments&& ... args) -> void
+            {
+                if constexpr (index == dataful)
+                {
+                    ::new (static_cast<void*>(storage)) dataful_type (std::forward<arguments>(args)...);
+                }
+                else
+                {
+                    [[maybe_unused]] const auto value = nth_type<index, types...> (std::forward<arguments>(args)...);
+
+                    dataful_niche::store(storage, (index < dataful) ? index : index - 1);
+                }
+            }
+
+            template <std::size_t index>
+            auto destroy () noexcept -> void
+            {
+                if constexpr (index == dataful)
+                {
+                    std::destroy_at(pointer<index>());
+                }
+            }
+        };
+
+        template <typename ... types>
+        consteval auto find_dataful () -> std::size_t
+        {
+            constexpr auto count = sizeof...(types);
+
+            constexpr bool fillers [] = { is_niche_filler<types>... };
+            constexpr std::size_t niches [] = { niche_traits<types>::count... };
+
+            const auto dataful_count = std::ranges::count(fillers, false);
+            const auto dataful       = std::ranges::find(fillers, false) - std::ranges::begin(fillers);
+
+            if ((count < 2) || (dataful_count != 1) || (niches[dataful] < count - 1))
+            {
+                return count;
+            }
+
+            return static_cast<std::size_t>(dataful);
+        }
+
+        template <typename ... types>
+        using variant_layout = std::conditional_t
+        <
+            (find_dataful<types...>() < sizeof...(types)),
+            niche_layout<find_dataful<types...>(), types...>,
+            tagged_layout<types...>
+        >;
+
+        struct variant_access
+        {
+            template <std::size_t index, typename variant_type>
+            static auto get (variant_type&& variant) noexcept -> decltype(auto)
+            {
+                auto& value = *variant.layout.template pointer<index>();
+
+                if constexpr (std::is_lvalue_reference_v<variant_type>)
+                {
+                    return (value);
+                }
+                else
+                {
+                    return std::move(value);
+                }
+            }
+        };
+
+
+        template <typename ... types>
+        concept all_copy_constructible = (std::is_copy_constructible_v<types> && ...);
+
+        template <typename ... types>
+        concept all_trivially_copyable = (std::is_trivially_copy_constructible_v<types> && ...)
+                                      && (std::is_trivially_move_constructible_v<types> && ...)
+                                      && (std::is_trivially_copy_assignable_v   <types> && ...)
+                                      && (std::is_trivially_move_assignable_v   <types> && ...)
+                                      && (std::is_trivially_destructible_v      <types> && ...);
+
+        template <typename ... types>
+        concept all_trivially_destructible = (std::is_trivially_destructible_v<types> && ...);
+    }
+
+
+    // note: The cxx::variant is never valueless, as opposed to the std::variant,
+    //       because all its alternatives have to be nothrow move constructible,
+    //       hence a new alternative, whose construction might throw,
+    //       can be constructed aside and then moved into the variant.
+    //
+    // [WG21 P0088R3] - Variant: a type-safe union for C++17
+    //  ~ https://www.open-std.org/jtc1/sc22/wg21/docs/papers/2016/p0088r3.html
+    //
+    template <typename ... types>
+    class variant
+    {
+        static_assert(sizeof...(types) > 0);
+
+        static_assert(((std::is_object_v<types> && !std::is_array_v<types>) && ...));
+
+        static_assert((std::is_nothrow_move_constructible_v<types> && ...),
+                      "Alternatives of variant have to be nothrow move constructible.");
+
+        friend struct detail::variant_access;
+
+    private:
+        using layout_type = detail::variant_layout<types...>;
+
+        template <std::size_t index>
+        using alternative = detail::nth_type<index, types...>;
+
+        layout_type layout;
+
+        auto destroy () noexcept -> void
+        {
+            if constexpr (!detail::all_trivially_destructible<types...>)
+            {
+                detail::dispatch<sizeof...(types)>
+                (
+                    index(),
+                    [this] <std::size_t index> (std::integral_constant<std::size_t, index>)
+                    {
+                        layout.template destroy<index>();
+                    }
+                );
+            }
+        }
+
+        template <typename variant_type>
+        auto construct_from (variant_type&& other) -> void
+        {
+            detail::dispatch<sizeof...(types)>
+            (
+                other.index(),
+                [this, &other] <std::size_t index> (std::integral_constant<std::size_t, index>)
+                {
+                    layout.template construct<index>
+                    (
+                        detail::variant_access::get<index>(std::forward<variant_type>(other))
+                    );
+                }
+            );
+        }
+
+    public:
+        variant ()
+        noexcept (std::is_nothrow_default_constructible_v<alternative<0>>)
+        requires std::default_initializable<alternative<0>>
+        //
+        {
+            layout.template construct<0>();
+        }
+
+        template <typename value_type>
+        requires (detail::occurrences<std::remove_cvref_t<value_type>, types...> == 1)
+        //
+        variant (value_type&& value)
+        noexcept (std::is_nothrow_constructible_v<std::remove_cvref_t<value_type>, value_type>)
+        {
+            constexpr auto index = detail::index_of<std::remove_cvref_t<value_type>, types...>;
+
+            layout.template construct<index>(std::forward<value_type>(value));
+        }
+
+        template <std::size_t index, typename ... arguments>
+        explicit variant (std::in_place_index_t<index>, arguments&& ... args)
+        {
+            layout.template construct<index>(std::forward<arguments>(args)...);
+        }
+
+        template <typename type, typename ... arguments>
+        explicit variant (std::in_place_type_t<type>, arguments&& ... args)
+        {
+            layout.template construct<detail::index_of<type, types...>>(std::forward<arguments>(args)...);
+        }
+
+        ~variant ()
+        requires detail::all_trivially_destructible<types...>
+        //
+        = default;
+
+        ~variant ()
+        {
+            destroy();
+        }
+
+        variant (const variant&)
+        requires detail::all_copy_constructible<types...> && detail::all_trivially_copyable<types...>
+        //
+        = default;
+
+        variant (const variant& other)
+        requires detail::all_copy_constructible<types...>
+        //
+        {
+            construct_from(other);
+        }
+
+        variant (variant&&)
+        requires detail::all_trivially_copyable<types...>
+        //
+        = default;
+
+        variant (variant&& other) noexcept
+        {
+            construct_from(std::move(other));
+        }
+
+        auto operator = (const variant&) -> variant&
+        requires detail::all_copy_constructible<types...> && detail::all_trivially_copyable<types...>
+        //
+        = default;
+
+        auto operator = (const variant& other) -> variant&
+        requires detail::all_copy_constructible<types...>
+        //
+        {
+            if (this != &other)
+            {
+                auto copy = variant { other };
+
+                destroy();
+
+                construct_from(std::move(copy));
+            }
+
+            return *this;
+        }
+
+        auto operator = (variant&&) -> variant&
+        requires detail::all_trivially_copyable<types...>
+        //
+        = default;
+
+        auto operator = (variant&& other) noexcept -> variant&
+        {
+            if (this != &other)
+            {
+                destroy();
+
+                construct_from(std::move(other));
+            }
+
+            return *this;
+        }
+
+        template <typename value_type>
+        requires (detail::occurrences<std::remove_cvref_t<value_type>, types...> == 1)
+        //
+        auto operator = (value_type&& value) -> variant&
+        {
+            emplace<std::remove_cvref_t<value_type>>(std::forward<value_type>(value));
+
+            return *this;
+        }
+
+        template <std::size_t index, typename ... arguments>
+        auto emplace (arguments&& ... args) -> alternative<index>&
+        {
+            if constexpr (std::is_nothrow_constructible_v<alternative<index>, arguments...>)
+            {
+                destroy();
+
+                layout.template construct<index>(std::forward<arguments>(args)...);
+            }
+            else
+            {
+                auto value = alternative<index> (std::forward<arguments>(args)...);
+
+                destroy();
+
+                layout.template construct<index>(std::move(value));
+            }
+
+            return *layout.template pointer<index>();
+        }
+
+        template <typename type, typename ... arguments>
+        auto emplace (arguments&& ... args) -> type&
+        {
+            return emplace<detail::index_of<type, types...>>(std::forward<arguments>(args)...);
+        }
+
+        [[nodiscard]]
+        auto index () const noexcept -> std::size_t
+        {
+            return layout.index();
+        }
+    };
+
+
+    template <std::size_t index, typename variant_type>
+    requires detail::is_variant<std::remove_cvref_t<variant_type>>
+    //
+    [[nodiscard]]
+    auto get (variant_type&& variant) noexcept -> decltype(auto)
+    {
+        assert(variant.index() == index);
+
+        return detail::variant_access::get<index>(std::forward<variant_type>(variant));
+    }
+
+    template <typename type, typename ... types>
+    [[nodiscard]]
+    auto get (variant<types...>& variant) noexcept -> type&
+    {
+        return cxx::get<detail::index_of<type, types...>>(variant);
+    }
+
+    template <typename type, typename ... types>
+    [[nodiscard]]
+    auto get (const variant<types...>& variant) noexcept -> const type&
+    {
+        return cxx::get<detail::index_of<type, types...>>(variant);
+    }
+
+    template <typename type, typename ... types>
+    [[nodiscard]]
+    auto get (variant<types...>&& variant) noexcept -> type&&
+    {
+        return cxx::get<detail::index_of<type, types...>>(std::move(variant));
+    }
+
+    template <std::size_t index, typename ... types>
+    [[nodiscard]]
+    auto get_if (variant<types...>* const variant) noexcept -> detail::nth_type<index, types...>*
+    {
+        if ((variant == nullptr) || (variant->index() != index))
+        {
+            return nullptr;
+        }
+
+        return &detail::variant_access::get<index>(*variant);
+    }
+
+    template <std::size_t index, typename ... types>
+    [[nodiscard]]
+    auto get_if (const variant<types...>* const variant) noexcept -> const detail::nth_type<index, types...>*
+    {
+        if ((variant == nullptr) || (variant->index() != index))
+        {
+            return nullptr;
+        }
+
+        return &detail::variant_access::get<index>(*variant);
+    }
+
+    template <typename type, typename ... types>
+    [[nodiscard]]
+    auto holds_alternative (const variant<types...>& variant) noexcept -> bool
+    {
+        return variant.index() == detail::index_of<type, types...>;
+    }
+
+
+    namespace detail
+    {
+        // note: Multiple variants are visited through a single table,
+        //       indexed by a flattened index of all their alternatives,
+        //       in which the last variant varies the fastest.
+        //
+        template <std::size_t flat_index, std::size_t position, std::size_t ... sizes>
+        consteval auto unflatten () -> std::size_t
+        {
+            constexpr std::size_t size [] = { sizes... };
+
+            auto stride = std::size_t { 1 };
+
+            for (auto next = position + 1; next < sizeof...(sizes); ++next)
+            {
+                stride *= size[next];
+            }
+
+            return (flat_index / stride) % size[position];
+        }
+    }
+
+    template <typename visitor_type, typename ... variant_types>
+    requires (sizeof...(variant_types) > 0) && (detail::is_variant<std::remove_cvref_t<variant_types>> && ...)
+    //
+    auto visit (visitor_type&& visitor, variant_types&& ... variants) -> decltype(auto)
+    {
+        constexpr auto count = (variant_size<std::remove_cvref_t<variant_types>> * ... * 1);
+
+        auto flat_index = std::size_t { 0 };
+
+        ((flat_index = flat_index * variant_size<std::remove_cvref_t<variant_types>> + variants.index()), ...);
+
+        return detail::dispatch<count>
+        (
+            flat_index,
+            [&] <std::size_t flat> (std::integral_constant<std::size_t, flat>) -> decltype(auto)
+            {
+                return [&] <std::size_t ... positions> (std::index_sequence<positions...>) -> decltype(auto)
+                {
+                    return std::invoke
+                    (
+                        std::forward<visitor_type>(visitor),
+                        detail::variant_access::get
+                        <
+                            detail::unflatten<flat, positions, variant_size<std::remove_cvref_t<variant_types>>...>()
+                        >
+                        (std::forward<variant_types>(variants))...
+                    );
+                }
+                (std::index_sequence_for<variant_types...> { });
+            }
+        );
+    }
+
+
+    template <typename ... types>
+    requires (std::equality_comparable<types> && ...)
+    //
+    auto operator == (const variant<types...>& lhs, const variant<types...>& rhs) -> bool
+    {
+        if (lhs.index() != rhs.index())
+        {
+            return false;
+        }
+
+        return detail::dispatch<sizeof...(types)>
+        (
+            lhs.index(),
+            [&] <std::size_t index> (std::integral_constant<std::size_t, index>) -> bool
+            {
+                return detail::variant_access::get<index>(lhs) == detail::variant_access::get<index>(rhs);
+            }
+        );
+    }
+
+
+    // note: Niches of a variant are either the unused values of its discriminant,
+    //       or the niches of its dataful alternative left after encoding indices
+    //       of its empty alternatives.
+    //
+    template <typename ... types>
+    struct niche_traits <variant<types...>>
+    {
+        using layout_type = detail::variant_layout<types...>;
+
+        static_assert(std::is_standard_layout_v<layout_type>);
+
+        static constexpr auto count = layout_type::niche_count;
+
+        static auto store (void* const storage, const std::size_t niche) noexcept -> void
+        {
+            layout_type::store_niche(storage, niche);
+        }
+
+        [[nodiscard]]
+        static auto load (const void* const storage) noexcept -> std::size_t
+        {
+            return layout_type::load_niche(storage);
+        }
+    };
+}
+
+
+#endif
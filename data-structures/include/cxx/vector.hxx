@@ -37,32 +37,875 @@
 #define CXX_VECTOR
 
 
-#include <cassert>
+#include <cxx/allocator.hxx>
+
+#include <cxx/contracts.hxx>
+
+#include <algorithm>
 
 #include <cstddef>
 
+#include <cstring>
+
 #include <initializer_list>
 
+#include <iterator>
+
+#include <memory>
+
 #include <type_traits>
 
+#include <utility>
+
 
 namespace cxx
 {
-    template <typename value_type>
+    // [ISO C++] - P1144R6: Object relocation in terms of move plus destroy
+    //
+    // ~ https://www.open-std.org/jtc1/sc22/wg21/docs/papers/2022/p1144r6.html
+
+    // [GitHub] - Facebook: folly::fbvector
+    //
+    // ~ https://github.com/facebook/folly/blob/main/folly/docs/FBVector.md
+
+    // note: Relocating an object of a trivially relocatable type,
+    //       that is moving it to another memory location and
+    //       destroying the original object, is equivalent to
+    //       copying its bytes and forgetting about the original object.
+    //
+    //       All trivially copyable types are trivially relocatable.
+    //       Other types, such as most smart pointers and containers,
+    //       can opt in by specializing the cxx::is_trivially_relocatable.
+    //
+    template <typename type>
+    struct is_trivially_relocatable : std::bool_constant<std::is_trivially_copyable_v<type>>
+    {
+    };
+
+    template <typename type>
+    inline constexpr auto is_trivially_relocatable_v = cxx::is_trivially_relocatable<type>::value;
+
+
+    // note: The growth_factor determines the capacity of a vector
+    //       after reallocation, as a ratio of its previous capacity.
+    //
+    //       The factor of 2 minimizes the number of reallocations,
+    //       while factors smaller than the golden ratio, such as 3/2,
+    //       allow reusing previously freed memory blocks.
+    //
+    template <std::size_t numerator, std::size_t denominator = 1>
+    requires (numerator > denominator) && (denominator > 0)
+    //
+    struct growth_factor
+    {
+        [[nodiscard]]
+        static constexpr auto grow (const std::size_t capacity) noexcept -> std::size_t
+        {
+            return std::max(capacity * numerator / denominator, capacity + 1);
+        }
+    };
+
+
+    namespace detail
+    {
+        template <typename value_type, std::size_t capacity>
+        struct inline_buffer
+        {
+            alignas(value_type) std::byte bytes [capacity * sizeof(value_type)];
+
+            auto data () const noexcept -> value_type*
+            {
+                return reinterpret_cast<value_type*>(const_cast<std::byte*>(bytes));
+            }
+        };
+
+        template <typename value_type>
+        struct inline_buffer <value_type, 0>
+        {
+            auto data () const noexcept -> value_type*
+            {
+                return nullptr;
+            }
+        };
+    }
+
+
+    // note: The elements of a vector are stored in its inline buffer,
+    //       as long as they fit in it, and are relocated
+    //       to memory obtained from the allocator only afterwards.
+    //
+    //       Without the inline buffer (inline_capacity == 0),
+    //       the storage of an empty vector is the null pointer.
+    //
+    template <typename value_type,
+              typename allocator_type = cxx::allocator<value_type>,
+              typename growth_type    = cxx::growth_factor<2>,
+              std::size_t inline_capacity = 0>
     class vector
     {
     private:
-        value_type*   storage;
-        std::size_t  capacity;
-        std::size_t    length;
+        using allocator_traits = std::allocator_traits<allocator_type>;
+
+        static constexpr auto relocatable = cxx::is_trivially_relocatable_v<value_type>;
+
+        value_type*    storage;
+        std::size_t   reserved;
+        std::size_t     length;
+
+        [[no_unique_address]]
+        allocator_type                                       allocator;
+
+        [[no_unique_address]]
+        detail::inline_buffer<value_type, inline_capacity>      buffer;
+
+        [[nodiscard]]
+        auto is_inline () const noexcept -> bool
+        {
+            return storage == buffer.data();
+        }
+
+        auto release () noexcept -> void
+        {
+            if (!is_inline())
+            {
+                allocator_traits::deallocate(allocator, storage, reserved);
+            }
+
+            storage  = buffer.data();
+            reserved = inline_capacity;
+        }
+
+        // note: Moves the elements to uninitialized memory,
+        //       which does not overlap with them,
+        //       and then destroys the original elements.
+        //
+        //       When an exception is thrown, the original elements
+        //       are left intact (strong exception guarantee),
+        //       unless they can be neither copied, nor moved without
+        //       throwing, in which case they remain in a valid state.
+        //
+        auto relocate (value_type* const  source,
+                       const std::size_t   count,
+                       value_type* const  target) -> void
+        {
+            if constexpr (relocatable)
+            {
+                if (count != 0)
+                {
+                    std::memcpy(static_cast<void*>(target), source, count * sizeof(value_type));
+                }
+            }
+            else
+            {
+                auto constructed = std::size_t { 0 };
+
+                try
+                {
+                    for (; constructed != count; ++constructed)
+                    {
+                        allocator_traits::construct(allocator, target + constructed,
+                                                    std::move_if_noexcept(source[constructed]));
+                    }
+                }
+                catch (...)
+                {
+                    destroy(target, target + constructed);
+
+                    throw;
+                }
+
+                destroy(source, source + count);
+            }
+        }
+
+        auto destroy (value_type* const first, value_type* const last) noexcept -> void
+        {
+            for (auto element = first; element != last; ++element)
+            {
+                allocator_traits::destroy(allocator, element);
+            }
+        }
+
+        auto reallocate (const std::size_t capacity) -> void
+        {
+            const auto target = (capacity <= inline_capacity)
+                              ? buffer.data()
+                              : allocator_traits::allocate(allocator, capacity);
+
+            if (target == storage)
+            {
+                return;
+            }
+
+            try
+            {
+                relocate(storage, length, target);
+            }
+            catch (...)
+            {
+                if (target != buffer.data())
+                {
+                    allocator_traits::deallocate(allocator, target, capacity);
+                }
+
+                throw;
+            }
+
+            release();
+
+            storage  = target;
+            reserved = std::max(capacity, inline_capacity);
+        }
+
+        [[nodiscard]]
+        auto grown_capacity (const std::size_t required) const noexcept -> std::size_t
+        {
+            cxx_expects(required <= max_size());
+
+            return std::clamp(growth_type::grow(reserved), required, max_size());
+        }
+
+        // note: When the vector is full, the new element is constructed
+        //       in the new storage, before the old elements are relocated,
+        //       since the arguments might refer to the old elements.
+        //
+        template <typename ... args_types>
+        auto reallocate_and_emplace_back (args_types&& ... args) -> value_type&
+        {
+            const auto capacity = grown_capacity(length + 1);
+            const auto target   = allocator_traits::allocate(allocator, capacity);
+
+            try
+            {
+                allocator_traits::construct(allocator, target + length,
+                                            std::forward<args_types>(args)...);
+            }
+            catch (...)
+            {
+                allocator_traits::deallocate(allocator, target, capacity);
+
+                throw;
+            }
+
+            try
+            {
+                relocate(storage, length, target);
+            }
+            catch (...)
+            {
+                allocator_traits::destroy(allocator, target + length);
+                allocator_traits::deallocate(allocator, target, capacity);
+
+                throw;
+            }
+
+            release();
+
+            storage  = target;
+            reserved = capacity;
+            length  += 1;
+
+            return storage[length - 1];
+        }
+
+        // note: Takes over the elements of the other vector,
+        //       which must have been emptied by the caller,
+        //       by stealing its storage, unless the elements
+        //       are stored in the inline buffer of the other vector.
+        //
+        auto take_over (vector& other) -> void
+        {
+            cxx_expects(empty() && is_inline());
+
+            if (!other.is_inline())
+            {
+                storage  = std::exchange(other.storage,  other.buffer.data());
+                reserved = std::exchange(other.reserved, inline_capacity);
+                length   = std::exchange(other.length,   0);
+            }
+            else if constexpr (relocatable)
+            {
+                relocate(other.storage, other.length, storage);
+
+                length = std::exchange(other.length, 0);
+            }
+            else
+            {
+                for (auto& element : other)
+                {
+                    emplace_back(std::move(element));
+                }
+
+                other.clear();
+            }
+        }
 
     public:
+        using            size_type = std::size_t;
+        using      difference_type = std::ptrdiff_t;
+        using            reference =       value_type&;
+        using      const_reference = const value_type&;
+        using              pointer =       value_type*;
+        using        const_pointer = const value_type*;
+        using             iterator =       value_type*;
+        using       const_iterator = const value_type*;
+        using     reverse_iterator = std::reverse_iterator<      iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        // note: Parentheses, rather than braces, are used to delegate
+        //       between constructors, because a braced initializer
+        //       would prefer the std::initializer_list constructor,
+        //       whenever the value_type is constructible from the arguments.
+        //
+        vector () noexcept(std::is_nothrow_default_constructible_v<allocator_type>)
+        :
+            vector(allocator_type { })
+        {
+        }
+
+        explicit vector (const allocator_type& allocator) noexcept
+        :
+            storage   { nullptr         },
+            reserved  { inline_capacity },
+            length    { 0               },
+            allocator { allocator       },
+            buffer    {                 }
+        {
+            storage = buffer.data();
+        }
+
+        explicit vector (const std::size_t count, const allocator_type& allocator = { })
+        :
+            vector(allocator)
+        {
+            resize(count);
+        }
+
+        vector (const std::size_t       count,
+                const value_type&       value, const allocator_type& allocator = { })
+        :
+            vector(allocator)
+        {
+            resize(count, value);
+        }
+
+        template <std::input_iterator iterator_type>
+        vector (iterator_type first, const iterator_type last,
+                                        const allocator_type& allocator = { })
+        :
+            vector(allocator)
+        {
+            if constexpr (std::forward_iterator<iterator_type>)
+            {
+                reserve(static_cast<std::size_t>(std::distance(first, last)));
+            }
+
+            for (; first != last; ++first)
+            {
+                emplace_back(*first);
+            }
+        }
+
+        vector (const std::initializer_list<value_type> init_list,
+                const allocator_type&                   allocator = { })
+        :
+            vector(init_list.begin(), init_list.end(), allocator)
+        {
+        }
+
+        ~vector () noexcept
+        {
+            clear();
+            release();
+        }
+
+        vector (const vector& other)
+        :
+            vector(other.begin(), other.end(),
+                   allocator_traits::select_on_container_copy_construction(other.allocator))
+        {
+        }
+
+        auto operator = (const vector& other) -> vector&
+        {
+            if (this != &other)
+            {
+                clear();
+
+                if constexpr (allocator_traits::propagate_on_container_copy_assignment::value)
+                {
+                    if (allocator != other.allocator)
+                    {
+                        release();
+                    }
+
+                    allocator = other.allocator;
+                }
+
+                reserve(other.size());
+
+                for (const auto& element : other)
+                {
+                    emplace_back(element);
+                }
+            }
+
+            return *this;
+        }
+
+        vector (vector&& other) noexcept((inline_capacity == 0) ||
+                                         std::is_nothrow_move_constructible_v<value_type>)
+        :
+            vector(other.allocator)
+        {
+            take_over(other);
+        }
+
+        auto operator = (vector&& other) noexcept((inline_capacity == 0) &&
+                                                  (allocator_traits::propagate_on_container_move_assignment::value ||
+                                                   allocator_traits::is_always_equal::value)) -> vector&
+        {
+            if (this != &other)
+            {
+                clear();
+
+                if constexpr (allocator_traits::propagate_on_container_move_assignment::value)
+                {
+                    release();
+
+                    allocator = other.allocator;
+
+                    take_over(other);
+                }
+                else
+                {
+                    if (allocator == other.allocator)
+                    {
+                        release();
+
+                        take_over(other);
+                    }
+                    else
+                    {
+                        reserve(other.size());
+
+                        for (auto& element : other)
+                        {
+                            emplace_back(std::move(element));
+                        }
+
+                        other.clear();
+                    }
+                }
+            }
+
+            return *this;
+        }
+
+        auto swap (vector& other) -> void
+        {
+            if (!this->is_inline() && !other.is_inline() &&
+                (allocator_traits::propagate_on_container_swap::value ||
+                 (this->allocator == other.allocator)))
+            {
+                using std::swap;
+
+                if constexpr (allocator_traits::propagate_on_container_swap::value)
+                {
+                    swap(this->allocator, other.allocator);
+                }
+
+                swap(this->storage,  other.storage );
+                swap(this->reserved, other.reserved);
+                swap(this->length,   other.length  );
+            }
+            else
+            {
+                auto temporary = std::move(other);
+
+                other = std::move(*this);
+                *this = std::move(temporary);
+            }
+        }
+
+        friend auto swap (vector& left, vector& right) -> void
+        {
+            left.swap(right);
+        }
+
+        [[nodiscard]]
+        auto get_allocator () const noexcept -> allocator_type
+        {
+            return allocator;
+        }
+
+        [[nodiscard]]
+        auto operator [] (const std::size_t index) noexcept -> value_type&
+        {
+            cxx_expects(index < length);
+
+            return storage[index];
+        }
+
+        [[nodiscard]]
+        auto operator [] (const std::size_t index) const noexcept -> const value_type&
+        {
+            cxx_expects(index < length);
+
+            return storage[index];
+        }
+
+        [[nodiscard]]
+        auto front () noexcept -> value_type&
+        {
+            cxx_expects(!empty());
+
+            return storage[0];
+        }
+
+        [[nodiscard]]
+        auto front () const noexcept -> const value_type&
+        {
+            cxx_expects(!empty());
+
+            return storage[0];
+        }
+
+        [[nodiscard]]
+        auto back () noexcept -> value_type&
+        {
+            cxx_expects(!empty());
+
+            return storage[length - 1];
+        }
+
+        [[nodiscard]]
+        auto back () const noexcept -> const value_type&
+        {
+            cxx_expects(!empty());
+
+            return storage[length - 1];
+        }
+
+        [[nodiscard]]
+        auto data () noexcept -> value_type*
+        {
+            return storage;
+        }
+
+        [[nodiscard]]
+        auto data () const noexcept -> const value_type*
+        {
+            return storage;
+        }
+
+        [[nodiscard]] auto begin () noexcept -> iterator { return storage;          }
+        [[nodiscard]] auto end   () noexcept -> iterator { return storage + length; }
+
+        [[nodiscard]] auto begin () const noexcept -> const_iterator { return storage;          }
+        [[nodiscard]] auto end   () const noexcept -> const_iterator { return storage + length; }
+
+        [[nodiscard]] auto cbegin () const noexcept -> const_iterator { return begin(); }
+        [[nodiscard]] auto cend   () const noexcept -> const_iterator { return end  (); }
+
+        [[nodiscard]] auto rbegin () noexcept -> reverse_iterator { return reverse_iterator { end  () }; }
+        [[nodiscard]] auto rend   () noexcept -> reverse_iterator { return reverse_iterator { begin() }; }
+
+        [[nodiscard]] auto rbegin () const noexcept -> const_reverse_iterator { return const_reverse_iterator { end  () }; }
+        [[nodiscard]] auto rend   () const noexcept -> const_reverse_iterator { return const_reverse_iterator { begin() }; }
+
         [[nodiscard]]
         constexpr auto empty () const noexcept -> bool
         {
             return length == 0;
         }
+
+        [[nodiscard]]
+        constexpr auto size () const noexcept -> std::size_t
+        {
+            return length;
+        }
+
+        [[nodiscard]]
+        constexpr auto capacity () const noexcept -> std::size_t
+        {
+            return reserved;
+        }
+
+        [[nodiscard]]
+        auto max_size () const noexcept -> std::size_t
+        {
+            return allocator_traits::max_size(allocator);
+        }
+
+        // note: Exactly the requested capacity is allocated,
+        //       without applying the growth_factor.
+        //
+        auto reserve (const std::size_t capacity) -> void
+        {
+            cxx_expects(capacity <= max_size());
+
+            if (capacity > reserved)
+            {
+                reallocate(capacity);
+            }
+        }
+
+        // note: The elements are moved back to the inline buffer,
+        //       whenever they fit in it.
+        //
+        auto shrink_to_fit () -> void
+        {
+            // note: An empty vector only releases its storage, since there is
+            //       nothing to relocate into the inline buffer, which may be null.
+            //
+            if (reserved > std::max(length, inline_capacity))
+            {
+                if (length == 0)
+                {
+                    release();
+                }
+                else
+                {
+                    reallocate(length);
+                }
+            }
+        }
+
+        auto clear () noexcept -> void
+        {
+            destroy(storage, storage + length);
+
+            length = 0;
+        }
+
+        template <typename ... args_types>
+        auto emplace_back (args_types&& ... args) -> value_type&
+        {
+            if (length == reserved)
+            {
+                return reallocate_and_emplace_back(std::forward<args_types>(args)...);
+            }
+
+            allocator_traits::construct(allocator, storage + length,
+                                        std::forward<args_types>(args)...);
+            length += 1;
+
+            return storage[length - 1];
+        }
+
+        auto push_back (const value_type& value) -> void
+        {
+            emplace_back(value);
+        }
+
+        auto push_back (value_type&& value) -> void
+        {
+            emplace_back(std::move(value));
+        }
+
+        auto pop_back () noexcept -> void
+        {
+            cxx_expects(!empty());
+
+            length -= 1;
+
+            allocator_traits::destroy(allocator, storage + length);
+        }
+
+        // note: Elements of trivially relocatable types are shifted
+        //       by a single std::memmove() and the new element is
+        //       constructed aside, then relocated into the gap,
+        //       so that no exception can be thrown after shifting.
+        //
+        template <typename ... args_types>
+        auto emplace (const const_iterator position, args_types&& ... args) -> iterator
+        {
+            cxx_expects((begin() <= position) && (position <= end()));
+
+            const auto index = static_cast<std::size_t>(position - begin());
+
+            if (index == length)
+            {
+                emplace_back(std::forward<args_types>(args)...);
+
+                return begin() + index;
+            }
+
+            if constexpr (relocatable)
+            {
+                alignas(value_type) std::byte temporary [sizeof(value_type)];
+
+                const auto value = reinterpret_cast<value_type*>(temporary);
+
+                allocator_traits::construct(allocator, value, std::forward<args_types>(args)...);
+
+                if (length == reserved)
+                {
+                    try
+                    {
+                        reallocate(grown_capacity(length + 1));
+                    }
+                    catch (...)
+                    {
+                        allocator_traits::destroy(allocator, value);
+
+                        throw;
+                    }
+                }
+
+                std::memmove(static_cast<void*>(storage + index + 1), storage + index,
+                             (length - index) * sizeof(value_type));
+                std::memcpy (static_cast<void*>(storage + index), value, sizeof(value_type));
+            }
+            else
+            {
+                auto value = value_type(std::forward<args_types>(args)...);
+
+                if (length == reserved)
+                {
+                    reallocate(grown_capacity(length + 1));
+                }
+
+                allocator_traits::construct(allocator, storage + length,
+                                            std::move(storage[length - 1]));
+
+                std::move_backward(storage + index, storage + length - 1, storage + length);
+
+                storage[index] = std::move(value);
+            }
+
+            length += 1;
+
+            return begin() + index;
+        }
+
+        auto insert (const const_iterator position, const value_type& value) -> iterator
+        {
+            return emplace(position, value);
+        }
+
+        auto insert (const const_iterator position, value_type&& value) -> iterator
+        {
+            return emplace(position, std::move(value));
+        }
+
+        auto erase (const const_iterator first, const const_iterator last) -> iterator
+        {
+            cxx_expects((begin() <= first) && (first <= last) && (last <= end()));
+
+            const auto index = static_cast<std::size_t>(first - begin());
+            const auto count = static_cast<std::size_t>(last  - first);
+
+            if (count == 0)
+            {
+                return begin() + index;
+            }
+
+            if constexpr (relocatable)
+            {
+                destroy(storage + index, storage + index + count);
+
+                std::memmove(static_cast<void*>(storage + index), storage + index + count,
+                             (length - index - count) * sizeof(value_type));
+            }
+            else
+            {
+                std::move(storage + index + count, storage + length, storage + index);
+
+                destroy(storage + length - count, storage + length);
+            }
+
+            length -= count;
+
+            return begin() + index;
+        }
+
+        auto erase (const const_iterator position) -> iterator
+        {
+            return erase(position, position + 1);
+        }
+
+        auto resize (const std::size_t count) -> void
+        {
+            if (count < length)
+            {
+                destroy(storage + count, storage + length);
+
+                length = count;
+            }
+            else
+            {
+                reserve(count);
+
+                while (length != count)
+                {
+                    emplace_back();
+                }
+            }
+        }
+
+        auto resize (const std::size_t count, const value_type& value) -> void
+        {
+            if (count < length)
+            {
+                destroy(storage + count, storage + length);
+
+                length = count;
+            }
+            else if (count > reserved)
+            {
+                // note: The value may refer to an element of this vector,
+                //       which the reallocation would free, thus it is copied first.
+                //
+                const auto copy = value_type (value);
+
+                reserve(count);
+
+                while (length != count)
+                {
+                    emplace_back(copy);
+                }
+            }
+            else
+            {
+                reserve(count);
+
+                while (length != count)
+                {
+                    emplace_back(value);
+                }
+            }
+        }
+
+        [[nodiscard]]
+        friend auto operator == (const vector& left, const vector& right) -> bool
+        {
+            return std::equal(left.begin(), left.end(), right.begin(), right.end());
+        }
+    };
+
+
+    // note: Without the inline buffer, a vector refers to its elements
+    //       only through a pointer, thus it is trivially relocatable,
+    //       as long as its allocator is.
+    //
+    template <typename value_type, typename allocator_type, typename growth_type>
+    struct is_trivially_relocatable <cxx::vector<value_type, allocator_type, growth_type, 0>>
+    :
+        std::bool_constant<cxx::is_trivially_relocatable_v<allocator_type>>
+    {
     };
+
+
+    // note: The small_vector never allocates memory,
+    //       as long as it holds at most inline_capacity elements.
+    //
+    template <typename value_type,
+              std::size_t inline_capacity,
+              typename allocator_type = cxx::allocator<value_type>,
+              typename growth_type    = cxx::growth_factor<2>>
+    using small_vector = cxx::vector<value_type, allocator_type, growth_type, inline_capacity>;
 }
 
 
@@ -0,0 +1,242 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <cxx/arena.hxx>
+
+#include <cxx/list.hxx>
+#include <cxx/vector.hxx>
+
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+    // note: The counting_resource forwards allocations upstream,
+    //       while counting bytes, which have not been deallocated yet.
+    //
+    class counting_resource final : public std::pmr::memory_resource
+    {
+    public:
+        std::size_t allocations        = 0;
+        std::size_t outstanding_bytes  = 0;
+
+    private:
+        auto do_allocate (const std::size_t bytes, const std::size_t alignment) -> void* override
+        {
+            ++allocations;
+            outstanding_bytes += bytes;
+
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        auto do_deallocate (void* const pointer, const std::size_t bytes,
+                            const std::size_t alignment) -> void override
+        {
+            outstanding_bytes -= bytes;
+
+            std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+        }
+
+        auto do_is_equal (const std::pmr::memory_resource& other) const noexcept -> bool override
+        {
+            return this == &other;
+        }
+    };
+
+    auto is_aligned (const void* const pointer, const std::size_t alignment) -> bool
+    {
+        return reinterpret_cast<std::uintptr_t>(pointer) % alignment == 0;
+    }
+}
+
+
+TEST_CASE ("[arena] monotonic_arena allocates from the buffer")
+{
+    alignas(64) auto buffer = std::array<std::byte, 256> { };
+
+    auto upstream = counting_resource { };
+    auto arena    = cxx::monotonic_arena { buffer, &upstream };
+
+    const auto first  = arena.allocate(10, 1);
+    const auto second = arena.allocate(16, 16);
+    const auto third  = arena.allocate( 8, 64);
+
+    REQUIRE(first  == buffer.data());
+    REQUIRE(is_aligned(second, 16));
+    REQUIRE(is_aligned(third,  64));
+
+    REQUIRE(static_cast<std::byte*>(second) >= static_cast<std::byte*>(first)  + 10);
+    REQUIRE(static_cast<std::byte*>(third)  >= static_cast<std::byte*>(second) + 16);
+
+    REQUIRE(upstream.allocations    == 0);
+    REQUIRE(arena.upstream_bytes()  == 0);
+}
+
+
+TEST_CASE ("[arena] monotonic_arena falls back to upstream")
+{
+    auto buffer = std::array<std::byte, 64> { };
+
+    auto upstream = counting_resource { };
+
+    {
+        auto arena = cxx::monotonic_arena { buffer, &upstream };
+
+        for (auto n = 0; n != 100; ++n)
+        {
+            const auto pointer = arena.allocate(48, 8);
+
+            REQUIRE(is_aligned(pointer, 8));
+        }
+
+        const auto huge = arena.allocate(1 << 20, 4096);
+
+        REQUIRE(is_aligned(huge, 4096));
+
+        REQUIRE(upstream.allocations > 0);
+        REQUIRE(upstream.allocations < 10);
+        REQUIRE(arena.upstream_bytes() == upstream.outstanding_bytes);
+
+        arena.release();
+
+        REQUIRE(upstream.outstanding_bytes == 0);
+        REQUIRE(arena.allocate(16, 8) == buffer.data());
+
+        static_cast<void>(arena.allocate(1024, 8));
+    }
+
+    REQUIRE(upstream.outstanding_bytes == 0);
+}
+
+
+TEST_CASE ("[arena] frame_arena is enlarged after spilling")
+{
+    auto upstream = counting_resource { };
+
+    {
+        auto arena = cxx::frame_arena { 128, &upstream };
+
+        static_cast<void>(arena.allocate( 64));
+        static_cast<void>(arena.allocate(256));
+
+        REQUIRE(arena.used() > 128);
+
+        arena.reset();
+
+        REQUIRE(arena.used() == 0);
+        REQUIRE(arena.size()  > 128 + 256);
+
+        const auto allocations = upstream.allocations;
+
+        for (auto frame = 0; frame != 10; ++frame)
+        {
+            static_cast<void>(arena.allocate(64));
+            static_cast<void>(arena.allocate(256));
+
+            arena.reset();
+        }
+
+        REQUIRE(upstream.allocations == allocations);
+    }
+
+    REQUIRE(upstream.outstanding_bytes == 0);
+}
+
+
+TEST_CASE ("[arena] containers allocating from an arena")
+{
+    auto upstream = counting_resource { };
+    auto arena    = cxx::monotonic_arena { &upstream };
+
+    using allocator_type = cxx::arena_allocator<int>;
+
+    auto vector = cxx::vector<int, allocator_type> { allocator_type { arena } };
+    auto list   = cxx::list  <int, allocator_type> { allocator_type { arena } };
+
+    for (auto n = 0; n != 1'000; ++n)
+    {
+        vector.push_back(n);
+        list  .push_back(n);
+    }
+
+    REQUIRE(vector.size() == 1'000);
+    REQUIRE(list  .size() == 1'000);
+    REQUIRE(vector.back() == list.back());
+
+    REQUIRE(vector.get_allocator() == list.get_allocator());
+    REQUIRE(&vector.get_allocator().get_arena() == &arena);
+
+    REQUIRE(upstream.allocations < 20);
+}
+
+
+TEST_CASE ("[arena] memory_resource_adapter")
+{
+    auto arena    = cxx::frame_arena { 4096 };
+    auto resource = cxx::memory_resource_adapter { arena };
+
+    auto strings = std::pmr::vector<std::pmr::string> { &resource };
+
+    strings.emplace_back("a string long enough to avoid the small string optimization");
+    strings.emplace_back("b");
+
+    REQUIRE(strings.size() == 2);
+    REQUIRE(strings.front().get_allocator().resource() == &resource);
+    REQUIRE(arena.used() > 0);
+}
+
+
+TEST_CASE ("[arena] resource_allocator")
+{
+    auto buffer   = std::array<std::byte, 1024> { };
+    auto resource = std::pmr::monotonic_buffer_resource { buffer.data(), buffer.size(),
+                                                          std::pmr::null_memory_resource() };
+
+    auto vector = cxx::vector<int, cxx::resource_allocator<int>> { cxx::resource_allocator<int> { &resource } };
+
+    vector.reserve(16);
+
+    REQUIRE(static_cast<void*>(vector.data()) >= static_cast<void*>(buffer.data()));
+    REQUIRE(static_cast<void*>(vector.data()) <  static_cast<void*>(buffer.data() + buffer.size()));
+
+    REQUIRE(cxx::resource_allocator<int> { } == cxx::resource_allocator<char> { });
+    REQUIRE(cxx::resource_allocator<int> { } != cxx::resource_allocator<int> { &resource });
+}
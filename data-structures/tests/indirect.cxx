@@ -37,6 +37,10 @@
 
 #include <catch2/catch.hpp>
 
+#include <array>
+#include <cstdint>
+#include <string>
+
 
 namespace
 {
@@ -107,8 +111,8 @@ namespace
 {
     namespace check
     {
-        template <typename value_type>
-        auto empty (const cxx::indirect<value_type>& indirect) -> void
+        template <typename value_type, std::size_t inline_size>
+        auto empty (const cxx::indirect<value_type, inline_size>& indirect) -> void
         {
             // note: For instances of the cxx::indirect<> type,
             //       only moved from objects can be in the empty state.
@@ -335,3 +339,142 @@ TEST_CASE ("[indirect] compile-time evaluation")
 {
     static_assert(check::compile_time_evaluation());
 }
+
+
+namespace
+{
+    namespace test
+    {
+        class lifetime
+        {
+        private:
+            int* alive_count;
+
+        public:
+            explicit constexpr lifetime (int& alive_count) noexcept
+            :
+                alive_count { &alive_count }
+            {
+                ++*this->alive_count;
+            }
+
+            constexpr lifetime (const lifetime& other) noexcept
+            :
+                alive_count { other.alive_count }
+            {
+                ++*alive_count;
+            }
+
+            constexpr lifetime (lifetime&& other) noexcept
+            :
+                alive_count { other.alive_count }
+            {
+                ++*alive_count;
+            }
+
+            constexpr auto operator = (const lifetime&) noexcept -> lifetime& = default;
+
+            constexpr ~lifetime () noexcept
+            {
+                --*alive_count;
+            }
+        };
+    }
+
+    namespace check
+    {
+        template <typename value_type, std::size_t inline_size>
+        auto stored_inline (const cxx::indirect<value_type, inline_size>& indirect) -> bool
+        {
+            const auto object  = reinterpret_cast<std::uintptr_t>(&indirect);
+            const auto pointer = reinterpret_cast<std::uintptr_t>(indirect.operator ->());
+
+            return (object <= pointer) && (pointer < object + sizeof(indirect));
+        }
+    }
+}
+
+
+TEST_CASE ("[indirect] small values are stored inline")
+{
+    using inline_indirect = cxx::indirect<test::object, 32>;
+
+    static_assert( inline_indirect::is_stored_inline());
+    static_assert(sizeof(inline_indirect) == sizeof(test::object));
+
+    auto original = inline_indirect { 3, 0.6f, '@' };
+    REQUIRE(check::stored_inline(original));
+
+    const auto copy = original;
+    REQUIRE(check::stored_inline(copy));
+    REQUIRE(*copy == *original);
+
+    auto moved_to = std::move(original);
+    REQUIRE(check::stored_inline(moved_to));
+    REQUIRE(*moved_to == test::object { 3, 0.6f, '@' });
+
+    moved_to = copy;
+    moved_to->modify('#');
+    REQUIRE(*moved_to != *copy);
+}
+
+
+TEST_CASE ("[indirect] large values fall back to the heap")
+{
+    using large_object   = std::array<std::int64_t, 8>;
+    using large_indirect = cxx::indirect<large_object, 32>;
+
+    static_assert(!large_indirect::is_stored_inline());
+    static_assert(sizeof(large_indirect) == sizeof(large_object*));
+
+    auto original = large_indirect { large_object { 1, 2, 3 } };
+    REQUIRE(!check::stored_inline(original));
+
+    const auto moved_to = std::move(original);
+    REQUIRE((*moved_to)[2] == 3);
+
+    check::empty(original);
+}
+
+
+TEST_CASE ("[indirect] inline values are destroyed")
+{
+    auto alive_count = 0;
+    {
+        auto first  = cxx::indirect<test::lifetime, 16> { alive_count };
+        REQUIRE(alive_count == 1);
+
+        auto second = std::move(first);
+        REQUIRE(alive_count == 2);
+
+        first = std::move(second);
+        REQUIRE(alive_count == 2);
+
+        auto third = cxx::indirect<test::lifetime, 16> { second };
+        REQUIRE(alive_count == 3);
+    }
+    REQUIRE(alive_count == 0);
+}
+
+
+namespace
+{
+    namespace check
+    {
+        constexpr auto inline_compile_time_evaluation () noexcept -> bool
+        {
+            auto original = cxx::indirect<test::object, 16> { 8, 4.2f, '%' };
+            auto moved_to = std::move(original);
+
+            moved_to->modify('&');
+
+            return *moved_to == test::object { 7, 5.2f, '&' };
+        };
+    }
+}
+
+
+TEST_CASE ("[indirect] compile-time evaluation of inline storage")
+{
+    static_assert(check::inline_compile_time_evaluation());
+}
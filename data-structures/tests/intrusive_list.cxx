@@ -0,0 +1,262 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <cxx/intrusive_list.hxx>
+
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <vector>
+
+
+namespace
+{
+    struct lru_tag;
+
+    struct entry : cxx::intrusive_list_hook<       >,
+                   cxx::intrusive_list_hook<lru_tag>
+    {
+        std::string key;
+
+        explicit entry (std::string key)
+        :
+            key { std::move(key) }
+        {
+        }
+    };
+
+    template <typename list_type>
+    auto keys (const list_type& list) -> std::vector<std::string>
+    {
+        auto result = std::vector<std::string> { };
+
+        for (const auto& element : list)
+        {
+            result.push_back(element.key);
+        }
+
+        return result;
+    }
+}
+
+
+TEST_CASE ("[intrusive_list] default constructor")
+{
+    auto list = cxx::intrusive_list<entry> { };
+
+    REQUIRE(list.empty());
+    REQUIRE(list.size() == 0);
+
+    REQUIRE(list. begin() == list. end());
+    REQUIRE(list.cbegin() == list.cend());
+}
+
+
+TEST_CASE ("[intrusive_list] push & pop")
+{
+    auto a = entry { "a" };
+    auto b = entry { "b" };
+    auto c = entry { "c" };
+
+    auto list = cxx::intrusive_list<entry> { };
+
+    list.push_back (b);
+    list.push_front(a);
+    list.push_back (c);
+
+    REQUIRE(list.size() == 3);
+    REQUIRE(keys(list) == std::vector<std::string> { "a", "b", "c" });
+
+    REQUIRE(&list.front() == &a);
+    REQUIRE(&list.back () == &c);
+    REQUIRE(&*--list.end() == &c);
+
+    list.pop_front();
+    list.pop_back ();
+
+    REQUIRE(keys(list) == std::vector<std::string> { "b" });
+
+    list.push_back(a);
+
+    REQUIRE(keys(list) == std::vector<std::string> { "b", "a" });
+}
+
+
+TEST_CASE ("[intrusive_list] insert & erase")
+{
+    auto a = entry { "a" };
+    auto b = entry { "b" };
+    auto c = entry { "c" };
+
+    auto list = cxx::intrusive_list<entry> { };
+
+    list.insert(list.end(), c);
+    list.insert(list.insert(list.begin(), a), b);
+
+    REQUIRE(keys(list) == std::vector<std::string> { "b", "a", "c" });
+
+    const auto next = list.erase(list.iterator_to(a));
+
+    REQUIRE(&*next == &c);
+    REQUIRE(keys(list) == std::vector<std::string> { "b", "c" });
+}
+
+
+TEST_CASE ("[intrusive_list] element linked into several lists")
+{
+    auto entries = std::vector<entry> { };
+
+    for (const auto key : { "a", "b", "c", "d" })
+    {
+        entries.emplace_back(key);
+    }
+
+    auto bucket = cxx::intrusive_list<entry         > { };
+    auto lru    = cxx::intrusive_list<entry, lru_tag> { };
+
+    for (auto& element : entries)
+    {
+        bucket.push_back (element);
+        lru   .push_front(element);
+    }
+
+    REQUIRE(keys(bucket) == std::vector<std::string> { "a", "b", "c", "d" });
+    REQUIRE(keys(lru   ) == std::vector<std::string> { "d", "c", "b", "a" });
+
+    lru.splice(lru.begin(), lru, lru.iterator_to(entries[1]));
+    lru.splice(lru.end(),   lru, lru.iterator_to(entries[3]));
+
+    REQUIRE(keys(lru   ) == std::vector<std::string> { "b", "c", "a", "d" });
+    REQUIRE(keys(bucket) == std::vector<std::string> { "a", "b", "c", "d" });
+
+    lru.pop_back();
+    bucket.erase(bucket.iterator_to(entries[3]));
+
+    REQUIRE(keys(lru   ) == std::vector<std::string> { "b", "c", "a" });
+    REQUIRE(keys(bucket) == std::vector<std::string> { "a", "b", "c" });
+}
+
+
+TEST_CASE ("[intrusive_list] splice")
+{
+    auto a = entry { "a" };
+    auto b = entry { "b" };
+    auto c = entry { "c" };
+    auto d = entry { "d" };
+
+    auto list  = cxx::intrusive_list<entry> { };
+    auto other = cxx::intrusive_list<entry> { };
+
+    list .push_back(a);
+    list .push_back(d);
+    other.push_back(b);
+    other.push_back(c);
+
+    list.splice(list.iterator_to(d), other);
+
+    REQUIRE(other.empty());
+    REQUIRE(keys(list) == std::vector<std::string> { "a", "b", "c", "d" });
+
+    other.splice(other.end(), list, list.iterator_to(c));
+
+    REQUIRE(list .size() == 3);
+    REQUIRE(other.size() == 1);
+    REQUIRE(keys(list ) == std::vector<std::string> { "a", "b", "d" });
+    REQUIRE(keys(other) == std::vector<std::string> { "c" });
+}
+
+
+TEST_CASE ("[intrusive_list] move & clear")
+{
+    auto a = entry { "a" };
+    auto b = entry { "b" };
+
+    auto list = cxx::intrusive_list<entry> { };
+
+    list.push_back(a);
+    list.push_back(b);
+
+    auto moved = std::move(list);
+
+    REQUIRE(list.empty());
+    REQUIRE(keys(moved) == std::vector<std::string> { "a", "b" });
+
+    moved.clear();
+
+    REQUIRE(moved.empty());
+
+    list.push_back(b);
+    list.push_back(a);
+
+    REQUIRE(keys(list) == std::vector<std::string> { "b", "a" });
+}
+
+
+TEST_CASE ("[intrusive_list] elements outliving the list")
+{
+    auto a = entry { "a" };
+    auto b = entry { "b" };
+
+    {
+        auto list = cxx::intrusive_list<entry> { };
+
+        list.push_back(a);
+        list.push_back(b);
+    }
+
+    auto list = cxx::intrusive_list<entry> { };
+
+    list.push_back(b);
+    list.push_back(a);
+
+    REQUIRE(keys(list) == std::vector<std::string> { "b", "a" });
+}
+
+
+TEST_CASE ("[intrusive_list] copied element is not linked")
+{
+    auto a = entry { "a" };
+
+    auto list = cxx::intrusive_list<entry> { };
+
+    list.push_back(a);
+
+    auto copy = a;
+    copy.key  = "copy";
+
+    list.push_back(copy);
+
+    REQUIRE(keys(list) == std::vector<std::string> { "a", "copy" });
+}
@@ -37,6 +37,60 @@
 
 #include <catch2/catch.hpp>
 
+#include <memory>
+#include <string>
+
+
+namespace
+{
+    struct allocation_counter
+    {
+        int allocations   = 0;
+        int deallocations = 0;
+    };
+
+    template <typename type>
+    struct counting_allocator
+    {
+        using value_type = type;
+
+        allocation_counter* counter;
+
+        explicit counting_allocator (allocation_counter& counter) noexcept
+        :
+            counter { &counter }
+        {
+        }
+
+        template <typename other>
+        explicit(false) counting_allocator (const counting_allocator<other>& allocator) noexcept
+        :
+            counter { allocator.counter }
+        {
+        }
+
+        auto allocate (const std::size_t count) -> type*
+        {
+            ++counter->allocations;
+
+            return std::allocator<type> { }.allocate(count);
+        }
+
+        auto deallocate (type* const pointer, const std::size_t count) noexcept -> void
+        {
+            ++counter->deallocations;
+
+            std::allocator<type> { }.deallocate(pointer, count);
+        }
+
+        template <typename other>
+        auto operator == (const counting_allocator<other>& allocator) const noexcept -> bool
+        {
+            return counter == allocator.counter;
+        }
+    };
+}
+
 
 TEST_CASE ("[list] class template argument deduction")
 {
@@ -221,3 +275,115 @@ TEST_CASE ("[list] push_back & pop_front")
     list.pop_front ( );    REQUIRE(list == cxx::list<int> {               });
     list.push_back (5);    REQUIRE(list == cxx::list<int> {       5       });
 }
+
+
+TEST_CASE ("[list] nodes are allocated in slabs")
+{
+    auto counter = allocation_counter { };
+
+    {
+        auto list = cxx::list<int, counting_allocator<int>> { counting_allocator<int> { counter } };
+
+        for (auto n = 0; n != 1'000; ++n)
+        {
+            list.push_back (n);
+            list.push_front(n);
+        }
+
+        REQUIRE(list.size() == 2'000);
+        REQUIRE(counter.allocations < 100);
+
+        const auto allocations = counter.allocations;
+
+        for (auto n = 0; n != 1'000; ++n)
+        {
+            list.pop_front();
+            list.push_back(n);
+        }
+
+        REQUIRE(counter.allocations == allocations);
+        REQUIRE(counter.deallocations == 0);
+
+        list.clear();
+
+        REQUIRE(list.empty());
+        REQUIRE(counter.deallocations == counter.allocations);
+
+        list.push_back(7);
+
+        REQUIRE(list == cxx::list<int, counting_allocator<int>> { { 7 }, counting_allocator<int> { counter } });
+    }
+
+    REQUIRE(counter.deallocations == counter.allocations);
+}
+
+
+TEST_CASE ("[list] clear destroys elements")
+{
+    auto shared = std::make_shared<int>(7);
+
+    auto list = cxx::list<std::shared_ptr<int>> { };
+
+    for (auto n = 0; n != 100; ++n)
+    {
+        list.push_back(shared);
+    }
+
+    REQUIRE(shared.use_count() == 101);
+
+    list.clear();
+
+    REQUIRE(shared.use_count() == 1);
+}
+
+
+TEST_CASE ("[list] insert & erase")
+{
+    auto list = cxx::list { 2, 4 };
+
+    list.insert(list.end(), 5);
+    list.insert(list.begin(), 1);
+
+    auto it = list.insert(++++list.begin(), 3);
+
+    REQUIRE(*it == 3);
+    REQUIRE(list == cxx::list { 1, 2, 3, 4, 5 });
+
+    it = list.erase(it);
+
+    REQUIRE(*it == 4);
+
+    list.erase(list.begin());
+    list.erase(++list.begin());
+
+    REQUIRE(list == cxx::list { 2, 5 });
+    REQUIRE(list.size() == 2);
+}
+
+
+TEST_CASE ("[list] splice")
+{
+    auto list = cxx::list<std::string> { "a", "d" };
+
+    list.splice(list.begin(),   cxx::list<std::string> {           });
+    list.splice(list.begin(),   cxx::list<std::string> { "_"       });
+    list.splice(++list.begin(), cxx::list<std::string> { "0", "1"  });
+    list.splice(list.end(),     cxx::list<std::string> { "e"       });
+
+    auto other = cxx::list<std::string> { "b", "c" };
+
+    auto position = list.begin();
+    ++position; ++position; ++position; ++position;
+
+    list.splice(position, other);
+
+    REQUIRE(other.empty());
+    REQUIRE(list.size() == 8);
+    REQUIRE(list == cxx::list<std::string> { "_", "0", "1", "a", "b", "c", "d", "e" });
+
+    other.push_back("f");
+    list .push_back("g");
+
+    REQUIRE(other == cxx::list<std::string> { "f" });
+    REQUIRE(list.back() == "g");
+}
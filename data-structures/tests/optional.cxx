@@ -37,21 +37,27 @@
 
 #include <catch2/catch.hpp>
 
+#include <cstdint>
+
+#include <string>
+
+#include <type_traits>
+
 
 namespace
 {
     namespace check
     {
-        template <typename value_type>
-        auto empty (const cxx::optional<value_type>& optional) -> void
+        template <typename value_type, typename niche_type>
+        auto empty (const cxx::optional<value_type, niche_type>& optional) -> void
         {
             REQUIRE(!optional.has_value());
             REQUIRE(!optional);
         }
 
-        template <typename value_type>
-        auto owns (const cxx::optional<value_type>& optional,
-                   const               value_type &    value) -> void
+        template <typename value_type, typename niche_type>
+        auto owns (const cxx::optional<value_type, niche_type>& optional,
+                   const               value_type             &    value) -> void
         {
             REQUIRE(optional.has_value());
             REQUIRE(optional);
@@ -89,6 +95,8 @@ namespace
             constexpr auto method () noexcept -> void
             { }
         };
+
+        using index = cxx::optional<std::uint32_t, cxx::sentinel_niche<std::uint32_t, ~std::uint32_t { 0 }>>;
     }
 }
 
@@ -153,3 +161,85 @@ TEST_CASE ("[optional] idiomatic usage")
     check::empty(optional);
 }
 
+
+
+TEST_CASE ("[optional] niches encode emptiness")
+{
+    static_assert(sizeof(cxx::optional<std::uint32_t>) == 2 * sizeof(std::uint32_t));
+    static_assert(sizeof(cxx::optional<bool>)          == sizeof(bool));
+    static_assert(sizeof(cxx::optional<int*>)          == sizeof(int*));
+    static_assert(sizeof(test::index)                  == sizeof(std::uint32_t));
+
+    static_assert(sizeof(cxx::optional<cxx::optional<bool>>) == sizeof(bool));
+    static_assert(sizeof(cxx::optional<cxx::optional<int>>)  == 2 * sizeof(int));
+
+    auto flag = cxx::optional<bool> { };
+    check::empty(flag);
+
+    flag.emplace(false);
+    check::owns(flag, false);
+
+    flag.emplace(true);
+    check::owns(flag, true);
+
+    auto value   = 7;
+    auto pointer = cxx::optional<int*> { };
+    check::empty(pointer);
+
+    pointer.emplace(nullptr);
+    check::owns(pointer, static_cast<int*>(nullptr));
+
+    pointer.emplace(&value);
+    check::owns(pointer, &value);
+
+    auto index = test::index { };
+    check::empty(index);
+
+    index.emplace(0u);
+    check::owns(index, 0u);
+
+    index.emplace(~std::uint32_t { 0 } - 1);
+    check::owns(index, ~std::uint32_t { 0 } - 1);
+
+    auto nested = cxx::optional<cxx::optional<bool>> { };
+    check::empty(nested);
+
+    nested.emplace();
+    REQUIRE(nested.has_value());
+    check::empty(nested.value());
+
+    nested.emplace(cxx::make_optional<bool>(true));
+    check::owns(nested.value(), true);
+}
+
+
+TEST_CASE ("[optional] trivial special member functions")
+{
+    static_assert(std::is_trivially_copyable_v   <cxx::optional<int>>);
+    static_assert(std::is_trivially_destructible_v<cxx::optional<int>>);
+    static_assert(std::is_trivially_copyable_v   <test::index>);
+
+    static_assert(!std::is_trivially_copy_constructible_v<cxx::optional<std::string>>);
+    static_assert(!std::is_trivially_destructible_v      <cxx::optional<std::string>>);
+
+    auto text = cxx::make_optional<std::string>("text");
+
+    auto copy = text;
+    check::owns(copy, std::string { "text" });
+
+    auto moved = std::move(copy);
+    check::owns(moved, std::string { "text" });
+    check::empty(copy);
+
+    copy = moved;
+    check::owns(copy, std::string { "text" });
+
+    auto index = test::index { };
+    index.emplace(5u);
+
+    auto index_copy = index;
+    check::owns(index_copy, 5u);
+
+    index_copy = cxx::nullopt;
+    check::empty(index_copy);
+}
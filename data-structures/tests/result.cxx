@@ -37,6 +37,12 @@
 
 #include <catch2/catch.hpp>
 
+#include <cstdint>
+
+#include <string>
+
+#include <type_traits>
+
 
 namespace
 {
@@ -95,3 +101,36 @@ TEST_CASE ("[result] error path")
 
     REQUIRE(result.error() == cxx::error { });
 }
+
+
+TEST_CASE ("[result] layout")
+{
+    static_assert(sizeof(cxx::result<bool>)  == sizeof(bool));
+    static_assert(sizeof(cxx::result<int*>)  == sizeof(int*));
+    static_assert(sizeof(cxx::result<float>) == 2 * sizeof(float));
+
+    static_assert(std::is_trivially_copyable_v   <cxx::result<int>>);
+    static_assert(std::is_trivially_destructible_v<cxx::result<int>>);
+
+    static_assert(!std::is_trivially_copyable_v<cxx::result<std::string>>);
+
+    const auto success = cxx::result<bool> { false };
+
+    if (success) { SUCCEED(); } else { FAIL(); }
+
+    REQUIRE(success.value() == false);
+
+    const auto failure = cxx::result<bool> { cxx::error { } };
+
+    if (failure) { FAIL(); } else { SUCCEED(); }
+}
+
+
+TEST_CASE ("[result] non-trivial value")
+{
+    const auto result = cxx::result<std::string> { std::string { "text" } };
+
+    const auto copy = result;
+
+    REQUIRE(copy.value() == "text");
+}
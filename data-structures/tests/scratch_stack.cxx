@@ -0,0 +1,213 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <cxx/scratch_stack.hxx>
+
+#include <cxx/arena.hxx>
+#include <cxx/vector.hxx>
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <new>
+#include <thread>
+
+
+namespace
+{
+    [[nodiscard]]
+    auto is_aligned (const void* const pointer, const std::size_t alignment) -> bool
+    {
+        return reinterpret_cast<std::uintptr_t>(pointer) % alignment == 0;
+    }
+
+    constexpr auto kibibyte = std::size_t { 1024 };
+    constexpr auto mebibyte = std::size_t { 1024 } * kibibyte;
+}
+
+
+TEST_CASE ("[scratch_stack] allocations are bumped and aligned")
+{
+    auto stack = cxx::scratch_stack { 16 * mebibyte };
+
+    REQUIRE(stack.used()            == 0);
+    REQUIRE(stack.committed_bytes() == 0);
+    REQUIRE(stack.reserved_bytes()  == 16 * mebibyte);
+
+    const auto first  = static_cast<std::byte*>(stack.allocate(3, 1));
+    const auto second = static_cast<std::byte*>(stack.allocate(8, 8));
+    const auto third  = static_cast<std::byte*>(stack.allocate(1, 64));
+
+    REQUIRE(second == first + 8);
+    REQUIRE(is_aligned(second, 8));
+    REQUIRE(is_aligned(third, 64));
+    REQUIRE(stack.used() == static_cast<std::size_t>(third + 1 - first));
+
+    *first = std::byte { 1 };
+    *third = std::byte { 3 };
+}
+
+
+TEST_CASE ("[scratch_stack] markers rewind in LIFO order")
+{
+    auto stack = cxx::scratch_stack { 16 * mebibyte };
+
+    static_cast<void>(stack.allocate(100));
+    const auto base_usage = stack.used();
+
+    {
+        const auto outer = stack.mark();
+
+        const auto outer_memory = stack.allocate(1000);
+
+        {
+            const auto inner = stack.mark();
+
+            static_cast<void>(stack.allocate(5000));
+            REQUIRE(stack.used() > base_usage + 6000);
+        }
+
+        REQUIRE(stack.used() < base_usage + 1100);
+
+        const auto reused = stack.allocate(16);
+        REQUIRE(reused == static_cast<std::byte*>(outer_memory) + 1008);
+    }
+
+    REQUIRE(stack.used() == base_usage);
+}
+
+
+TEST_CASE ("[scratch_stack] memory is committed lazily")
+{
+    auto stack = cxx::scratch_stack { 64 * mebibyte };
+
+    {
+        const auto marker = stack.mark();
+
+        static_cast<void>(stack.allocate(100));
+        REQUIRE(stack.committed_bytes() ==  64 * kibibyte);
+
+        const auto array = stack.allocate_array<std::uint32_t>(mebibyte);
+        REQUIRE(std::all_of(array.begin(), array.end(), [] (const auto value) { return value == 0; }));
+
+        std::fill(array.begin(), array.end(), 7u);
+
+        REQUIRE(stack.committed_bytes() >= 4 * mebibyte);
+        REQUIRE(stack.committed_bytes() <  4 * mebibyte + 128 * kibibyte);
+    }
+
+    REQUIRE(stack.used()            == 0);
+    REQUIRE(stack.committed_bytes() >= 4 * mebibyte);
+
+    stack.trim();
+    REQUIRE(stack.committed_bytes() == 0);
+}
+
+
+TEST_CASE ("[scratch_stack] exceeding the reservation throws")
+{
+    auto stack = cxx::scratch_stack { mebibyte };
+
+    static_cast<void>(stack.allocate(mebibyte - 64));
+
+    REQUIRE_THROWS_AS(stack.allocate(128), std::bad_alloc);
+    REQUIRE_NOTHROW  (stack.allocate( 64, 1));
+}
+
+
+#if !defined(NDEBUG) && !defined(__SANITIZE_ADDRESS__)
+
+TEST_CASE ("[scratch_stack] freed memory is poisoned in debug builds")
+{
+    auto stack = cxx::scratch_stack { mebibyte };
+
+    auto memory = static_cast<std::byte*>(nullptr);
+    {
+        const auto marker = stack.mark();
+
+        memory = static_cast<std::byte*>(stack.allocate(32));
+        std::fill(memory, memory + 32, std::byte { 0 });
+    }
+
+    REQUIRE(std::all_of(memory, memory + 32, [] (const auto byte) { return byte == std::byte { 0xDD }; }));
+}
+
+#endif
+
+
+TEST_CASE ("[scratch_stack] containers allocating from a scratch stack")
+{
+    auto& stack = cxx::scratch_stack::local();
+
+    const auto marker = stack.mark();
+
+    using allocator_type = cxx::arena_allocator<int, cxx::scratch_stack>;
+
+    auto vector = cxx::vector<int, allocator_type> { allocator_type { stack } };
+
+    for (auto n = 0; n != 1000; ++n)
+    {
+        vector.push_back(n);
+    }
+
+    REQUIRE(vector.size() == 1000);
+    REQUIRE(vector[999]   ==  999);
+}
+
+
+TEST_CASE ("[scratch_stack] every thread has its own scratch stack")
+{
+    const auto main_stack = &cxx::scratch_stack::local();
+
+    auto thread_stack = static_cast<cxx::scratch_stack*>(nullptr);
+
+    auto thread = std::thread
+    {
+        [&thread_stack]
+        {
+            thread_stack = &cxx::scratch_stack::local();
+
+            const auto marker = thread_stack->mark();
+            static_cast<void>(thread_stack->allocate(1024));
+        }
+    };
+
+    thread.join();
+
+    REQUIRE(thread_stack != nullptr);
+    REQUIRE(thread_stack != main_stack);
+    REQUIRE(main_stack   == &cxx::scratch_stack::local());
+}
@@ -35,8 +35,12 @@
 
 #include <cxx/shared.hxx>
 
+#include <cxx/slab_allocator.hxx>
+
 #include <catch2/catch.hpp>
 
+#include <memory>
+
 #include <chrono>
 
 #include <random>
@@ -468,3 +472,236 @@ TEST_CASE ("[shared] indirect access, const shared handle to const value")
     const
     auto value_handle = check::create_handle<const test::value<char>>('^');
 }
+
+
+TEST_CASE ("[shared] make() creates a single shared handle")
+{
+    auto is_alive = false;
+    {
+        [[maybe_unused]]
+        const auto shared_handle = cxx::shared<test::lifetime>::make(is_alive);
+
+        REQUIRE(is_alive);
+    }
+    REQUIRE(!is_alive);
+
+    const auto value_handle = cxx::shared<test::object>::make('#', 0.4f, true);
+
+    REQUIRE(*value_handle == test::object { '#', 0.4f, true });
+}
+
+
+TEST_CASE ("[shared] local reference counting")
+{
+    auto is_alive = false;
+
+    auto shared_handles = cxx::shared<test::lifetime, cxx::local_ref_count>
+                             ::bulk_create<3>(is_alive);
+
+    for (auto& shared_handle : shared_handles)
+    {
+        REQUIRE(is_alive);
+
+        auto to_be_destroyed = std::move(shared_handle);
+    }
+
+    REQUIRE(!is_alive);
+
+    static_assert(!cxx::ref_count_policy<int>);
+    static_assert( cxx::ref_count_policy<cxx:: local_ref_count>);
+    static_assert( cxx::ref_count_policy<cxx::atomic_ref_count>);
+}
+
+
+namespace
+{
+    namespace test
+    {
+        struct allocation_counter
+        {
+            int allocations   = 0;
+            int deallocations = 0;
+        };
+
+        template <typename type>
+        struct counting_allocator
+        {
+            using value_type = type;
+
+            allocation_counter* counter;
+
+            explicit counting_allocator (allocation_counter& counter) noexcept
+            :
+                counter { &counter }
+            { }
+
+            template <typename other>
+            counting_allocator (const counting_allocator<other>& allocator) noexcept
+            :
+                counter { allocator.counter }
+            { }
+
+            auto allocate (const std::size_t count) -> type*
+            {
+                ++counter->allocations;
+
+                return std::allocator<type> { }.allocate(count);
+            }
+
+            auto deallocate (type* const pointer, const std::size_t count) noexcept -> void
+            {
+                ++counter->deallocations;
+
+                std::allocator<type> { }.deallocate(pointer, count);
+            }
+
+            template <typename other>
+            auto operator == (const counting_allocator<other>& allocator) const noexcept -> bool
+            {
+                return counter == allocator.counter;
+            }
+        };
+    }
+}
+
+
+TEST_CASE ("[shared] value and reference counts are allocated together")
+{
+    auto counter  = test::allocation_counter { };
+    auto is_alive = false;
+    {
+        const auto [first_handle, second_handle] = cxx::shared<test::lifetime>
+                                                      ::bulk_create<2>(std::allocator_arg,
+                                                                       test::counting_allocator<int> { counter },
+                                                                       is_alive);
+        REQUIRE(is_alive);
+        REQUIRE(counter.allocations   == 1);
+        REQUIRE(counter.deallocations == 0);
+
+        const auto value_handle = cxx::shared<test::object, cxx::local_ref_count>
+                                     ::make(std::allocator_arg,
+                                            test::counting_allocator<char> { counter },
+                                            '!', 0.1f, false);
+
+        REQUIRE(*value_handle == test::object { '!', 0.1f, false });
+        REQUIRE(counter.allocations == 2);
+    }
+    REQUIRE(!is_alive);
+    REQUIRE(counter.deallocations == 2);
+
+    const auto slab_handle = cxx::shared<test::object>
+                                ::make(std::allocator_arg, cxx::slab_allocator<test::object> { },
+                                       '@', 0.2f, true);
+
+    REQUIRE(*slab_handle == test::object { '@', 0.2f, true });
+}
+
+
+TEST_CASE ("[shared] weak handle does not keep value alive")
+{
+    auto counter  = test::allocation_counter { };
+    auto is_alive = false;
+
+    auto [shared_handle] = cxx::shared<test::lifetime>
+                              ::bulk_create<1>(std::allocator_arg,
+                                               test::counting_allocator<int> { counter },
+                                               is_alive);
+    const auto weak_handle = cxx::weak { shared_handle };
+    const auto weak_copy   = weak_handle;
+
+    REQUIRE(!weak_handle.expired());
+    REQUIRE(weak_handle == weak_copy);
+
+    auto visited = false;
+
+    REQUIRE(weak_handle.visit([&visited] (test::lifetime&) { visited = true; }));
+    REQUIRE(visited);
+    REQUIRE(is_alive);
+
+    {
+        [[maybe_unused]]
+        auto to_be_destroyed = std::move(shared_handle);
+    }
+
+    REQUIRE(!is_alive);
+    REQUIRE( weak_handle.expired());
+    REQUIRE(!weak_copy  .visit([] (test::lifetime&) { FAIL(); }));
+
+    // note: The memory is deallocated only along with the last weak handle.
+    //
+    REQUIRE(counter.deallocations == 0);
+}
+
+
+TEST_CASE ("[shared] weak handle releases memory")
+{
+    auto counter  = test::allocation_counter { };
+    auto is_alive = false;
+    {
+        auto weak_handle = std::unique_ptr<cxx::weak<test::lifetime, cxx::local_ref_count>> { };
+        {
+            const auto shared_handle = cxx::shared<test::lifetime, cxx::local_ref_count>
+                                          ::make(std::allocator_arg,
+                                                 test::counting_allocator<int> { counter },
+                                                 is_alive);
+
+            weak_handle = std::make_unique<cxx::weak<test::lifetime, cxx::local_ref_count>>(shared_handle);
+        }
+        REQUIRE(!is_alive);
+        REQUIRE(counter.deallocations == 0);
+    }
+    REQUIRE(counter.allocations   == 1);
+    REQUIRE(counter.deallocations == 1);
+}
+
+
+TEST_CASE ("[shared] weak handle visiting is thread-safe")
+{
+    auto is_alive = false;
+
+    auto shared_handles = cxx::shared<test::lifetime>
+                             ::bulk_create<2>(is_alive);
+
+    const auto weak_handle = cxx::weak { shared_handles[0] };
+
+    {
+        const auto threads = std::array
+        {
+            std::jthread
+            {
+                [&shared_handles] (const std::size_t thread_index)
+                {
+                    test::random_delay();
+
+                    auto to_be_destroyed = std::move(shared_handles[thread_index]);
+                },
+                0
+            },
+            std::jthread
+            {
+                [&shared_handles] (const std::size_t thread_index)
+                {
+                    test::random_delay();
+
+                    auto to_be_destroyed = std::move(shared_handles[thread_index]);
+                },
+                1
+            },
+            std::jthread
+            {
+                [weak_handle, &is_alive]
+                {
+                    for (auto visit = 0; visit != 1000; ++visit)
+                    {
+                        weak_handle.visit([&is_alive] (test::lifetime&)
+                                          {
+                                              REQUIRE(is_alive);
+                                          });
+                    }
+                }
+            },
+        };
+    }
+    REQUIRE(!is_alive);
+    REQUIRE(weak_handle.expired());
+}
@@ -0,0 +1,299 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <cxx/slab_allocator.hxx>
+
+#include <cxx/list.hxx>
+#include <cxx/unique_ptr.hxx>
+#include <cxx/vector.hxx>
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace
+{
+    template <std::size_t size>
+    struct object
+    {
+        std::array<std::byte, size> bytes;
+    };
+
+    [[nodiscard]]
+    auto is_aligned (const void* const pointer, const std::size_t alignment) -> bool
+    {
+        return reinterpret_cast<std::uintptr_t>(pointer) % alignment == 0;
+    }
+}
+
+
+TEST_CASE ("[slab_allocator] size classes")
+{
+    REQUIRE(cxx::slab_size_class(   0) ==  0);
+    REQUIRE(cxx::slab_size_class(   1) ==  0);
+    REQUIRE(cxx::slab_size_class(  16) ==  0);
+    REQUIRE(cxx::slab_size_class(  17) ==  1);
+    REQUIRE(cxx::slab_size_class( 128) ==  7);
+    REQUIRE(cxx::slab_size_class( 129) ==  8);
+    REQUIRE(cxx::slab_size_class( 160) ==  8);
+    REQUIRE(cxx::slab_size_class( 161) ==  9);
+    REQUIRE(cxx::slab_size_class(4096) == cxx::slab_class_count - 1);
+
+    REQUIRE(cxx::slab_class_size(0)                           ==   16);
+    REQUIRE(cxx::slab_class_size(8)                           ==  160);
+    REQUIRE(cxx::slab_class_size(11)                          ==  256);
+    REQUIRE(cxx::slab_class_size(cxx::slab_class_count - 1)   == 4096);
+
+    for (auto bytes = std::size_t { 1 }; bytes <= cxx::slab_max_size; ++bytes)
+    {
+        const auto size_class = cxx::slab_size_class(bytes);
+        const auto class_size = cxx::slab_class_size(size_class);
+
+        REQUIRE(class_size >= bytes);
+        REQUIRE(class_size % cxx::slab_alignment == 0);
+        REQUIRE(class_size - bytes < std::max<std::size_t>(16, bytes / 4));
+
+        if (size_class != 0)
+        {
+            REQUIRE(cxx::slab_class_size(size_class - 1) < bytes);
+        }
+    }
+}
+
+
+TEST_CASE ("[slab_allocator] allocate and deallocate")
+{
+    auto allocator = cxx::slab_allocator<object<48>> { };
+
+    auto pointers = std::vector<object<48>*> { };
+
+    for (auto count = 0; count != 1000; ++count)
+    {
+        const auto pointer = allocator.allocate(1);
+
+        REQUIRE(is_aligned(pointer, cxx::slab_alignment));
+
+        pointer->bytes.fill(std::byte (count));
+
+        pointers.push_back(pointer);
+    }
+
+    REQUIRE(std::set(pointers.begin(), pointers.end()).size() == pointers.size());
+
+    for (auto count = 0; count != 1000; ++count)
+    {
+        REQUIRE(pointers[count]->bytes.front() == std::byte (count));
+        REQUIRE(pointers[count]->bytes.back () == std::byte (count));
+    }
+
+    for (const auto pointer : pointers)
+    {
+        allocator.deallocate(pointer, 1);
+    }
+}
+
+
+TEST_CASE ("[slab_allocator] freed objects are reused")
+{
+    auto allocator = cxx::slab_allocator<object<32>> { };
+
+    const auto first = allocator.allocate(1);
+    allocator.deallocate(first, 1);
+
+    const auto second = allocator.allocate(1);
+    REQUIRE(second == first);
+
+    allocator.deallocate(second, 1);
+}
+
+
+TEST_CASE ("[slab_allocator] arrays and large objects")
+{
+    auto small = cxx::slab_allocator<std::uint32_t> { };
+
+    const auto array = small.allocate(100);
+    std::fill(array, array + 100, std::uint32_t { 0xCAFE });
+    REQUIRE(array[99] == 0xCAFE);
+    small.deallocate(array, 100);
+
+    auto large = cxx::slab_allocator<object<8192>> { };
+
+    const auto pointer = large.allocate(1);
+    pointer->bytes.fill(std::byte { 0xAB });
+    large.deallocate(pointer, 1);
+
+    struct alignas(64) over_aligned
+    {
+        std::uint8_t byte;
+    };
+
+    auto aligned = cxx::slab_allocator<over_aligned> { };
+
+    const auto over_aligned_pointer = aligned.allocate(1);
+    REQUIRE(is_aligned(over_aligned_pointer, 64));
+    aligned.deallocate(over_aligned_pointer, 1);
+}
+
+
+TEST_CASE ("[slab_allocator] rebinding and equality")
+{
+    const auto int_allocator  = cxx::slab_allocator<int>    { };
+    const auto char_allocator = cxx::slab_allocator<char> { int_allocator };
+
+    REQUIRE(int_allocator == char_allocator);
+    REQUIRE(!(int_allocator != char_allocator));
+}
+
+
+TEST_CASE ("[slab_allocator] containers allocating from slabs")
+{
+    auto list = cxx::list<std::string, cxx::slab_allocator<std::string>> { };
+
+    for (auto count = 0; count != 500; ++count)
+    {
+        list.push_back(std::to_string(count));
+    }
+
+    REQUIRE(list.size()  == 500);
+    REQUIRE(list.front() == "0");
+    REQUIRE(list.back()  == "499");
+
+    auto vector = cxx::vector<int, cxx::slab_allocator<int>> { };
+
+    for (auto count = 0; count != 2000; ++count)
+    {
+        vector.push_back(count);
+    }
+
+    REQUIRE(vector.size() == 2000);
+    REQUIRE(vector[1999]  == 1999);
+
+    const auto unique_ptr = cxx::allocate_unique<std::string>(cxx::slab_allocator<char> { }, "slab");
+
+    REQUIRE(*unique_ptr == "slab");
+}
+
+
+TEST_CASE ("[slab_allocator] objects freed on another thread")
+{
+    constexpr auto object_count = 10'000;
+
+    auto allocator = cxx::slab_allocator<object<64>> { };
+
+    auto pointers = std::vector<object<64>*> { };
+
+    for (auto count = 0; count != object_count; ++count)
+    {
+        pointers.push_back(allocator.allocate(1));
+    }
+
+    auto consumer = std::thread
+    {
+        [&pointers]
+        {
+            auto allocator = cxx::slab_allocator<object<64>> { };
+
+            for (const auto pointer : pointers)
+            {
+                allocator.deallocate(pointer, 1);
+            }
+        }
+    };
+
+    consumer.join();
+
+    // note: The consumer has returned its magazines to the depot,
+    //       while exiting, so the objects it freed are reused,
+    //       once the magazine loaded by this thread runs empty.
+    //
+    const auto freed = std::set(pointers.begin(), pointers.end());
+
+    auto reused = 0;
+
+    for (auto& pointer : pointers)
+    {
+        pointer = allocator.allocate(1);
+
+        reused += freed.contains(pointer) ? 1 : 0;
+    }
+
+    REQUIRE(reused >= object_count - 2 * 64);
+
+    for (const auto pointer : pointers)
+    {
+        allocator.deallocate(pointer, 1);
+    }
+}
+
+
+TEST_CASE ("[slab_allocator] concurrent churn")
+{
+    constexpr auto thread_count = 4;
+
+    auto threads = std::vector<std::thread> { };
+
+    for (auto thread = 0; thread != thread_count; ++thread)
+    {
+        threads.emplace_back([thread]
+        {
+            auto list = cxx::list<int, cxx::slab_allocator<int>> { };
+
+            for (auto round = 0; round != 100; ++round)
+            {
+                for (auto count = 0; count != 1000; ++count)
+                {
+                    list.push_back(thread * count);
+                }
+
+                while (list.size() > 10)
+                {
+                    list.pop_front();
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
@@ -35,8 +35,12 @@
 
 #include <cxx/unique_ptr.hxx>
 
+#include <cxx/allocator.hxx>
+
 #include <catch2/catch.hpp>
 
+#include <string>
+
 
 namespace
 {
@@ -283,3 +287,35 @@ TEST_CASE ("[unique_ptr] reset to raw pointer")
     unique_ptr.reset(new float { 1.1f });
     check::owns(unique_ptr, 1.1f);
 }
+
+
+TEST_CASE ("[unique_ptr] allocate_unique() function")
+{
+    auto destructor_called = false;
+
+    struct object
+    {
+        bool& destructor_called;
+
+        ~object () noexcept
+        {
+            destructor_called = true;
+        }
+    };
+
+    {
+        const auto unique_ptr = cxx::allocate_unique<object>(cxx::allocator<char> { },
+                                                             destructor_called);
+        REQUIRE(unique_ptr != nullptr);
+        REQUIRE(!destructor_called);
+
+        static_assert(sizeof(unique_ptr) == sizeof(object*));
+    }
+    REQUIRE(destructor_called);
+
+    auto string = cxx::allocate_unique<std::string>(cxx::allocator<std::string> { }, 3, 'x');
+    REQUIRE(*string == "xxx");
+
+    string = nullptr;
+    REQUIRE(string == nullptr);
+}
@@ -0,0 +1,234 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <cxx/unrolled_list.hxx>
+
+#include <catch2/catch.hpp>
+
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+    template <typename value_type, std::size_t per_node>
+    auto to_vector (const cxx::unrolled_list<value_type, per_node>& list) -> std::vector<value_type>
+    {
+        auto result = std::vector<value_type> { };
+
+        for (const auto& element : list)
+        {
+            result.push_back(element);
+        }
+
+        return result;
+    }
+}
+
+
+TEST_CASE ("[unrolled_list] default constructor")
+{
+    auto list = cxx::unrolled_list<int> { };
+
+    REQUIRE(list.empty());
+    REQUIRE(list.size() == 0);
+
+    REQUIRE(list. begin() == list. end());
+    REQUIRE(list.cbegin() == list.cend());
+}
+
+
+TEST_CASE ("[unrolled_list] std::initializer_list<> constructor")
+{
+    const auto list = cxx::unrolled_list<int, 4> { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+    REQUIRE(list.size () == 9);
+    REQUIRE(list.front() == 1);
+    REQUIRE(list.back () == 9);
+
+    REQUIRE(to_vector(list) == std::vector<int> { 1, 2, 3, 4, 5, 6, 7, 8, 9 });
+}
+
+
+TEST_CASE ("[unrolled_list] bidirectional iteration")
+{
+    auto list = cxx::unrolled_list<int, 3> { 1, 2, 3, 4, 5, 6, 7 };
+
+    auto reversed = std::vector<int> { };
+
+    for (auto it = list.end(); it != list.begin(); )
+    {
+        reversed.push_back(*--it);
+    }
+
+    REQUIRE(reversed == std::vector<int> { 7, 6, 5, 4, 3, 2, 1 });
+
+    auto sum = 0;
+
+    list.for_each([&sum] (const int value) { sum += value; });
+
+    REQUIRE(sum == 28);
+}
+
+
+TEST_CASE ("[unrolled_list] push & pop")
+{
+    auto list = cxx::unrolled_list<std::string, 2> { };
+
+    list.push_back ("c");
+    list.push_front("b");
+    list.push_front("a");
+    list.push_back ("d");
+    list.push_back ("e");
+
+    REQUIRE(to_vector(list) == std::vector<std::string> { "a", "b", "c", "d", "e" });
+
+    list.pop_front();
+    list.pop_back ();
+
+    REQUIRE(to_vector(list) == std::vector<std::string> { "b", "c", "d" });
+
+    list.pop_back ();
+    list.pop_back ();
+    list.pop_front();
+
+    REQUIRE(list.empty());
+    REQUIRE(list.begin() == list.end());
+}
+
+
+TEST_CASE ("[unrolled_list] insert into a full node")
+{
+    auto list = cxx::unrolled_list<std::string, 4> { "0", "1", "2", "3" };
+
+    auto it = list.begin();
+    ++it; ++it; ++it;
+
+    it = list.insert(it, "x");
+
+    REQUIRE(*it == "x");
+    REQUIRE(*++it == "3");
+
+    list.insert(list.begin(), list.back());
+
+    REQUIRE(to_vector(list) == std::vector<std::string> { "3", "0", "1", "2", "x", "3" });
+}
+
+
+TEST_CASE ("[unrolled_list] erase")
+{
+    auto list = cxx::unrolled_list<int, 4> { };
+
+    for (auto n = 0; n != 20; ++n)
+    {
+        list.push_back(n);
+    }
+
+    auto it = list.begin();
+
+    while (it != list.end())
+    {
+        it = (*it % 3 != 0) ? list.erase(it) : ++it;
+    }
+
+    REQUIRE(to_vector(list) == std::vector<int> { 0, 3, 6, 9, 12, 15, 18 });
+
+    while (!list.empty())
+    {
+        list.erase(list.begin());
+    }
+
+    REQUIRE(list.begin() == list.end());
+}
+
+
+TEST_CASE ("[unrolled_list] random insertions and erasures")
+{
+    auto engine = std::mt19937 { 7 };
+
+    auto list      = cxx::unrolled_list<int, 8> { };
+    auto reference = std::list<int> { };
+
+    for (auto n = 0; n != 2'000; ++n)
+    {
+        const auto offset = std::uniform_int_distribution<std::size_t> { 0, reference.size() } (engine);
+
+        auto list_it      = list.begin();
+        auto reference_it = reference.begin();
+
+        for (auto step = std::size_t { 0 }; step != offset; ++step)
+        {
+            ++list_it;
+            ++reference_it;
+        }
+
+        if ((n % 3 == 2) && (reference_it != reference.end()))
+        {
+            list_it      = list     .erase(list_it);
+            reference_it = reference.erase(reference_it);
+
+            REQUIRE((list_it == list.end()) == (reference_it == reference.end()));
+        }
+        else
+        {
+            REQUIRE(*list.insert(list_it, n) == *reference.insert(reference_it, n));
+        }
+    }
+
+    REQUIRE(list.size() == reference.size());
+    REQUIRE(to_vector(list) == std::vector<int> (reference.begin(), reference.end()));
+}
+
+
+TEST_CASE ("[unrolled_list] copy & move")
+{
+    const auto list = cxx::unrolled_list<std::string, 2> { "a", "b", "c" };
+
+    auto copy  = list;
+    auto moved = std::move(copy);
+
+    REQUIRE(copy.empty());
+    REQUIRE(moved == list);
+
+    copy = moved;
+
+    REQUIRE(copy == list);
+
+    copy.push_back("d");
+
+    REQUIRE(copy != list);
+}
@@ -0,0 +1,273 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2026, Mateusz Zych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <cxx/variant.hxx>
+
+#include <catch2/catch.hpp>
+
+#include <array>
+
+#include <string>
+
+#include <type_traits>
+
+
+namespace
+{
+    namespace test
+    {
+        struct lifetime
+        {
+            int* destroyed;
+
+            explicit lifetime (int& destroyed) noexcept
+            :
+                destroyed { &destroyed }
+            { }
+
+            lifetime (const lifetime&) = default;
+
+            lifetime (lifetime&& other) noexcept
+            :
+                destroyed { std::exchange(other.destroyed, nullptr) }
+            { }
+
+            ~lifetime ()
+            {
+                if (destroyed != nullptr)
+                {
+                    ++*destroyed;
+                }
+            }
+        };
+
+        struct name_of
+        {
+            auto operator () (int)                const -> std::string { return "int";    }
+            auto operator () (double)             const -> std::string { return "double"; }
+            auto operator () (const std::string&) const -> std::string { return "string"; }
+        };
+    }
+}
+
+
+TEST_CASE ("[variant] construction")
+{
+    const auto default_constructed = cxx::variant<int, std::string> { };
+
+    REQUIRE(default_constructed.index() == 0);
+    REQUIRE(cxx::get<0>(default_constructed) == 0);
+
+    const auto converted = cxx::variant<int, std::string> { std::string { "text" } };
+
+    REQUIRE(converted.index() == 1);
+    REQUIRE(cxx::get<std::string>(converted) == "text");
+    REQUIRE(cxx::holds_alternative<std::string>(converted));
+
+    const auto in_place = cxx::variant<int, std::string> { std::in_place_index<1>, 3u, 'x' };
+
+    REQUIRE(cxx::get<1>(in_place) == "xxx");
+
+    REQUIRE(cxx::get_if<0>(&in_place) == nullptr);
+    REQUIRE(cxx::get_if<1>(&in_place) != nullptr);
+}
+
+
+TEST_CASE ("[variant] copy, move and assignment")
+{
+    auto variant = cxx::variant<int, std::string> { 7 };
+
+    variant = std::string { "text" };
+
+    REQUIRE(cxx::get<std::string>(variant) == "text");
+
+    auto copy = variant;
+
+    REQUIRE(copy == variant);
+
+    auto moved = std::move(copy);
+
+    REQUIRE(cxx::get<std::string>(moved) == "text");
+
+    moved.emplace<int>(5);
+
+    REQUIRE(moved.index() == 0);
+    REQUIRE(moved != variant);
+
+    variant = moved;
+
+    REQUIRE(cxx::get<int>(variant) == 5);
+}
+
+
+TEST_CASE ("[variant] alternatives are destroyed")
+{
+    auto destroyed = 0;
+
+    {
+        auto variant = cxx::variant<int, test::lifetime> { test::lifetime { destroyed } };
+
+        REQUIRE(destroyed == 0);
+
+        variant = 7;
+
+        REQUIRE(destroyed == 1);
+
+        variant.emplace<test::lifetime>(destroyed);
+    }
+
+    REQUIRE(destroyed == 2);
+}
+
+
+TEST_CASE ("[variant] visit")
+{
+    const auto variants = std::array
+    {
+        cxx::variant<int, double, std::string> { 1                     },
+        cxx::variant<int, double, std::string> { 2.0                   },
+        cxx::variant<int, double, std::string> { std::string { "three" } },
+    };
+
+    REQUIRE(cxx::visit(test::name_of { }, variants[0]) == "int");
+    REQUIRE(cxx::visit(test::name_of { }, variants[1]) == "double");
+    REQUIRE(cxx::visit(test::name_of { }, variants[2]) == "string");
+
+    auto variant = cxx::variant<int, std::string> { 20 };
+
+    cxx::visit([] (auto& value) { value += value; }, variant);
+
+    REQUIRE(cxx::get<int>(variant) == 40);
+}
+
+
+TEST_CASE ("[variant] visit multiple variants")
+{
+    const auto lhs = cxx::variant<int, double> { 2.5 };
+
+    for (const auto& rhs : { cxx::variant<char, int, double> { 'a' },
+                             cxx::variant<char, int, double> { 3   },
+                             cxx::variant<char, int, double> { 0.5 } })
+    {
+        const auto sum = cxx::visit
+        (
+            [] (auto lhs, auto rhs) -> double { return lhs + rhs; },
+            lhs, rhs
+        );
+
+        const auto expected = cxx::visit([] (auto rhs) -> double { return 2.5 + rhs; }, rhs);
+
+        REQUIRE(sum == expected);
+    }
+
+    const auto text = cxx::visit
+    (
+        [] (int, double, const std::string& text) { return text; },
+        cxx::variant<int, double> { 1 },
+        cxx::variant<int, double> { 1.0 },
+        cxx::variant<std::string> { std::string { "abc" } }
+    );
+
+    REQUIRE(text == "abc");
+}
+
+
+TEST_CASE ("[variant] discriminant packing")
+{
+    static_assert(sizeof(cxx::variant<char, bool>)           == 2);
+    static_assert(sizeof(cxx::variant<int, float>)           == 8);
+    static_assert(sizeof(cxx::variant<cxx::monostate, bool>) == 1);
+
+    static_assert(sizeof(cxx::variant<cxx::monostate, cxx::variant<char, bool>>) == 2);
+
+    static_assert(std::is_trivially_copyable_v   <cxx::variant<int, float>>);
+    static_assert(std::is_trivially_destructible_v<cxx::variant<int, float>>);
+
+    static_assert(!std::is_trivially_copyable_v   <cxx::variant<int, std::string>>);
+    static_assert(!std::is_trivially_destructible_v<cxx::variant<int, std::string>>);
+
+    static_assert(cxx::niche_traits<cxx::variant<int, float>>::count == 254);
+    static_assert(cxx::niche_traits<cxx::variant<cxx::monostate, bool>>::count == 253);
+
+    auto flag = cxx::variant<cxx::monostate, bool> { };
+
+    REQUIRE(flag.index() == 0);
+
+    flag = false;
+
+    REQUIRE(flag.index() == 1);
+    REQUIRE(cxx::get<bool>(flag) == false);
+
+    flag = true;
+
+    REQUIRE(cxx::get<bool>(flag) == true);
+
+    flag = cxx::monostate { };
+
+    REQUIRE(flag.index() == 0);
+
+    auto nested = cxx::variant<cxx::monostate, cxx::variant<char, bool>> { };
+
+    REQUIRE(nested.index() == 0);
+
+    nested = cxx::variant<char, bool> { true };
+
+    REQUIRE(nested.index() == 1);
+    REQUIRE(cxx::get<1>(cxx::get<1>(nested)) == true);
+}
+
+
+TEST_CASE ("[variant] niches of bool")
+{
+    using traits = cxx::niche_traits<bool>;
+
+    static_assert(traits::count == 254);
+    static_assert(cxx::has_niche<bool>);
+    static_assert(!cxx::has_niche<int>);
+
+    for (const auto value : { false, true })
+    {
+        REQUIRE(traits::load(&value) == traits::count);
+    }
+
+    unsigned char storage [sizeof(bool)];
+
+    for (auto niche = std::size_t { 0 }; niche < traits::count; ++niche)
+    {
+        traits::store(storage, niche);
+
+        REQUIRE(traits::load(storage) == niche);
+    }
+}
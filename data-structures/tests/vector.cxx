@@ -37,10 +37,310 @@
 
 #include <catch2/catch.hpp>
 
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+    // note: The throwing_value throws an exception from its copy constructor,
+    //       once the global countdown reaches zero.
+    //
+    struct throwing_value
+    {
+        static inline auto countdown = -1;
+
+        int value;
+
+        explicit throwing_value (const int value) noexcept
+        :
+            value { value }
+        {
+        }
+
+        throwing_value (const throwing_value& other)
+        :
+            value { other.value }
+        {
+            if (countdown-- == 0)
+            {
+                throw std::runtime_error { "copy" };
+            }
+        }
+
+        auto operator = (const throwing_value&) -> throwing_value& = default;
+    };
+}
+
 
 TEST_CASE ("[vector] default constructor")
 {
     auto vector = cxx::vector<int> { };
 
     REQUIRE(vector.empty());
+    REQUIRE(vector.capacity() == 0);
+    REQUIRE(vector.data()     == nullptr);
+}
+
+
+TEST_CASE ("[vector] push_back and element access")
+{
+    auto vector = cxx::vector<std::string> { };
+
+    for (auto n = 0; n != 100; ++n)
+    {
+        vector.push_back(std::to_string(n));
+    }
+
+    REQUIRE(vector.size() == 100);
+    REQUIRE(vector.capacity() >= 100);
+
+    REQUIRE(vector.front() ==  "0");
+    REQUIRE(vector[42]     == "42");
+    REQUIRE(vector.back()  == "99");
+
+    vector.pop_back();
+
+    REQUIRE(vector.size() == 99);
+    REQUIRE(vector.back() == "98");
+}
+
+
+TEST_CASE ("[vector] emplace_back an element of the same vector")
+{
+    auto vector = cxx::vector<std::string> { "first" };
+
+    REQUIRE(vector.size() == vector.capacity());
+
+    vector.emplace_back(vector.front());
+
+    REQUIRE(vector == cxx::vector<std::string> { "first", "first" });
+}
+
+
+TEST_CASE ("[vector] growth factor")
+{
+    auto vector = cxx::vector<int, cxx::allocator<int>, cxx::growth_factor<3, 2>> { };
+
+    auto capacities = std::vector<std::size_t> { };
+
+    for (auto n = 0; n != 20; ++n)
+    {
+        if (vector.size() == vector.capacity())
+        {
+            capacities.push_back(vector.capacity());
+        }
+
+        vector.push_back(n);
+    }
+
+    REQUIRE(capacities == std::vector<std::size_t> { 0, 1, 2, 3, 4, 6, 9, 13, 19 });
+}
+
+
+TEST_CASE ("[vector] reserve and shrink_to_fit")
+{
+    auto vector = cxx::vector<int> { 1, 2, 3 };
+
+    vector.reserve(100);
+
+    REQUIRE(vector.capacity() == 100);
+    REQUIRE(vector == cxx::vector<int> { 1, 2, 3 });
+
+    vector.shrink_to_fit();
+
+    REQUIRE(vector.capacity() == 3);
+    REQUIRE(vector == cxx::vector<int> { 1, 2, 3 });
+
+    vector.clear();
+    vector.shrink_to_fit();
+
+    REQUIRE(vector.capacity() == 0);
+}
+
+
+TEST_CASE ("[vector] insert and erase")
+{
+    auto strings = cxx::vector<std::string> { "a", "c" };
+
+    strings.insert(strings.begin() + 1, "b");
+    strings.insert(strings.begin(),     "_");
+    strings.insert(strings.end(),       "d");
+
+    REQUIRE(strings == cxx::vector<std::string> { "_", "a", "b", "c", "d" });
+
+    strings.erase(strings.begin());
+    strings.erase(strings.begin() + 1, strings.begin() + 3);
+
+    REQUIRE(strings == cxx::vector<std::string> { "a", "d" });
+
+    auto integers = cxx::vector<int> { 1, 3 };
+
+    integers.insert(integers.begin() + 1, 2);
+    integers.insert(integers.begin(), integers.back());
+
+    REQUIRE(integers == cxx::vector<int> { 3, 1, 2, 3 });
+
+    integers.erase(integers.begin() + 1, integers.end() - 1);
+
+    REQUIRE(integers == cxx::vector<int> { 3, 3 });
+}
+
+
+TEST_CASE ("[vector] trivially relocatable elements")
+{
+    static_assert( cxx::is_trivially_relocatable_v<int>);
+    static_assert(!cxx::is_trivially_relocatable_v<std::string>);
+    static_assert( cxx::is_trivially_relocatable_v<cxx::vector<std::string>>);
+
+    auto vectors = cxx::vector<cxx::vector<std::string>> { };
+
+    for (auto n = 0; n != 10; ++n)
+    {
+        vectors.emplace_back(static_cast<std::size_t>(n), std::to_string(n));
+    }
+
+    vectors.insert(vectors.begin(), cxx::vector<std::string> { "x" });
+    vectors.erase(vectors.begin() + 1);
+
+    REQUIRE(vectors.size() == 10);
+    REQUIRE(vectors[0] == cxx::vector<std::string> { "x" });
+    REQUIRE(vectors[9] == cxx::vector<std::string>(9, "9"));
+}
+
+
+TEST_CASE ("[vector] copy and move")
+{
+    const auto original = cxx::vector<std::string> { "a", "b" };
+
+    auto copy  = original;
+    auto moved = std::move(copy);
+
+    REQUIRE(copy.empty());
+    REQUIRE(moved == original);
+
+    copy = moved;
+    REQUIRE(copy == original);
+
+    copy = cxx::vector<std::string> { "c" };
+    REQUIRE(copy == cxx::vector<std::string> { "c" });
+
+    swap(copy, moved);
+    REQUIRE(copy  == original);
+    REQUIRE(moved == cxx::vector<std::string> { "c" });
+}
+
+
+TEST_CASE ("[vector] resize")
+{
+    auto vector = cxx::vector<int> { };
+
+    vector.resize(3);
+    REQUIRE(vector == cxx::vector<int> { 0, 0, 0 });
+
+    vector.resize(5, 7);
+    REQUIRE(vector == cxx::vector<int> { 0, 0, 0, 7, 7 });
+
+    vector.resize(1);
+    REQUIRE(vector == cxx::vector<int> { 0 });
+}
+
+
+TEST_CASE ("[vector] resize with an element of the same vector")
+{
+    auto vector = cxx::vector<std::string> { "first" };
+
+    REQUIRE(vector.size() == vector.capacity());
+
+    vector.resize(4, vector.front());
+
+    REQUIRE(vector == cxx::vector<std::string> { "first", "first", "first", "first" });
+}
+
+
+TEST_CASE ("[vector] shrink_to_fit an empty vector")
+{
+    auto vector = cxx::vector<int> { };
+
+    vector.shrink_to_fit();
+
+    REQUIRE(vector.empty());
+}
+
+
+TEST_CASE ("[vector] strong exception guarantee of reallocation")
+{
+    auto vector = cxx::vector<throwing_value> { };
+
+    vector.reserve(3);
+
+    for (auto n = 0; n != 3; ++n)
+    {
+        vector.emplace_back(n);
+    }
+
+    throwing_value::countdown = 2;
+
+    REQUIRE_THROWS_AS(vector.emplace_back(3), std::runtime_error);
+
+    throwing_value::countdown = -1;
+
+    REQUIRE(vector.size()     == 3);
+    REQUIRE(vector.capacity() == 3);
+    REQUIRE(vector[2].value   == 2);
+}
+
+
+TEST_CASE ("[small_vector] elements are stored inline")
+{
+    auto vector = cxx::small_vector<std::string, 4> { };
+
+    REQUIRE(vector.capacity() == 4);
+
+    const auto inline_storage = vector.data();
+
+    for (auto n = 0; n != 4; ++n)
+    {
+        vector.push_back(std::to_string(n));
+    }
+
+    REQUIRE(vector.data() == inline_storage);
+
+    vector.push_back("4");
+
+    REQUIRE(vector.data() != inline_storage);
+    REQUIRE(vector.capacity() > 4);
+
+    vector.pop_back();
+    vector.shrink_to_fit();
+
+    REQUIRE(vector.data() == inline_storage);
+    REQUIRE(vector == cxx::small_vector<std::string, 4> { "0", "1", "2", "3" });
+}
+
+
+TEST_CASE ("[small_vector] copy and move")
+{
+    auto small = cxx::small_vector<std::unique_ptr<int>, 2> { };
+
+    small.push_back(std::make_unique<int>(1));
+
+    auto moved = std::move(small);
+
+    REQUIRE(small.empty());
+    REQUIRE(*moved.front() == 1);
+
+    auto large = cxx::small_vector<std::string, 2> { "a", "b", "c" };
+    auto small_strings = cxx::small_vector<std::string, 2> { "d" };
+
+    swap(large, small_strings);
+
+    REQUIRE(large         == cxx::small_vector<std::string, 2> { "d" });
+    REQUIRE(small_strings == cxx::small_vector<std::string, 2> { "a", "b", "c" });
+
+    const auto copy = small_strings;
+
+    REQUIRE(copy == small_strings);
 }
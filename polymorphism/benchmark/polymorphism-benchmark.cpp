@@ -0,0 +1,405 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2017, mtezych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <poly/object.h>
+#include <poly/any_of.h>
+#include <poly/collection.h>
+
+#include <benchmark/benchmark.h>
+
+#include <streambuf>
+#include <ostream>
+#include <variant>
+#include <cstdint>
+#include <random>
+#include <memory>
+#include <vector>
+#include <string>
+
+namespace
+{
+	class NullBuffer : public std::streambuf
+	{
+	protected:
+		std::streamsize xsputn (const char*, std::streamsize count) override
+		{
+			return count;
+		}
+
+		int_type overflow (int_type character) override
+		{
+			return character;
+		}
+	};
+
+	struct Print
+	{
+		using signature = void (std::ostream& ostream) const;
+
+		template <typename Type>
+		static void invoke (const Type& value, std::ostream& ostream)
+		{
+			ostream << value;
+		}
+	};
+
+	struct Area
+	{
+		using signature = double () const;
+
+		template <typename Type>
+		static double invoke (const Type& shape)
+		{
+			return shape.Area();
+		}
+	};
+
+	struct Square
+	{
+		double side;
+
+		double Area () const
+		{
+			return side * side;
+		}
+	};
+
+	struct Rectangle
+	{
+		double width;
+		double height;
+
+		double Area () const
+		{
+			return width * height;
+		}
+	};
+
+	struct Triangle
+	{
+		double base;
+		double height;
+
+		double Area () const
+		{
+			return 0.5 * base * height;
+		}
+	};
+
+	//
+	// The classic hierarchy dispatches through a pointer to a heap allocated
+	// object and its virtual table, just like the Concept of the poly::Object.
+	//
+	struct Shape
+	{
+		virtual ~Shape () = default;
+
+		virtual double Area () const = 0;
+	};
+
+	template <typename Type>
+	struct ShapeModel final : Shape
+	{
+		Type shape;
+
+		ShapeModel (Type shape)
+		:
+			shape { shape }
+		{
+		}
+
+		double Area () const override
+		{
+			return shape.Area();
+		}
+	};
+
+	using SharedPrintable   = poly::any_of<poly::copyable, Print>;
+	using EmbeddedPrintable = poly::basic_any_of<4 * sizeof(void*), poly::dispatch::embedded_table,
+	                                             poly::copyable, Print>;
+	using VariantPrintable  = std::variant<int, char, double, std::string>;
+
+	using SharedShape   = poly::any_of<Area>;
+	using EmbeddedShape = poly::basic_any_of<4 * sizeof(void*), poly::dispatch::embedded_table, Area>;
+	using VariantShape  = std::variant<Square, Rectangle, Triangle>;
+
+	constexpr auto ElementCount = 1024;
+
+	template <typename Element>
+	std::vector<Element> MakePrintables ()
+	{
+		auto elements = std::vector<Element> { };
+
+		for (auto index = 0; index < ElementCount; ++index)
+		{
+			switch ((index * 7) % 4)
+			{
+				case 0: elements.push_back(Element { index                              }); break;
+				case 1: elements.push_back(Element { static_cast<char>('a' + index % 26) }); break;
+				case 2: elements.push_back(Element { index * 0.5                        }); break;
+				case 3: elements.push_back(Element { std::string { "text" }             }); break;
+			}
+		}
+
+		return elements;
+	}
+
+	//
+	// The types of shapes are drawn at random, with a fixed seed,
+	// so that neither order of types is predictable nor differs between runs.
+	//
+	template <typename Insert>
+	void GenerateShapes (const std::int64_t count, Insert insert)
+	{
+		auto engine = std::minstd_rand { 7 };
+
+		for (auto index = std::int64_t { 0 }; index < count; ++index)
+		{
+			const auto size = 1.0 + index % 16;
+
+			switch (engine() % 3)
+			{
+				case 0: insert(Square    { size       }); break;
+				case 1: insert(Rectangle { size, 2.0  }); break;
+				case 2: insert(Triangle  { size, size }); break;
+			}
+		}
+	}
+
+	template <typename Shape, typename Make>
+	std::vector<Shape> MakeShapes (const std::int64_t count, Make make)
+	{
+		auto shapes = std::vector<Shape> { };
+
+		GenerateShapes(count, [&] (auto shape) { shapes.push_back(make(shape)); });
+
+		return shapes;
+	}
+
+	template <typename Shape>
+	std::vector<Shape> MakeShapes (const std::int64_t count)
+	{
+		return MakeShapes<Shape>(count, [] (auto shape) { return Shape { shape }; });
+	}
+
+	void PrintObjects (benchmark::State& state)
+	{
+		auto buffer = NullBuffer { };
+		auto stream = std::ostream { &buffer };
+
+		const auto objects = MakePrintables<poly::Object>();
+
+		for (auto _ : state)
+		{
+			for (const auto& object : objects)
+			{
+				object.Print(stream);
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * ElementCount);
+	}
+
+	template <typename Printable>
+	void PrintAnyOf (benchmark::State& state)
+	{
+		auto buffer = NullBuffer { };
+		auto stream = std::ostream { &buffer };
+
+		const auto printables = MakePrintables<Printable>();
+
+		for (auto _ : state)
+		{
+			for (const auto& printable : printables)
+			{
+				printable.template call<Print>(stream);
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * ElementCount);
+	}
+
+	void PrintVariants (benchmark::State& state)
+	{
+		auto buffer = NullBuffer { };
+		auto stream = std::ostream { &buffer };
+
+		const auto variants = MakePrintables<VariantPrintable>();
+
+		for (auto _ : state)
+		{
+			for (const auto& variant : variants)
+			{
+				std::visit([&stream] (const auto& value) { stream << value; }, variant);
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * ElementCount);
+	}
+
+	void CallVirtual (benchmark::State& state)
+	{
+		const std::unique_ptr<Shape> shape = std::make_unique<ShapeModel<Rectangle>>(Rectangle { 2.0, 3.0 });
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(shape);
+			benchmark::DoNotOptimize(shape->Area());
+		}
+	}
+
+	template <typename AnyShape>
+	void CallAnyOf (benchmark::State& state)
+	{
+		const auto shape = AnyShape { Rectangle { 2.0, 3.0 } };
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(shape);
+			benchmark::DoNotOptimize(shape.template call<Area>());
+		}
+	}
+
+	void CallVariant (benchmark::State& state)
+	{
+		const auto shape = VariantShape { Rectangle { 2.0, 3.0 } };
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(shape);
+			benchmark::DoNotOptimize(std::visit([] (const auto& shape) { return shape.Area(); }, shape));
+		}
+	}
+
+	void SumAreasVirtual (benchmark::State& state)
+	{
+		const auto shapes = MakeShapes<std::unique_ptr<Shape>>
+		(
+			state.range(0),
+			[] (auto shape) -> std::unique_ptr<Shape>
+			{
+				return std::make_unique<ShapeModel<decltype(shape)>>(shape);
+			}
+		);
+
+		for (auto _ : state)
+		{
+			auto area = 0.0;
+
+			for (const auto& shape : shapes)
+			{
+				area += shape->Area();
+			}
+
+			benchmark::DoNotOptimize(area);
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	template <typename AnyShape>
+	void SumAreasAnyOf (benchmark::State& state)
+	{
+		const auto shapes = MakeShapes<AnyShape>(state.range(0));
+
+		for (auto _ : state)
+		{
+			auto area = 0.0;
+
+			for (const auto& shape : shapes)
+			{
+				area += shape.template call<Area>();
+			}
+
+			benchmark::DoNotOptimize(area);
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	void SumAreasVariant (benchmark::State& state)
+	{
+		const auto shapes = MakeShapes<VariantShape>(state.range(0));
+
+		for (auto _ : state)
+		{
+			auto area = 0.0;
+
+			for (const auto& shape : shapes)
+			{
+				area += std::visit([] (const auto& shape) { return shape.Area(); }, shape);
+			}
+
+			benchmark::DoNotOptimize(area);
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	void SumAreasCollection (benchmark::State& state)
+	{
+		auto shapes = poly::collection<Square, Rectangle, Triangle> { };
+
+		GenerateShapes(state.range(0), [&shapes] (auto shape) { shapes.insert(shape); });
+
+		for (auto _ : state)
+		{
+			auto area = 0.0;
+
+			shapes.for_each([&area] (const auto& shape) { area += shape.Area(); });
+
+			benchmark::DoNotOptimize(area);
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+}
+BENCHMARK(PrintObjects);
+BENCHMARK_TEMPLATE(PrintAnyOf, SharedPrintable);
+BENCHMARK_TEMPLATE(PrintAnyOf, EmbeddedPrintable);
+BENCHMARK(PrintVariants);
+
+BENCHMARK(CallVirtual);
+BENCHMARK_TEMPLATE(CallAnyOf, SharedShape);
+BENCHMARK_TEMPLATE(CallAnyOf, EmbeddedShape);
+BENCHMARK(CallVariant);
+
+BENCHMARK(SumAreasVirtual)                        ->Arg(1024)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(SumAreasAnyOf, SharedShape)    ->Arg(1024)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(SumAreasAnyOf, EmbeddedShape)  ->Arg(1024)->Arg(1 << 20);
+BENCHMARK(SumAreasVariant)                        ->Arg(1024)->Arg(1 << 20);
+BENCHMARK(SumAreasCollection)                     ->Arg(1024)->Arg(1 << 20);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,405 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2017, mtezych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef POLY_ANY_OF
+#define POLY_ANY_OF
+
+#include <type_traits>
+#include <algorithm>
+#include <concepts>
+#include <utility>
+#include <cstddef>
+#include <memory>
+#include <new>
+
+namespace poly
+{
+	//
+	// The any_of stores values of any type, which implements all its interfaces.
+	// Every interface declares a signature and a static invoke function template,
+	// which is instantiated for every stored type, at compile time,
+	// in a table of plain function pointers, thus calls neither go through
+	// virtual functions nor require heap allocated models.
+	//
+	//   struct print
+	//   {
+	//       using signature = void (std::ostream& ostream) const;
+	//
+	//       template <typename type>
+	//       static auto invoke (const type& value, std::ostream& ostream) -> void
+	//       {
+	//           ostream << value;
+	//       }
+	//   };
+	//
+	//   auto object = poly::any_of<poly::copyable, print> { 7 };
+	//
+	//   object.call<print>(std::cout);
+	//
+	// note: The any_of is move-only, unless the copyable interface is listed,
+	//       hence it can store move-only values, such as std::unique_ptr.
+	//
+	struct copyable
+	{
+	};
+
+	//
+	// The shared_table dispatch stores a pointer to a table shared by all values
+	// of the same type, while the embedded_table dispatch stores the table itself,
+	// trading the size of the any_of for one less dependent load per call.
+	//
+	enum class dispatch
+	{
+		shared_table,
+		embedded_table,
+	};
+
+	namespace detail
+	{
+		template <typename signature>
+		struct signature_traits;
+
+		template <typename result, typename... arguments>
+		struct signature_traits<result (arguments...)>
+		{
+			using function_type = auto (*) (void* storage, arguments... args) -> result;
+
+			template <typename model, typename interface_type>
+			static auto invoke (void* storage, arguments... args) -> result
+			{
+				return interface_type::invoke(model::get(storage), std::forward<arguments>(args)...);
+			}
+		};
+
+		template <typename result, typename... arguments>
+		struct signature_traits<result (arguments...) const>
+		{
+			using function_type = auto (*) (const void* storage, arguments... args) -> result;
+
+			template <typename model, typename interface_type>
+			static auto invoke (const void* storage, arguments... args) -> result
+			{
+				return interface_type::invoke(model::get(storage), std::forward<arguments>(args)...);
+			}
+		};
+
+		template <typename type, std::size_t inline_size>
+		struct model
+		{
+			static constexpr auto is_inline = (sizeof(type)  <= inline_size)
+			                               && (alignof(type) <= alignof(std::max_align_t))
+			                               && std::is_nothrow_move_constructible_v<type>;
+
+			static auto get (void* storage) noexcept -> type&
+			{
+				if constexpr (is_inline)
+				{
+					return *std::launder(static_cast<type*>(storage));
+				}
+				else
+				{
+					return **static_cast<type**>(storage);
+				}
+			}
+
+			static auto get (const void* storage) noexcept -> const type&
+			{
+				return get(const_cast<void*>(storage));
+			}
+
+			template <typename... arguments>
+			static auto construct (void* storage, arguments&&... args) -> void
+			{
+				if constexpr (is_inline)
+				{
+					::new (storage) type (std::forward<arguments>(args)...);
+				}
+				else
+				{
+					::new (storage) type* { new type (std::forward<arguments>(args)...) };
+				}
+			}
+
+			static auto destroy (void* storage) noexcept -> void
+			{
+				if constexpr (is_inline)
+				{
+					std::destroy_at(&get(storage));
+				}
+				else
+				{
+					delete &get(storage);
+				}
+			}
+
+			static auto relocate (void* source, void* target) noexcept -> void
+			{
+				if constexpr (is_inline)
+				{
+					::new (target) type (std::move(get(source)));
+
+					std::destroy_at(&get(source));
+				}
+				else
+				{
+					::new (target) type* { &get(source) };
+				}
+			}
+
+			static auto copy (const void* source, void* target) -> void
+			{
+				construct(target, get(source));
+			}
+		};
+
+		struct empty_model
+		{
+			static auto destroy (void*) noexcept -> void
+			{
+			}
+
+			static auto relocate (void*, void*) noexcept -> void
+			{
+			}
+		};
+
+		template <typename interface_type>
+		struct entry
+		{
+			typename signature_traits<typename interface_type::signature>::function_type function;
+		};
+
+		template <>
+		struct entry<copyable>
+		{
+			auto (*function) (const void* source, void* target) -> void;
+		};
+
+		template <typename model, typename interface_type>
+		constexpr auto make_entry () -> entry<interface_type>
+		{
+			if constexpr (std::is_same_v<interface_type, copyable>)
+			{
+				return { &model::copy };
+			}
+			else
+			{
+				using traits = signature_traits<typename interface_type::signature>;
+
+				return { &traits::template invoke<model, interface_type> };
+			}
+		}
+
+		template <typename... interfaces>
+		struct table : entry<interfaces>...
+		{
+			auto (*destroy)  (void* storage)               noexcept -> void;
+			auto (*relocate) (void* source, void* target) noexcept -> void;
+		};
+
+		template <typename model, typename... interfaces>
+		inline constexpr auto model_table = table<interfaces...>
+		{
+			make_entry<model, interfaces>()...,
+			&model::destroy,
+			&model::relocate,
+		};
+
+		template <typename... interfaces>
+		inline constexpr auto empty_table = table<interfaces...>
+		{
+			entry<interfaces> { }...,
+			&empty_model::destroy,
+			&empty_model::relocate,
+		};
+
+		template <dispatch dispatch_kind, typename table_type>
+		class table_holder;
+
+		template <typename table_type>
+		class table_holder<dispatch::shared_table, table_type>
+		{
+		private:
+			const table_type* pointer;
+
+		public:
+			constexpr table_holder (const table_type& table) noexcept
+			:
+				pointer { &table }
+			{
+			}
+
+			constexpr auto get () const noexcept -> const table_type&
+			{
+				return *pointer;
+			}
+		};
+
+		template <typename table_type>
+		class table_holder<dispatch::embedded_table, table_type>
+		{
+		private:
+			table_type table;
+
+		public:
+			constexpr table_holder (const table_type& table) noexcept
+			:
+				table { table }
+			{
+			}
+
+			constexpr auto get () const noexcept -> const table_type&
+			{
+				return table;
+			}
+		};
+	}
+
+	template <std::size_t inline_size, dispatch dispatch_kind, typename... interfaces>
+	class basic_any_of
+	{
+	private:
+		static constexpr auto storage_size = std::max(inline_size, sizeof(void*));
+
+		static constexpr auto is_copyable = (std::is_same_v<interfaces, copyable> || ...);
+
+		using table_type  = detail::table<interfaces...>;
+		using holder_type = detail::table_holder<dispatch_kind, table_type>;
+
+		template <typename type>
+		using model_type = detail::model<type, storage_size>;
+
+		alignas(std::max_align_t) unsigned char storage [storage_size];
+
+		holder_type holder;
+
+		template <typename interface_type>
+		auto entry () const noexcept -> const detail::entry<interface_type>&
+		{
+			return holder.get();
+		}
+
+	public:
+		template <typename value_type>
+		requires (!std::same_as<std::remove_cvref_t<value_type>, basic_any_of>)
+		//
+		basic_any_of (value_type&& value)
+		:
+			holder { detail::model_table<model_type<std::remove_cvref_t<value_type>>, interfaces...> }
+		{
+			using type = std::remove_cvref_t<value_type>;
+
+			static_assert
+			(
+				!is_copyable || std::is_copy_constructible_v<type>,
+				"Values stored in copyable any_of have to be copy constructible."
+			);
+
+			model_type<type>::construct(storage, std::forward<value_type>(value));
+		}
+
+		~basic_any_of ()
+		{
+			holder.get().destroy(storage);
+		}
+
+		//
+		// note: A moved from any_of holds no value and can only be destroyed
+		//       or assigned to, because its table has no interface functions.
+		//
+		basic_any_of (basic_any_of&& other) noexcept
+		:
+			holder { other.holder }
+		{
+			holder.get().relocate(other.storage, storage);
+
+			other.holder = holder_type { detail::empty_table<interfaces...> };
+		}
+
+		basic_any_of (const basic_any_of& other)
+		requires is_copyable
+		//
+		:
+			holder { other.holder }
+		{
+			other.entry<copyable>().function(other.storage, storage);
+		}
+
+		auto operator = (basic_any_of&& other) noexcept -> basic_any_of&
+		{
+			if (this != &other)
+			{
+				holder.get().destroy(storage);
+
+				holder = other.holder;
+				holder.get().relocate(other.storage, storage);
+
+				other.holder = holder_type { detail::empty_table<interfaces...> };
+			}
+
+			return *this;
+		}
+
+		auto operator = (const basic_any_of& other) -> basic_any_of&
+		requires is_copyable
+		//
+		{
+			return *this = basic_any_of { other };
+		}
+
+		template <typename interface_type, typename... arguments>
+		auto call (arguments&&... args) -> decltype(auto)
+		{
+			return entry<interface_type>().function(storage, std::forward<arguments>(args)...);
+		}
+
+		template <typename interface_type, typename... arguments>
+		auto call (arguments&&... args) const -> decltype(auto)
+		{
+			return entry<interface_type>().function(storage, std::forward<arguments>(args)...);
+		}
+
+		template <typename type>
+		static constexpr auto is_stored_inline () noexcept -> bool
+		{
+			return model_type<type>::is_inline;
+		}
+	};
+
+	template <typename... interfaces>
+	using any_of = basic_any_of<4 * sizeof(void*), dispatch::shared_table, interfaces...>;
+}
+
+#endif
@@ -0,0 +1,139 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2017, mtezych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef POLY_COLLECTION
+#define POLY_COLLECTION
+
+#include <type_traits>
+#include <utility>
+#include <cstddef>
+#include <vector>
+#include <tuple>
+#include <span>
+
+namespace poly
+{
+	//
+	// The collection stores values of its types in separate contiguous segments,
+	// one per type, instead of a single sequence of type erased objects.
+	// Visiting all values goes segment by segment, therefore within a segment
+	// every call is resolved at compile time and can be inlined,
+	// while the hardware keeps predicting branches of a single type at a time.
+	//
+	// note: The order of insertion is preserved only among values of the same type.
+	//
+	template <typename... types>
+	class collection
+	{
+	private:
+		static_assert
+		(
+			((!std::is_reference_v<types> && !std::is_const_v<types>) && ...),
+			"Types of collection have to be non-const object types."
+		);
+
+		std::tuple<std::vector<types>...> segments;
+
+	public:
+		template <typename type>
+		auto insert (type&& value) -> std::remove_cvref_t<type>&
+		{
+			return std::get<std::vector<std::remove_cvref_t<type>>>(segments).emplace_back(std::forward<type>(value));
+		}
+
+		template <typename type, typename... arguments>
+		auto emplace (arguments&&... args) -> type&
+		{
+			return std::get<std::vector<type>>(segments).emplace_back(std::forward<arguments>(args)...);
+		}
+
+		template <typename type>
+		auto segment () noexcept -> std::span<type>
+		{
+			return std::get<std::vector<type>>(segments);
+		}
+
+		template <typename type>
+		auto segment () const noexcept -> std::span<const type>
+		{
+			return std::get<std::vector<type>>(segments);
+		}
+
+		template <typename type>
+		auto reserve (std::size_t capacity) -> void
+		{
+			std::get<std::vector<type>>(segments).reserve(capacity);
+		}
+
+		template <typename function_type>
+		auto for_each (function_type&& function) -> void
+		{
+			(for_each_in(segment<types>(), function), ...);
+		}
+
+		template <typename function_type>
+		auto for_each (function_type&& function) const -> void
+		{
+			(for_each_in(segment<types>(), function), ...);
+		}
+
+		auto size () const noexcept -> std::size_t
+		{
+			return (segment<types>().size() + ... + 0);
+		}
+
+		auto empty () const noexcept -> bool
+		{
+			return (segment<types>().empty() && ...);
+		}
+
+		auto clear () noexcept -> void
+		{
+			(std::get<std::vector<types>>(segments).clear(), ...);
+		}
+
+	private:
+		template <typename range_type, typename function_type>
+		static auto for_each_in (range_type&& range, function_type& function) -> void
+		{
+			for (auto&& value : range)
+			{
+				function(value);
+			}
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,213 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2017, mtezych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef POLY_OBJECT
+#define POLY_OBJECT
+
+#include <type_traits>
+#include <utility>
+#include <ostream>
+#include <cstddef>
+#include <new>
+
+//
+// NDC London 2017: Sean Parent "Better Code: Runtime Polymorphism"
+//
+//   ~ https://www.youtube.com/watch?v=QGcVXgEVMJg
+//
+
+namespace poly
+{
+	//
+	// The BasicObject stores values, whose models fit into InlineSize bytes
+	// and can be moved without throwing, inside the object itself,
+	// so that neither constructing nor copying such values allocates memory.
+	// Inline values are relocated by moving them, whenever the object is moved,
+	// while larger values are allocated on the heap and moved by their pointers.
+	//
+	template <std::size_t InlineSize>
+	class BasicObject
+	{
+	private:
+
+		using Buffer = std::aligned_storage_t<InlineSize, alignof(std::max_align_t)>;
+
+		struct Concept
+		{
+			virtual ~Concept () = default;
+
+			virtual Concept* CloneInto (Buffer& buffer) const = 0;
+
+			virtual Concept* MoveInto (Buffer& buffer) noexcept = 0;
+
+			virtual void Print (std::ostream& ostream) const = 0;
+		};
+
+		template <typename Type>
+		struct Model final : Concept
+		{
+			Type value;
+
+			Model (Type value)
+			:
+				value (std::move(value))
+			{
+			}
+
+			static constexpr bool IsInline = (sizeof(Concept) + sizeof(Type) <= InlineSize)
+			                              && (alignof(Type) <= alignof(std::max_align_t))
+			                              && std::is_nothrow_move_constructible<Type>::value;
+
+			template <typename... Args>
+			static Concept* Create (Buffer& buffer, Args&&... args)
+			{
+				if constexpr (IsInline)
+				{
+					return new (&buffer) Model(std::forward<Args>(args)...);
+				}
+				else
+				{
+					return new Model(std::forward<Args>(args)...);
+				}
+			}
+
+			Concept* CloneInto (Buffer& buffer) const override
+			{
+				return Create(buffer, *this);
+			}
+
+			Concept* MoveInto (Buffer& buffer) noexcept override
+			{
+				return new (&buffer) Model(std::move(*this));
+			}
+
+			void Print (std::ostream& ostream) const override
+			{
+				ostream << value;
+			}
+		};
+
+		Buffer   buffer;
+		Concept* self;
+
+		bool IsStoredInline () const noexcept
+		{
+			return static_cast<const void*>(self) == static_cast<const void*>(&buffer);
+		}
+
+		void Destroy () noexcept
+		{
+			if (IsStoredInline())
+			{
+				self->~Concept();
+			}
+			else
+			{
+				delete self;
+			}
+		}
+
+		void Steal (BasicObject& object) noexcept
+		{
+			if (object.IsStoredInline())
+			{
+				self = object.self->MoveInto(buffer);
+			}
+			else
+			{
+				self = std::exchange(object.self, nullptr);
+			}
+		}
+
+	public:
+
+		template <typename Type,
+		          typename = std::enable_if_t<!std::is_same<std::decay_t<Type>, BasicObject>::value>>
+		BasicObject (Type value)
+		:
+			self { Model<Type>::Create(buffer, std::move(value)) }
+		{
+		}
+
+		~BasicObject ()
+		{
+			Destroy();
+		}
+
+		//
+		// A moved from object, whose value has been stored inline,
+		// still holds the moved from value, while one, whose value
+		// has been allocated on the heap, holds nothing at all.
+		// Either can only be destroyed or assigned to.
+		//
+		BasicObject (BasicObject&& object) noexcept
+		{
+			Steal(object);
+		}
+
+		BasicObject (const BasicObject& object)
+		:
+			self { object.self->CloneInto(buffer) }
+		{
+		}
+
+		BasicObject& operator = (BasicObject&& object) noexcept
+		{
+			if (this != &object)
+			{
+				Destroy();
+
+				Steal(object);
+			}
+
+			return *this;
+		}
+
+		BasicObject& operator = (const BasicObject& object)
+		{
+			*this = BasicObject { object };
+
+			return *this;
+		}
+
+		void Print (std::ostream& ostream) const
+		{
+			self->Print(ostream);
+		}
+	};
+
+	using Object = BasicObject<4 * sizeof(void*)>;
+}
+
+#endif
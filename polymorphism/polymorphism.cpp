@@ -32,88 +32,30 @@
  * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <poly/object.h>
+
 #include <iostream>
-#include <utility>
-#include <memory>
 #include <vector>
 #include <string>
 
-//
-// NDC London 2017: Sean Parent "Better Code: Runtime Polymorphism"
-//
-//   ~ https://www.youtube.com/watch?v=QGcVXgEVMJg
-//
-
 namespace poly
 {
-	class Object
+	std::ostream&
+	operator << (std::ostream& ostream, const std::vector<Object>& objects)
 	{
-	private:
+		ostream << "[ ";
 
-		struct Concept
+		for (const auto& object : objects)
 		{
-			virtual ~Concept () = default;
-
-			virtual std::unique_ptr<Concept> Clone () const = 0;
-
-			virtual void Print (std::ostream& ostream) const = 0;
-		};
-
-		template <typename Type>
-		struct Model final : Concept
-		{
-			Type value;
-
-			Model (Type value)
-			:
-				value (std::move(value))
-			{
-			}
-
-			std::unique_ptr<Concept> Clone () const override
-			{
-				return std::make_unique<Model>(*this);
-			}
-
-			void Print (std::ostream& ostream) const override
-			{
-				ostream << value;
-			}
-		};
+			object.Print(ostream);
 
-		std::unique_ptr<Concept> self;
-
-	public:
-
-		template <typename Type>
-		Object (Type value)
-		:
-			self { std::make_unique<Model<Type>>(std::move(value)) }
-		{
-		}
-
-		Object (Object&& object) noexcept = default;
-
-		Object (const Object& object)
-		:
-			self { object.self->Clone() }
-		{
+			ostream << ' ';
 		}
 
-		Object& operator = (Object&& object) noexcept = default;
+		ostream << ']';
 
-		Object& operator = (const Object& object)
-		{
-			*this = Object { object };
-
-			return *this;
-		}
-
-		void Print (std::ostream& ostream) const
-		{
-			self->Print(ostream);
-		}
-	};
+		return ostream;
+	}
 }
 
 namespace foo
@@ -131,23 +73,6 @@ namespace foo
 	}
 }
 
-std::ostream&
-operator << (std::ostream& ostream, const std::vector<poly::Object>& objects)
-{
-	ostream << "[ ";
-
-	for (const auto& object : objects)
-	{
-		object.Print(ostream);
-
-		ostream << ' ';
-	}
-
-	ostream << ']';
-
-	return ostream;
-}
-
 int main ()
 {
 	auto objects = std::vector<poly::Object>
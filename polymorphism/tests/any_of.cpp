@@ -0,0 +1,370 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2017, mtezych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <poly/any_of.h>
+
+#include <catch2/catch.hpp>
+
+#include <type_traits>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+
+namespace
+{
+	namespace test
+	{
+		struct value_of
+		{
+			using signature = int () const;
+
+			template <typename type>
+			static auto invoke (const type& value) -> int
+			{
+				return value.value();
+			}
+		};
+
+		struct increment
+		{
+			using signature = void (int amount);
+
+			template <typename type>
+			static auto invoke (type& value, int amount) -> void
+			{
+				value.add(amount);
+			}
+		};
+
+		template <std::size_t padding_size>
+		struct counted
+		{
+			static inline auto live_count = 0;
+
+			int number;
+
+			unsigned char padding [padding_size] { };
+
+			counted (int number) noexcept
+			:
+				number { number }
+			{
+				++live_count;
+			}
+
+			counted (const counted& other) noexcept
+			:
+				number { other.number }
+			{
+				++live_count;
+			}
+
+			counted (counted&& other) noexcept
+			:
+				number { other.number }
+			{
+				++live_count;
+			}
+
+			~counted ()
+			{
+				--live_count;
+			}
+
+			auto value () const -> int
+			{
+				return number;
+			}
+
+			auto add (int amount) -> void
+			{
+				number += amount;
+			}
+		};
+
+		using small = counted<1>;
+		using large = counted<256>;
+
+		struct throwing_move
+		{
+			int number;
+
+			throwing_move (int number) noexcept
+			:
+				number { number }
+			{
+			}
+
+			throwing_move (throwing_move&& other) noexcept(false)
+			:
+				number { other.number }
+			{
+			}
+
+			auto value () const -> int
+			{
+				return number;
+			}
+
+			auto add (int amount) -> void
+			{
+				number += amount;
+			}
+		};
+
+		struct move_only
+		{
+			std::unique_ptr<int> pointer;
+
+			move_only (int number)
+			:
+				pointer { std::make_unique<int>(number) }
+			{
+			}
+
+			auto value () const -> int
+			{
+				return *pointer;
+			}
+
+			auto add (int amount) -> void
+			{
+				*pointer += amount;
+			}
+		};
+
+		template <poly::dispatch dispatch_kind, typename... interfaces>
+		using any_of = poly::basic_any_of<4 * sizeof(void*), dispatch_kind, interfaces...>;
+
+		template <poly::dispatch dispatch_kind>
+		auto check_storage () -> void
+		{
+			using object = any_of<dispatch_kind, value_of, increment>;
+
+			static_assert( object::template is_stored_inline<int          >());
+			static_assert( object::template is_stored_inline<small        >());
+			static_assert(!object::template is_stored_inline<large        >());
+			static_assert(!object::template is_stored_inline<throwing_move>());
+
+			{
+				auto inline_object = object { small { 1 } };
+				auto heap_object   = object { large { 2 } };
+
+				REQUIRE(small::live_count == 1);
+				REQUIRE(large::live_count == 1);
+
+				inline_object.template call<increment>(10);
+				heap_object  .template call<increment>(20);
+
+				REQUIRE(inline_object.template call<value_of>() == 11);
+				REQUIRE(heap_object  .template call<value_of>() == 22);
+
+				auto other_object = object { throwing_move { 3 } };
+
+				REQUIRE(other_object.template call<value_of>() == 3);
+			}
+
+			REQUIRE(small::live_count == 0);
+			REQUIRE(large::live_count == 0);
+		}
+
+		template <poly::dispatch dispatch_kind>
+		auto check_move_only () -> void
+		{
+			using object = any_of<dispatch_kind, value_of, increment>;
+
+			static_assert(!std::is_copy_constructible_v<object>);
+			static_assert(!std::is_copy_assignable_v   <object>);
+			static_assert( std::is_nothrow_move_constructible_v<object>);
+			static_assert( std::is_nothrow_move_assignable_v   <object>);
+
+			auto source = object { move_only { 7 } };
+			auto target = object { std::move(source) };
+
+			target.template call<increment>(1);
+
+			REQUIRE(target.template call<value_of>() == 8);
+
+			source = object { move_only { 5 } };
+			target = std::move(source);
+
+			REQUIRE(target.template call<value_of>() == 5);
+		}
+
+		template <poly::dispatch dispatch_kind, typename type>
+		auto check_copyable () -> void
+		{
+			using object = any_of<dispatch_kind, poly::copyable, value_of, increment>;
+
+			static_assert(std::is_copy_constructible_v<object>);
+			static_assert(std::is_copy_assignable_v   <object>);
+
+			{
+				auto original = object { type { 1 } };
+				auto copy     = original;
+
+				REQUIRE(type::live_count == 2);
+
+				copy.template call<increment>(1);
+
+				REQUIRE(original.template call<value_of>() == 1);
+				REQUIRE(copy    .template call<value_of>() == 2);
+
+				auto other = object { type { 10 } };
+
+				REQUIRE(type::live_count == 3);
+
+				other = original;
+
+				REQUIRE(type::live_count == 3);
+
+				other.template call<increment>(2);
+
+				REQUIRE(original.template call<value_of>() == 1);
+				REQUIRE(other   .template call<value_of>() == 3);
+			}
+
+			REQUIRE(type::live_count == 0);
+		}
+
+		template <poly::dispatch dispatch_kind, typename type>
+		auto check_moved_from () -> void
+		{
+			using object = any_of<dispatch_kind, value_of, increment>;
+
+			{
+				auto source = object { type { 1 } };
+				auto target = object { std::move(source) };
+
+				REQUIRE(type::live_count == 1);
+				REQUIRE(target.template call<value_of>() == 1);
+
+				source = object { type { 2 } };
+
+				REQUIRE(type::live_count == 2);
+				REQUIRE(source.template call<value_of>() == 2);
+
+				target = std::move(source);
+
+				REQUIRE(type::live_count == 1);
+				REQUIRE(target.template call<value_of>() == 2);
+
+				auto other = std::move(source);
+
+				REQUIRE(type::live_count == 1);
+
+				source = std::move(other);
+
+				REQUIRE(type::live_count == 1);
+			}
+
+			REQUIRE(type::live_count == 0);
+		}
+	}
+}
+
+
+TEST_CASE ("[any_of] small values are stored inline and large values on the heap")
+{
+	SECTION ("shared table")
+	{
+		test::check_storage<poly::dispatch::shared_table>();
+	}
+
+	SECTION ("embedded table")
+	{
+		test::check_storage<poly::dispatch::embedded_table>();
+	}
+}
+
+TEST_CASE ("[any_of] stores move-only values")
+{
+	SECTION ("shared table")
+	{
+		test::check_move_only<poly::dispatch::shared_table>();
+	}
+
+	SECTION ("embedded table")
+	{
+		test::check_move_only<poly::dispatch::embedded_table>();
+	}
+}
+
+TEST_CASE ("[any_of] copies copyable values")
+{
+	SECTION ("shared table, inline storage")
+	{
+		test::check_copyable<poly::dispatch::shared_table, test::small>();
+	}
+
+	SECTION ("shared table, heap storage")
+	{
+		test::check_copyable<poly::dispatch::shared_table, test::large>();
+	}
+
+	SECTION ("embedded table, inline storage")
+	{
+		test::check_copyable<poly::dispatch::embedded_table, test::small>();
+	}
+
+	SECTION ("embedded table, heap storage")
+	{
+		test::check_copyable<poly::dispatch::embedded_table, test::large>();
+	}
+}
+
+TEST_CASE ("[any_of] moved from object can be destroyed, moved and assigned to")
+{
+	SECTION ("shared table, inline storage")
+	{
+		test::check_moved_from<poly::dispatch::shared_table, test::small>();
+	}
+
+	SECTION ("shared table, heap storage")
+	{
+		test::check_moved_from<poly::dispatch::shared_table, test::large>();
+	}
+
+	SECTION ("embedded table, inline storage")
+	{
+		test::check_moved_from<poly::dispatch::embedded_table, test::small>();
+	}
+
+	SECTION ("embedded table, heap storage")
+	{
+		test::check_moved_from<poly::dispatch::embedded_table, test::large>();
+	}
+}
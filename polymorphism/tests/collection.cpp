@@ -0,0 +1,231 @@
+
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2017, mtezych
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <poly/collection.h>
+
+#include <catch2/catch.hpp>
+
+#include <type_traits>
+#include <utility>
+#include <string>
+#include <vector>
+#include <span>
+
+
+namespace
+{
+	namespace test
+	{
+		struct point
+		{
+			int x;
+			int y;
+
+			auto operator == (const point&) const -> bool = default;
+		};
+
+		using collection = poly::collection<int, std::string, point>;
+	}
+}
+
+
+TEST_CASE ("[collection] new collection is empty")
+{
+	const auto values = test::collection { };
+
+	REQUIRE(values.empty());
+	REQUIRE(values.size() == 0);
+
+	REQUIRE(values.segment<int        >().empty());
+	REQUIRE(values.segment<std::string>().empty());
+	REQUIRE(values.segment<test::point>().empty());
+}
+
+TEST_CASE ("[collection] insert and emplace put values in segments of their types")
+{
+	auto values = test::collection { };
+
+	auto& number = values.insert(7);
+	auto& text   = values.insert(std::string { "seven" });
+	auto& point  = values.emplace<test::point>(7, 8);
+
+	static_assert(std::is_same_v<decltype(number), int&        >);
+	static_assert(std::is_same_v<decltype(text  ), std::string&>);
+	static_assert(std::is_same_v<decltype(point ), test::point&>);
+
+	const auto word = std::string { "eight" };
+
+	values.insert(word);
+	values.emplace<std::string>(3u, 'x');
+
+	REQUIRE(!values.empty());
+	REQUIRE(values.size() == 5);
+
+	REQUIRE(values.segment<int        >().size() == 1);
+	REQUIRE(values.segment<std::string>().size() == 3);
+	REQUIRE(values.segment<test::point>().size() == 1);
+
+	REQUIRE(values.segment<int        >()[0] == 7);
+	REQUIRE(values.segment<std::string>()[0] == "seven");
+	REQUIRE(values.segment<std::string>()[1] == "eight");
+	REQUIRE(values.segment<std::string>()[2] == "xxx");
+	REQUIRE(values.segment<test::point>()[0] == test::point { 7, 8 });
+}
+
+TEST_CASE ("[collection] values of the same type keep their insertion order")
+{
+	auto values = test::collection { };
+
+	values.reserve<int>(4);
+
+	values.insert(1);
+	values.insert(std::string { "a" });
+	values.insert(2);
+	values.insert(test::point { 1, 1 });
+	values.insert(std::string { "b" });
+	values.insert(3);
+	values.insert(test::point { 2, 2 });
+	values.insert(4);
+
+	REQUIRE(values.size() == 8);
+
+	const auto numbers = values.segment<int>();
+	const auto texts   = values.segment<std::string>();
+	const auto points  = values.segment<test::point>();
+
+	REQUIRE(std::vector<int        > { numbers.begin(), numbers.end() } == std::vector<int> { 1, 2, 3, 4 });
+	REQUIRE(std::vector<std::string> { texts  .begin(), texts  .end() } == std::vector<std::string> { "a", "b" });
+	REQUIRE(std::vector<test::point> { points .begin(), points .end() } == std::vector<test::point> { { 1, 1 }, { 2, 2 } });
+}
+
+TEST_CASE ("[collection] for_each visits all values segment by segment")
+{
+	auto values = test::collection { };
+
+	values.insert(std::string { "a" });
+	values.insert(1);
+	values.insert(test::point { 1, 2 });
+	values.insert(2);
+	values.insert(std::string { "b" });
+
+	SECTION ("non-const")
+	{
+		values.for_each([] (auto& value)
+		{
+			static_assert(!std::is_const_v<std::remove_reference_t<decltype(value)>>);
+
+			using type = std::remove_cvref_t<decltype(value)>;
+
+			if constexpr (std::is_same_v<type, int>)
+			{
+				value *= 10;
+			}
+			else if constexpr (std::is_same_v<type, std::string>)
+			{
+				value += "!";
+			}
+			else
+			{
+				value.x = -value.x;
+			}
+		});
+
+		REQUIRE(values.segment<int        >()[0] == 10);
+		REQUIRE(values.segment<int        >()[1] == 20);
+		REQUIRE(values.segment<std::string>()[0] == "a!");
+		REQUIRE(values.segment<std::string>()[1] == "b!");
+		REQUIRE(values.segment<test::point>()[0] == test::point { -1, 2 });
+	}
+
+	SECTION ("const")
+	{
+		const auto& const_values = values;
+
+		auto visited = std::vector<std::string> { };
+
+		const_values.for_each([&visited] (auto& value)
+		{
+			static_assert(std::is_const_v<std::remove_reference_t<decltype(value)>>);
+
+			using type = std::remove_cvref_t<decltype(value)>;
+
+			if constexpr (std::is_same_v<type, int>)
+			{
+				visited.push_back(std::to_string(value));
+			}
+			else if constexpr (std::is_same_v<type, std::string>)
+			{
+				visited.push_back(value);
+			}
+			else
+			{
+				visited.push_back(std::to_string(value.x) + "," + std::to_string(value.y));
+			}
+		});
+
+		REQUIRE(visited == std::vector<std::string> { "1", "2", "a", "b", "1,2" });
+	}
+}
+
+TEST_CASE ("[collection] clear removes values of all types")
+{
+	auto values = test::collection { };
+
+	values.insert(1);
+	values.insert(std::string { "a" });
+	values.insert(test::point { 1, 2 });
+
+	REQUIRE(values.size() == 3);
+
+	values.clear();
+
+	REQUIRE(values.empty());
+	REQUIRE(values.size() == 0);
+
+	REQUIRE(values.segment<int        >().empty());
+	REQUIRE(values.segment<std::string>().empty());
+	REQUIRE(values.segment<test::point>().empty());
+
+	auto count = 0;
+
+	values.for_each([&count] (const auto&) { ++count; });
+
+	REQUIRE(count == 0);
+
+	values.insert(2);
+
+	REQUIRE(values.size() == 1);
+	REQUIRE(values.segment<int>()[0] == 2);
+}
@@ -82,11 +82,19 @@ namespace cxx
     //
     // ~ https://groups.google.com/a/isocpp.org/d/msg/std-discussion/rt2ivJnc4hg/4RKYJeF5CQAJ
     //
+    // note: The stack_alloc() function refuses requests larger than
+    //       the stack_alloc_limit, because the stack of a thread is typically
+    //       only a few megabytes large and alloca() does not report overflows.
+    //       Larger or runtime-sized buffers should use the stack_array instead.
+    //
+    constexpr auto stack_alloc_limit = std::ptrdiff_t { 16 * 1024 };
+
     template <typename type>
     always_inline
     auto stack_alloc (const std::ptrdiff_t count = 1) noexcept -> memory_block<type>
     {
         assert(count > 0);
+        assert(count <= stack_alloc_limit / static_cast<std::ptrdiff_t>(sizeof(type)));
 
     #if defined(__linux__)
 
@@ -101,30 +109,381 @@ namespace cxx
 }
 
 
+#include <algorithm>
+
+#include <cstdint>
+
 #include <new>
 
+#include <utility>
+
 namespace cxx
 {
-    template <typename element>
+    //
+    // The inline_arena_statistics count, per thread, how many allocations
+    // have been served by the in-frame buffers of the inline arenas
+    // and how many have fallen back to the overflow stack or to the heap.
+    // Frequent fallbacks indicate that the in-frame budget is too small.
+    //
+    struct inline_arena_statistics
+    {
+        std::size_t inline_allocations;
+        std::size_t  stack_fallbacks;
+        std::size_t   heap_fallbacks;
+        std::size_t fallback_bytes;
+    };
+
+    inline thread_local auto inline_arena_stats = inline_arena_statistics { };
+
+    namespace detail
+    {
+        constexpr auto max_alignment = alignof(std::max_align_t);
+
+        constexpr auto align_up (const std::size_t value, const std::size_t alignment) noexcept
+        -> std::size_t
+        {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+
+        //
+        // The overflow_stack is a thread-local stack of memory chunks,
+        // which serves allocations, that do not fit into the in-frame buffers.
+        // Since inline arenas are destroyed in the reverse order of their
+        // construction, the memory they spilled can be released by rewinding
+        // the stack to the marker, which was taken when they first spilled.
+        //
+        // Only the arena, which spilled last, may allocate from the stack,
+        // because rewinding it would otherwise release memory still used
+        // by an enclosing arena. Enclosing arenas fall back to the heap instead.
+        // Therefore an arena takes the stack only when it is unowned or owned
+        // by an arena constructed before it, which is tracked by nesting depth.
+        //
+        // The most recently released chunk is kept for reuse,
+        // so that a hot loop, which spills every iteration, stays off the heap.
+        //
+        class overflow_stack
+        {
+        private:
+
+            struct chunk
+            {
+                chunk*      previous;
+                std::size_t size;
+                std::size_t used;
+            };
+
+            static constexpr auto chunk_header = align_up(sizeof(chunk), max_alignment);
+            static constexpr auto chunk_size   = std::size_t { 64 * 1024 };
+
+            chunk*      top   = nullptr;
+            chunk*      spare = nullptr;
+
+            const void* owner       = nullptr;
+            std::size_t owner_depth = 0;
+            std::size_t live_arenas = 0;
+
+            static auto release (chunk* const released) noexcept -> void
+            {
+                ::operator delete(released);
+            }
+
+        public:
+
+            struct marker
+            {
+                chunk*      top;
+                std::size_t used;
+                const void* owner;
+                std::size_t owner_depth;
+            };
+
+            overflow_stack () = default;
+
+            ~overflow_stack ()
+            {
+                while (top != nullptr)
+                {
+                    release(std::exchange(top, top->previous));
+                }
+
+                if (spare != nullptr)
+                {
+                    release(spare);
+                }
+            }
+
+            overflow_stack (const overflow_stack&) = delete;
+            overflow_stack& operator = (const overflow_stack&) = delete;
+
+            auto is_owned_by (const void* const arena) const noexcept -> bool
+            {
+                return owner == arena;
+            }
+
+            auto enter () noexcept -> std::size_t
+            {
+                return ++live_arenas;
+            }
+
+            auto leave () noexcept -> void
+            {
+                --live_arenas;
+            }
+
+            auto can_acquire (const std::size_t depth) const noexcept -> bool
+            {
+                return (owner == nullptr) || (owner_depth < depth);
+            }
+
+            auto acquire (const void* const arena, const std::size_t depth) noexcept -> marker
+            {
+                assert(can_acquire(depth));
+
+                const auto saved = marker { top, (top != nullptr) ? top->used : 0, owner, owner_depth };
+
+                owner       = arena;
+                owner_depth = depth;
+
+                return saved;
+            }
+
+            auto rewind (const void* const arena, const marker& saved) noexcept -> void
+            {
+                assert(is_owned_by(arena));
+
+                while (top != saved.top)
+                {
+                    const auto released = std::exchange(top, top->previous);
+
+                    if ((spare == nullptr) || (spare->size < released->size))
+                    {
+                        if (spare != nullptr)
+                        {
+                            release(spare);
+                        }
+
+                        spare = released;
+                    }
+                    else
+                    {
+                        release(released);
+                    }
+                }
+
+                if (top != nullptr)
+                {
+                    top->used = saved.used;
+                }
+
+                owner       = saved.owner;
+                owner_depth = saved.owner_depth;
+            }
+
+            auto allocate (const std::size_t bytes, const std::size_t alignment) -> void*
+            {
+                if (top != nullptr)
+                {
+                    const auto offset = align_up(top->used, alignment);
+
+                    if (offset + bytes <= top->size)
+                    {
+                        top->used = offset + bytes;
+
+                        return reinterpret_cast<std::byte*>(top) + offset;
+                    }
+                }
+
+                const auto required = chunk_header + bytes;
+
+                auto fresh = static_cast<chunk*>(nullptr);
+
+                if ((spare != nullptr) && (spare->size >= required))
+                {
+                    fresh = std::exchange(spare, nullptr);
+                }
+                else
+                {
+                    const auto size = std::max(chunk_size, required);
+
+                    fresh = static_cast<chunk*>(::operator new(size));
+                    fresh->size = size;
+                }
+
+                fresh->previous = top;
+                fresh->used     = required;
+
+                top = fresh;
+
+                return reinterpret_cast<std::byte*>(fresh) + chunk_header;
+            }
+        };
+
+        inline thread_local auto overflow = overflow_stack { };
+
+        //
+        // Heap fallbacks are linked into a list, which the arena frees at once.
+        //
+        struct heap_block
+        {
+            heap_block* previous;
+        };
+
+        constexpr auto heap_block_header = align_up(sizeof(heap_block), max_alignment);
+    }
+
+    //
+    // The inline_arena serves allocations from a buffer of a fixed size,
+    // which is embedded in the arena itself, so an arena declared as a local
+    // variable allocates from the stack frame of its function. Requests, which
+    // exceed the buffer, fall back to the thread-local overflow stack or,
+    // when that is used by an inner arena, to the heap. All memory is released,
+    // when the arena is destroyed.
+    //
+    template <std::size_t capacity>
+    class inline_arena
+    {
+    private:
+
+        alignas(std::max_align_t) std::byte buffer [capacity];
+
+        std::size_t                    used;
+        std::size_t                    depth;
+
+        bool                           spilled;
+        detail::overflow_stack::marker saved;
+
+        detail::heap_block*            heap_blocks;
+
+        auto allocate_fallback (const std::size_t bytes, const std::size_t alignment) -> void*
+        {
+            inline_arena_stats.fallback_bytes += bytes;
+
+            if (!spilled && detail::overflow.can_acquire(depth))
+            {
+                saved   = detail::overflow.acquire(this, depth);
+                spilled = true;
+            }
+
+            if (detail::overflow.is_owned_by(this))
+            {
+                ++inline_arena_stats.stack_fallbacks;
+
+                return detail::overflow.allocate(bytes, alignment);
+            }
+
+            ++inline_arena_stats.heap_fallbacks;
+
+            const auto memory = static_cast<std::byte*>(
+                ::operator new(detail::heap_block_header + bytes));
+
+            heap_blocks = ::new (static_cast<void*>(memory)) detail::heap_block { heap_blocks };
+
+            return memory + detail::heap_block_header;
+        }
+
+    public:
+
+        inline_arena () noexcept
+        :
+            used        { 0                         },
+            depth       { detail::overflow.enter() },
+            spilled     { false                     },
+            saved       {                           },
+            heap_blocks { nullptr                   }
+        {
+        }
+
+        ~inline_arena ()
+        {
+            while (heap_blocks != nullptr)
+            {
+                ::operator delete(std::exchange(heap_blocks, heap_blocks->previous));
+            }
+
+            if (spilled)
+            {
+                detail::overflow.rewind(this, saved);
+            }
+
+            detail::overflow.leave();
+        }
+
+        inline_arena (inline_arena&& arena)      = delete;
+        inline_arena (const inline_arena& arena) = delete;
+
+        inline_arena& operator = (inline_arena&& arena)      = delete;
+        inline_arena& operator = (const inline_arena& arena) = delete;
+
+        auto allocate (const std::size_t bytes,
+                       const std::size_t alignment = alignof(std::max_align_t)) -> void*
+        {
+            assert((alignment != 0) && ((alignment & (alignment - 1)) == 0));
+            assert(alignment <= detail::max_alignment);
+
+            const auto offset = detail::align_up(used, alignment);
+
+            if ((offset <= capacity) && (bytes <= capacity - offset))
+            {
+                ++inline_arena_stats.inline_allocations;
+
+                used = offset + bytes;
+
+                return buffer + offset;
+            }
+
+            return allocate_fallback(bytes, alignment);
+        }
+
+        auto size () const noexcept -> std::size_t
+        {
+            return capacity;
+        }
+    };
+
+    //
+    // The stack_array stores up to a runtime capacity of elements
+    // in an inline_arena, which holds inline_count elements in the stack frame.
+    // Unlike the memory returned by stack_alloc(), the elements are destroyed
+    // together with the stack_array.
+    //
+    template <typename element,
+              std::size_t inline_count = std::max<std::size_t>(4096 / sizeof(element), 1)>
     class stack_array
     {
+        static_assert(alignof(element) <= alignof(std::max_align_t),
+                      "over-aligned elements are not supported");
+
     private:
 
+        inline_arena<inline_count * sizeof(element)> arena;
+
         memory_block<element> storage;
         std::ptrdiff_t        length;
 
     public:
 
-        always_inline
         explicit stack_array (const std::ptrdiff_t capacity)
         :
-            storage { stack_alloc<element>(capacity) },
-            length  { 0                              }
+            arena   {                   },
+            storage { nullptr, capacity },
+            length  { 0                 }
         {
             assert(capacity > 0);
+
+            storage.addr = static_cast<element*>(
+                arena.allocate(sizeof(element) * static_cast<std::size_t>(capacity),
+                               alignof(element)));
         }
 
-        ~stack_array () = default;
+        ~stack_array ()
+        {
+            while (length > 0)
+            {
+                --length;
+
+                storage.addr[length].~element();
+            }
+        }
 
         stack_array (stack_array&& array)      = delete;
         stack_array (const stack_array& array) = delete;
@@ -224,6 +583,102 @@ namespace test
 
         return sum == array.size();
     }
+
+    auto inline_arena () -> bool
+    {
+        const auto before = cxx::inline_arena_stats;
+
+        {
+            auto arena = cxx::inline_arena<256> { };
+
+            const auto small = arena.allocate(200);
+            const auto large = arena.allocate(200);
+
+            if ((small == nullptr) || (large == nullptr))
+            {
+                return false;
+            }
+
+            {
+                auto inner = cxx::inline_arena<64> { };
+
+                static_cast<void>(inner.allocate(1024));
+
+                // The inner arena owns the overflow stack,
+                // so the outer arena has to fall back to the heap.
+                static_cast<void>(arena.allocate(1024));
+            }
+
+            static_cast<void>(arena.allocate(1024));
+        }
+
+        const auto& after = cxx::inline_arena_stats;
+
+        return (after.inline_allocations - before.inline_allocations == 1)
+            && (after. stack_fallbacks   - before. stack_fallbacks   == 3)
+            && (after.  heap_fallbacks   - before.  heap_fallbacks   == 1)
+            && (after.fallback_bytes     - before.fallback_bytes     == 200 + 3 * 1024);
+    }
+
+    auto inline_arena_spilling_after_inner () -> bool
+    {
+        const auto before = cxx::inline_arena_stats;
+
+        {
+            auto arena = cxx::inline_arena<64> { };
+
+            {
+                auto inner = cxx::inline_arena<64> { };
+
+                static_cast<void>(inner.allocate(1024));
+
+                // The outer arena spills first, while the inner arena
+                // owns the overflow stack, so it must not take the stack.
+                static_cast<void>(arena.allocate(1024));
+            }
+
+            static_cast<void>(arena.allocate(1024));
+        }
+
+        const auto& after = cxx::inline_arena_stats;
+
+        return (after.stack_fallbacks - before.stack_fallbacks == 2)
+            && (after. heap_fallbacks - before. heap_fallbacks == 1);
+    }
+
+    auto stack_array_destructors () -> bool
+    {
+        struct counted
+        {
+            int* destroyed;
+
+            ~counted ()
+            {
+                ++*destroyed;
+            }
+        };
+
+        auto destroyed = 0;
+
+        {
+            auto  inline_array = cxx::stack_array<counted, 16> {  8 };
+            auto spilled_array = cxx::stack_array<counted, 16> { 32 };
+
+            for (auto i = 0; i < 8; ++i)
+            {
+                inline_array.push(counted { &destroyed });
+            }
+
+            for (auto i = 0; i < 32; ++i)
+            {
+                spilled_array.push(counted { &destroyed });
+            }
+
+            destroyed = 0;
+        }
+
+        return destroyed == 8 + 32;
+    }
 }
 
 
@@ -241,6 +696,9 @@ auto main () -> int
 
     validate(test::stack_alloc());
     validate(test::stack_array());
+    validate(test::inline_arena());
+    validate(test::inline_arena_spilling_after_inner());
+    validate(test::stack_array_destructors());
 
     return EXIT_SUCCESS;
 }